@@ -99,18 +99,9 @@ sub parse_entry {
 	return $ret;
 }
 
-# print .cpp preample
-print "/**\n";
-print " * This file was generated automatically.\n";
-print " * It is not intended to be human readable.\n";
-print " * See help/README.md for details.\n";
-print " */\n\n";
-print "#include \"RbHelpDatabase.h\"\n\n";
-print "using namespace std;\n\n";
-print "RevBayesCore::RbHelpDatabase::RbHelpDatabase()\n{\n";
-
-# go through each markdown file
-foreach my $file (sort @ARGV) {
+# collect the entries of all markdown files
+my %entries;
+foreach my $file (@ARGV) {
 	$file =~ /([^\/]+)$/;
 	my $name = $1;
 	$name =~ s/\.md$//;
@@ -136,26 +127,57 @@ foreach my $file (sort @ARGV) {
 
 	$entry{$key} = parse_entry($key, $value);
 
-	# print .cpp map entries for each markdown field
+	$entries{$name} = \%entry;
+}
+
+# build the table rows for each markdown field
+# the tables are sorted by name and key, because RbHelpDatabase uses binary search on them
+my @strings;
+my @arrays;
+my @references;
+foreach my $name (sort keys %entries) {
+	my %entry = %{$entries{$name}};
 	foreach my $key (sort keys %entry) {
 		if ( ref($entry{$key}) eq 'ARRAY' ) {
-			my @cpp;
 			foreach my $item ( @{$entry{$key}} ) {
 				if ( ref($item) eq 'HASH' ) {
 					my %hash = %{$item};
-					print "\thelp_references[string(\"$name\")].push_back(RbHelpReference(R\"($hash{'citation'})\",R\"($hash{'doi'})\",R\"($hash{'url'})\"));\n";
+					push @references, "\t{ \"$name\", R\"($hash{'citation'})\", R\"($hash{'doi'})\", R\"($hash{'url'})\" },\n";
 				} else {
-					print "\thelp_arrays[string(\"$name\")][string(\"$key\")].push_back(string(R\"($item)\"));\n";
+					push @arrays, "\t{ \"$name\", \"$key\", R\"($item)\" },\n";
 				}
 			}
 		} else {
 			$entry{$key} =~ s/\s+$//g;
 			if ( $entry{$key} ne "" )
 			{
-				print "\thelp_strings[string(\"$name\")][string(\"$key\")] = string(R\"($entry{$key})\");\n";
+				push @strings, "\t{ \"$name\", \"$key\", R\"($entry{$key})\" },\n";
 			}
 		}
 	}
 }
 
-print "}\n";
+# print .cpp preample
+print "/**\n";
+print " * This file was generated automatically.\n";
+print " * It is not intended to be human readable.\n";
+print " * See help/README.md for details.\n";
+print " */\n\n";
+print "#include \"RbHelpDatabase.h\"\n\n";
+print "using namespace RevBayesCore;\n\n";
+
+# print the tables
+print "const RbHelpDatabase::HelpField RbHelpDatabase::help_string_table[] = {\n";
+print @strings;
+print "};\n\n";
+print "const size_t RbHelpDatabase::help_string_table_size = sizeof(help_string_table) / sizeof(help_string_table[0]);\n\n";
+
+print "const RbHelpDatabase::HelpField RbHelpDatabase::help_array_table[] = {\n";
+print @arrays;
+print "};\n\n";
+print "const size_t RbHelpDatabase::help_array_table_size = sizeof(help_array_table) / sizeof(help_array_table[0]);\n\n";
+
+print "const RbHelpDatabase::HelpReference RbHelpDatabase::help_reference_table[] = {\n";
+print @references;
+print "};\n\n";
+print "const size_t RbHelpDatabase::help_reference_table_size = sizeof(help_reference_table) / sizeof(help_reference_table[0]);\n";
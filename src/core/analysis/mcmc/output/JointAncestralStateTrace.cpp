@@ -23,6 +23,34 @@
 
 using namespace RevBayesCore;
 
+namespace {
+
+    /**
+     * Add one sample of a coded state to the posterior and state vectors of a node.
+     * The positions vector remembers where each state code is stored, so that counting
+     * a sample does not need to compare any state labels.
+     */
+    void addStateSample(size_t code, const std::vector<std::string> &labels, std::vector<long> &positions, std::vector<double> &pp, std::vector<std::string> &states)
+    {
+        if ( code >= positions.size() )
+        {
+            positions.resize(code + 1, -1);
+        }
+        
+        if ( positions[code] == -1 )
+        {
+            positions[code] = pp.size();
+            pp.push_back(1.0);
+            states.push_back( labels[code] );
+        }
+        else
+        {
+            pp[ positions[code] ] += 1.0;
+        }
+    }
+
+}
+
 JointAncestralStateTrace::JointAncestralStateTrace(std::vector<AncestralStateTrace> at, TraceTree tt ) :
     ancestral_state_traces(at),
     tree_trace(tt),
@@ -30,6 +58,12 @@ JointAncestralStateTrace::JointAncestralStateTrace(std::vector<AncestralStateTra
 {
     num_sampled_states = ancestral_state_traces[0].size();
     
+    // build a lookup map for the ancestral state trace labels -> indices
+    for (size_t z = 0; z < ancestral_state_traces.size(); z++)
+    {
+        ancestral_state_traces_lookup[ ancestral_state_traces[z].getParameterName() ] = z;
+    }
+    
     if ( tree_trace.size() > 0 && num_sampled_states != tree_trace.size() )
     {
         throw RbException("The tree trace and the ancestral state trace must contain the same number of samples.");
@@ -61,6 +95,23 @@ void JointAncestralStateTrace::setBurnin(size_t b)
     burnin = b;
 }
 
+/**
+ * Find the index of the ancestral state trace with the given name.
+ * The index is only overwritten if such a trace exists.
+ */
+bool JointAncestralStateTrace::findTraceIndex(const std::string &name, size_t &index) const
+{
+    std::map<std::string, size_t>::const_iterator it = ancestral_state_traces_lookup.find( name );
+    if ( it == ancestral_state_traces_lookup.end() )
+    {
+        return false;
+    }
+    
+    index = it->second;
+    return true;
+}
+
+
 /**
  *
  * Helper function for ancestralStateTree() and cladoAncestralStateTree() that collects and sorts joint ancestral state samples.
@@ -85,7 +136,7 @@ void JointAncestralStateTrace::collectJointAncestralStateSamples(int site, Tree
  * Helper function for ancestralStateTree() and cladoAncestralStateTree() that traverses the tree from root to tips collecting ancestral state samples.
  *
  */
-void JointAncestralStateTrace::recursivelyCollectAncestralStateSamples(size_t node_index, std::string map_parent_state, bool root, bool conditional, int site, Tree &final_summary_tree, const std::vector<TopologyNode*> &summary_nodes, std::vector<std::vector<double> > &pp_end, std::vector<std::vector<double> > &pp_start, std::vector<double> &pp_clade, std::vector<std::vector<std::string> > &end_states, std::vector<std::vector<std::string> > &start_states, bool clado, ProgressBar &progress, size_t &num_finished_nodes, bool verbose)
+void JointAncestralStateTrace::recursivelyCollectAncestralStateSamples(size_t node_index, size_t map_parent_state, bool root, bool conditional, int site, Tree &final_summary_tree, const std::vector<TopologyNode*> &summary_nodes, std::vector<std::vector<double> > &pp_end, std::vector<std::vector<double> > &pp_start, std::vector<double> &pp_clade, std::vector<std::vector<std::string> > &end_states, std::vector<std::vector<std::string> > &start_states, bool clado, ProgressBar &progress, size_t &num_finished_nodes, bool verbose)
 {
     
     size_t parent_node_index = 0;
@@ -96,10 +147,10 @@ void JointAncestralStateTrace::recursivelyCollectAncestralStateSamples(size_t no
     
     size_t sample_clade_index = -1;
     size_t parent_sample_clade_index = -1;
-    AncestralStateTrace* ancestral_state_trace_end_state = NULL;
-    AncestralStateTrace* ancestral_state_trace_start_1 = NULL;
-    AncestralStateTrace* ancestral_state_trace_start_2 = NULL;
-    AncestralStateTrace* parent_ancestral_state_trace = NULL;
+    size_t ancestral_state_trace_end_state = -1;
+    size_t ancestral_state_trace_start_1 = -1;
+    size_t ancestral_state_trace_start_2 = -1;
+    size_t parent_ancestral_state_trace = -1;
     bool trace_found_end_state = false;
     bool trace_found_start_1 = false;
     bool trace_found_start_2 = false;
@@ -109,15 +160,10 @@ void JointAncestralStateTrace::recursivelyCollectAncestralStateSamples(size_t no
     size_t num_samples_start_2 = 0;
     size_t num_samples_clade = 0;
     
-    std::vector<TopologyNode*> sn = summary_nodes;
-    
-    
-    // build a lookup map for the ancestral state trace labels -> indices
-    std::map<std::string, size_t> ancestral_state_traces_lookup;
-    for (size_t z = 0; z < ancestral_state_traces.size(); z++)
-    {
-        ancestral_state_traces_lookup[ ancestral_state_traces[z].getParameterName() ] = z;
-    }
+    // the position of each state code in the pp and states vectors of this node and of its children
+    std::vector<long> end_state_positions;
+    std::vector<long> start_state_1_positions;
+    std::vector<long> start_state_2_positions;
     
     // loop through all the ancestral state samples
     for (size_t j = burnin; j < num_sampled_states; ++j)
@@ -128,7 +174,8 @@ void JointAncestralStateTrace::recursivelyCollectAncestralStateSamples(size_t no
         }
         
         // if necessary, get the sampled tree from the tree trace
-        const Tree &sample_tree = usingTreeTrace() ? tree_trace.objectAt( j ) : final_summary_tree;
+        std::shared_ptr<const Tree> trace_tree = usingTreeTrace() ? tree_trace.treeAt( j ) : NULL;
+        const Tree &sample_tree = usingTreeTrace() ? *trace_tree : final_summary_tree;
         const TopologyNode& sample_root = sample_tree.getRoot();
         
          bool parent_sample_clade_found = true;
@@ -177,7 +224,13 @@ void JointAncestralStateTrace::recursivelyCollectAncestralStateSamples(size_t no
         bool found_child_clade_1 = true;
         bool found_child_clade_2 = true;
         
-        if ( !summary_nodes[node_index]->isTip() && clado == true )
+        if ( !summary_nodes[node_index]->isTip() && clado == true && usingTreeTrace() == false )
+        {
+            // the sampled node is the summary node itself
+            sample_clade_index_child_1 = summary_nodes[node_index]->getChild(0).getIndex();
+            sample_clade_index_child_2 = summary_nodes[node_index]->getChild(1).getIndex();
+        }
+        else if ( !summary_nodes[node_index]->isTip() && clado == true )
         {
             const TopologyNode& sample_node = sample_tree.getNode( sample_clade_index );
             try
@@ -198,22 +251,10 @@ void JointAncestralStateTrace::recursivelyCollectAncestralStateSamples(size_t no
             }
         }
         
-        std::string sample_clade_index_anc_str = StringUtilities::toString(sample_clade_index + 1);
-        std::string sample_clade_index_end_str = "end_" + StringUtilities::toString(sample_clade_index + 1);
-        std::string sample_clade_index_child_1_start_str = "start_" + StringUtilities::toString(sample_clade_index_child_1 + 1);
-        std::string sample_clade_index_child_2_start_str = "start_" + StringUtilities::toString(sample_clade_index_child_2 + 1);
-        
         // find the appropriate end state
-        if (ancestral_state_traces_lookup.find(sample_clade_index_anc_str) != ancestral_state_traces_lookup.end())
-        {
-            size_t idx = ancestral_state_traces_lookup[sample_clade_index_anc_str];
-            ancestral_state_trace_end_state = &ancestral_state_traces[idx];
-            trace_found_end_state = true;
-        }
-        else if (ancestral_state_traces_lookup.find(sample_clade_index_end_str) != ancestral_state_traces_lookup.end())
+        if ( findTraceIndex( StringUtilities::toString(sample_clade_index + 1), ancestral_state_trace_end_state ) == true ||
+             findTraceIndex( "end_" + StringUtilities::toString(sample_clade_index + 1), ancestral_state_trace_end_state ) == true )
         {
-            size_t idx = ancestral_state_traces_lookup[sample_clade_index_end_str];
-            ancestral_state_trace_end_state = &ancestral_state_traces[idx];
             trace_found_end_state = true;
         }
         
@@ -221,17 +262,13 @@ void JointAncestralStateTrace::recursivelyCollectAncestralStateSamples(size_t no
         if ( clado == true && (!summary_nodes[node_index]->isTip()) )
         {
             
-            if (ancestral_state_traces_lookup.find(sample_clade_index_child_1_start_str) != ancestral_state_traces_lookup.end() && found_child_clade_1 == true )
+            if ( found_child_clade_1 == true && findTraceIndex( "start_" + StringUtilities::toString(sample_clade_index_child_1 + 1), ancestral_state_trace_start_1 ) == true )
             {
-                size_t idx = ancestral_state_traces_lookup[sample_clade_index_child_1_start_str];
-                ancestral_state_trace_start_1 = &ancestral_state_traces[idx];
                 trace_found_start_1 = true;
             }
             
-            if (ancestral_state_traces_lookup.find(sample_clade_index_child_2_start_str) != ancestral_state_traces_lookup.end() && found_child_clade_2 == true )
+            if ( found_child_clade_2 == true && findTraceIndex( "start_" + StringUtilities::toString(sample_clade_index_child_2 + 1), ancestral_state_trace_start_2 ) == true )
             {
-                size_t idx = ancestral_state_traces_lookup[sample_clade_index_child_2_start_str];
-                ancestral_state_trace_start_2 = &ancestral_state_traces[idx];
                 trace_found_start_2 = true;
             }
         }
@@ -244,42 +281,27 @@ void JointAncestralStateTrace::recursivelyCollectAncestralStateSamples(size_t no
         // if we are conditioning on the parent's state we must get the corresponding sample from the parent
         if ( conditional == true && root == false && parent_trace_found == false && parent_sample_clade_found == true )
         {
-            for (size_t k = 0; k < ancestral_state_traces.size(); ++k)
+            // the parent trace comes either from an anagenetic-only process or from a cladogenetic process
+            if ( findTraceIndex( StringUtilities::toString(parent_sample_clade_index + 1), parent_ancestral_state_trace ) == true ||
+                 findTraceIndex( "end_" + StringUtilities::toString(parent_sample_clade_index + 1), parent_ancestral_state_trace ) == true )
             {
-                // if we have an ancestral state trace from an anagenetic-only process
-                if (ancestral_state_traces[k].getParameterName() == StringUtilities::toString(parent_sample_clade_index + 1))
-                {
-                    parent_ancestral_state_trace = &ancestral_state_traces[k];
-                    parent_trace_found = true;
-                    break;
-                }
-                // if we have an ancestral state trace from a cladogenetic process
-                if (ancestral_state_traces[k].getParameterName() == "end_" + StringUtilities::toString(parent_sample_clade_index + 1))
-                {
-                    parent_ancestral_state_trace = &ancestral_state_traces[k];
-                    parent_trace_found = true;
-                    break;
-                }
+                parent_trace_found = true;
             }
         }
         
         // get the sampled ancestral state for this iteration
-        const std::vector<std::string>& ancestral_state_vector_end = ancestral_state_trace_end_state->getValues();
-        std::string ancestral_state_end = getSiteState( ancestral_state_vector_end[j], site );
+        if ( ancestral_state_trace_end_state >= ancestral_state_traces.size() )
+        {
+            throw RbException() << "Can't find the ancestral state trace for node '" << (sample_clade_index + 1) << "'.";
+        }
+        size_t ancestral_state_end = getSiteStateCodes( ancestral_state_trace_end_state, site )[j];
         
         // get the sampled ancestral state from the parent node
         bool count_sample = false;
-        std::string sampled_parent_state = "";
         if ( conditional == true && root == false && parent_trace_found == true )
         {
-            if (not parent_ancestral_state_trace)
-                throw RbException("Can't find parent_ancestral_state_trace");
-
-            const std::vector<std::string>& parent_ancestral_state_vector = parent_ancestral_state_trace->getValues();
-            sampled_parent_state = getSiteState( parent_ancestral_state_vector[j], site );
-            
             // condition on the parent state?
-            if ( sampled_parent_state == map_parent_state )
+            if ( getSiteStateCodes( parent_ancestral_state_trace, site )[j] == map_parent_state )
             {
                 count_sample = true;
             }
@@ -293,117 +315,20 @@ void JointAncestralStateTrace::recursivelyCollectAncestralStateSamples(size_t no
         // finally add the sample to our vectors of samples
         if ( count_sample == true )
         {
-            if ( clado == true && summary_nodes[node_index]->isTip() == false )
+            addStateSample( ancestral_state_end, site_state_labels, end_state_positions, pp_end[node_index], end_states[node_index] );
+            
+            if ( clado == true && summary_nodes[node_index]->isTip() == false && trace_found_start_1 && trace_found_start_2 )
             {
-                std::string ancestral_state_start_1 = "";
-                std::string ancestral_state_start_2 = "";
                 size_t child1 = summary_nodes[node_index]->getChild(0).getIndex();
                 size_t child2 = summary_nodes[node_index]->getChild(1).getIndex();
                 
-                // find & store end states
-                bool end_state_found = false;
-                size_t k_end = 0;
-                for (; k_end < pp_end[node_index].size(); k_end++)
-                {
-                    if (end_states[node_index][k_end] == ancestral_state_end) {
-                        end_state_found = true;
-                        break;
-                    }
-                }
-                // update the end pp and states vectors
-                if ( end_state_found == false )
-                {
-                    pp_end[node_index].push_back(1.0);
-                    end_states[node_index].push_back( ancestral_state_end );
-                    
-                }
-                else
-                {
-                    pp_end[node_index][k_end] += 1.0;
-                }
+                size_t ancestral_state_start_1 = getSiteStateCodes( ancestral_state_trace_start_1, site )[j];
+                addStateSample( ancestral_state_start_1, site_state_labels, start_state_1_positions, pp_start[child1], start_states[child1] );
+                num_samples_start_1 += 1;
                 
-                // find & store start_state_1
-                if (trace_found_start_1 && trace_found_start_2)
-                {
-                    std::vector<std::string> ancestral_state_trace_start_1_vector = ancestral_state_trace_start_1->getValues();
-                    ancestral_state_start_1 = getSiteState( ancestral_state_trace_start_1_vector[j], site );
-                    
-                    bool start_state_1_found = false;
-                    size_t k_start_1 = 0;
-                    for (; k_start_1 < pp_start[child1].size(); k_start_1++)
-                    {
-                        if (start_states[child1][k_start_1] == ancestral_state_start_1) {
-                            start_state_1_found = true;
-                            break;
-                        }
-                    }
-                    // update the end pp and states vectors
-                    if ( start_state_1_found == false )
-                    {
-                        pp_start[child1].push_back(1.0);
-                        start_states[child1].push_back( ancestral_state_start_1 );
-                        
-                    }
-                    else
-                    {
-                        pp_start[child1][k_start_1] += 1.0;
-                    }
-                    
-                    num_samples_start_1 += 1;
-                    //                    }
-                    //
-                    //                    // find & store start_state_1
-                    //                    if (trace_found_start_2)
-                    //                    {
-                    std::vector<std::string> ancestral_state_trace_start_2_vector = ancestral_state_trace_start_2->getValues();
-                    ancestral_state_start_2 = getSiteState( ancestral_state_trace_start_2_vector[j], site );
-                    
-                    bool start_state_2_found = false;
-                    size_t k_start_2 = 0;
-                    for (; k_start_2 < pp_start[child2].size(); k_start_2++)
-                    {
-                        if (start_states[child2][k_start_2] == ancestral_state_start_2) {
-                            start_state_2_found = true;
-                            break;
-                        }
-                    }
-                    // update the end pp and states vectors
-                    if ( start_state_2_found == false )
-                    {
-                        pp_start[child2].push_back(1.0);
-                        start_states[child2].push_back( ancestral_state_start_2 );
-                        
-                    }
-                    else
-                    {
-                        pp_start[child2][k_start_2] += 1.0;
-                    }
-                    
-                    num_samples_start_2 += 1;
-                }
-            }
-            else
-            {
-                bool state_found = false;
-                size_t k = 0;
-                for (; k < pp_end[node_index].size(); k++)
-                {
-                    if ( end_states[node_index][k] == ancestral_state_end )
-                    {
-                        state_found = true;
-                        break;
-                    }
-                }
-                // update the pp and states vectors
-                if ( state_found == false )
-                {
-                    pp_end[node_index].push_back(1.0);
-                    end_states[node_index].push_back(ancestral_state_end);
-                }
-                else
-                {
-                    pp_end[node_index][k] += 1.0;
-                }
+                size_t ancestral_state_start_2 = getSiteStateCodes( ancestral_state_trace_start_2, site )[j];
+                addStateSample( ancestral_state_start_2, site_state_labels, start_state_2_positions, pp_start[child2], start_states[child2] );
+                num_samples_start_2 += 1;
             }
             num_samples_end += 1;
         }
@@ -429,7 +354,7 @@ void JointAncestralStateTrace::recursivelyCollectAncestralStateSamples(size_t no
     
     pp_clade[node_index] = (double)num_samples_clade / (num_sampled_states - burnin);
     
-    std::string map_state = "";
+    size_t map_state = -1;
     double max_pp = 0.0;
     if ( conditional == true )
     {
@@ -438,7 +363,7 @@ void JointAncestralStateTrace::recursivelyCollectAncestralStateSamples(size_t no
         {
             if (pp_end[node_index][i] > max_pp)
             {
-                map_state = end_states[node_index][i];
+                map_state = site_state_label_codes[ end_states[node_index][i] ];
                 max_pp = pp_end[node_index][i];
             }
         }
@@ -511,7 +436,9 @@ Tree* JointAncestralStateTrace::ancestralStateTree(const Tree &input_summary_tre
     {
         // recurse through summary tree and collect ancestral state samples
         size_t node_index = final_summary_tree->getRoot().getIndex();
-        recursivelyCollectAncestralStateSamples(node_index, "", true, conditional, site, *final_summary_tree, summary_nodes, pp_end, pp_start, pp_clade, states, states, false, progress, num_finished_nodes, verbose);
+        resetSiteStateCodes();
+        recursivelyCollectAncestralStateSamples(node_index, -1, true, conditional, site, *final_summary_tree, summary_nodes, pp_end, pp_start, pp_clade, states, states, false, progress, num_finished_nodes, verbose);
+        resetSiteStateCodes();
     }
     
     if ( verbose == true )
@@ -692,7 +619,9 @@ Tree* JointAncestralStateTrace::cladoAncestralStateTree(const Tree &input_summar
     {
         // recurse through summary tree and collect ancestral state samples
         size_t node_index = final_summary_tree->getRoot().getIndex();
-        recursivelyCollectAncestralStateSamples(node_index, "", true, conditional, site, *final_summary_tree, summary_nodes, pp_end, pp_start, pp_clade, end_states, start_states, true, progress, num_finished_nodes, verbose);
+        resetSiteStateCodes();
+        recursivelyCollectAncestralStateSamples(node_index, -1, true, conditional, site, *final_summary_tree, summary_nodes, pp_end, pp_start, pp_clade, end_states, start_states, true, progress, num_finished_nodes, verbose);
+        resetSiteStateCodes();
     }
     
     if ( verbose == true )
@@ -958,7 +887,8 @@ void JointAncestralStateTrace::recursivelyCollectCharacterMapSamples(size_t node
         }
         
         // if necessary, get the sampled tree from the tree trace
-        const Tree &sample_tree = (usingTreeTrace()) ? tree_trace.objectAt( j ) : final_summary_tree;
+        std::shared_ptr<const Tree> trace_tree = (usingTreeTrace()) ? tree_trace.treeAt( j ) : NULL;
+        const Tree &sample_tree = (usingTreeTrace()) ? *trace_tree : final_summary_tree;
         const TopologyNode& sample_root = sample_tree.getRoot();
         
         try
@@ -1453,7 +1383,8 @@ void JointAncestralStateTrace::summarizeCharacterMaps(Tree input_tree, const pat
             }
             
             // if necessary, get the sampled tree from the tree trace
-            const Tree &sample_tree = (usingTreeTrace()) ? tree_trace.objectAt( j ) : input_tree;
+            std::shared_ptr<const Tree> trace_tree = (usingTreeTrace()) ? tree_trace.treeAt( j ) : NULL;
+            const Tree &sample_tree = (usingTreeTrace()) ? *trace_tree : input_tree;
             
             try
             {
@@ -1778,3 +1709,58 @@ std::string JointAncestralStateTrace::getSiteState( const std::string &site_samp
     }
     return states[site];
 }
+
+
+/**
+ * Get the sampled states of one site for an ancestral state trace as indices into site_state_labels.
+ * Each trace is parsed only once, the first time it is needed, and each distinct sample string is only
+ * split once. The codes are kept until resetSiteStateCodes() is called.
+ */
+const std::vector<unsigned int>& JointAncestralStateTrace::getSiteStateCodes( size_t trace_index, size_t site )
+{
+    std::vector<unsigned int>& codes = site_state_codes[trace_index];
+    if ( codes.size() == num_sampled_states )
+    {
+        return codes;
+    }
+    
+    const std::vector<std::string>& samples = ancestral_state_traces[trace_index].getValues();
+    codes.resize( num_sampled_states );
+    
+    std::map<std::string, unsigned int> sample_codes;
+    for (size_t j = 0; j < num_sampled_states; ++j)
+    {
+        std::map<std::string, unsigned int>::const_iterator it = sample_codes.find( samples[j] );
+        if ( it == sample_codes.end() )
+        {
+            std::string state = getSiteState( samples[j], site );
+            std::map<std::string, unsigned int>::const_iterator it_label = site_state_label_codes.find( state );
+            unsigned int code;
+            if ( it_label == site_state_label_codes.end() )
+            {
+                code = (unsigned int)site_state_labels.size();
+                site_state_label_codes[state] = code;
+                site_state_labels.push_back( state );
+            }
+            else
+            {
+                code = it_label->second;
+            }
+            it = sample_codes.insert( std::pair<std::string, unsigned int>(samples[j], code) ).first;
+        }
+        codes[j] = it->second;
+    }
+    
+    return codes;
+}
+
+
+/**
+ * Free the coded site states, e.g. before summarizing another site.
+ */
+void JointAncestralStateTrace::resetSiteStateCodes( void )
+{
+    site_state_labels.clear();
+    site_state_label_codes.clear();
+    site_state_codes = std::vector<std::vector<unsigned int> >( ancestral_state_traces.size() );
+}
@@ -3,6 +3,8 @@
 
 #include <stddef.h>
 #include <iosfwd>
+#include <map>
+#include <string>
 #include <utility>
 #include <vector>
 
@@ -35,7 +37,10 @@ class Tree;
 
         void                                        collectJointAncestralStateSamples(int site, Tree &final_summary_tree, const std::vector<TopologyNode*> &summary_nodes, std::vector<std::vector<double> > &pp_end, std::vector<std::vector<double> > &pp_start, std::vector<std::vector<std::string> > &end_states, std::vector<std::vector<std::string> > &start_states, bool clado, ProgressBar &progress, bool verbose);
         std::string                                 getSiteState( const std::string &site_sample, size_t site );
-        void                                        recursivelyCollectAncestralStateSamples(size_t node_index, std::string map_parent_state, bool root, bool conditional, int site, Tree &final_summary_tree, const std::vector<TopologyNode*> &summary_nodes, std::vector<std::vector<double> > &pp_end, std::vector<std::vector<double> > &pp_start, std::vector<double> &pp_clade, std::vector<std::vector<std::string> > &end_states, std::vector<std::vector<std::string> > &start_states, bool clado, ProgressBar &progress, size_t &num_finished_nodes, bool verbose);
+        const std::vector<unsigned int>&            getSiteStateCodes( size_t trace_index, size_t site );
+        bool                                        findTraceIndex( const std::string &name, size_t &index ) const;
+        void                                        resetSiteStateCodes( void );
+        void                                        recursivelyCollectAncestralStateSamples(size_t node_index, size_t map_parent_state, bool root, bool conditional, int site, Tree &final_summary_tree, const std::vector<TopologyNode*> &summary_nodes, std::vector<std::vector<double> > &pp_end, std::vector<std::vector<double> > &pp_start, std::vector<double> &pp_clade, std::vector<std::vector<std::string> > &end_states, std::vector<std::vector<std::string> > &start_states, bool clado, ProgressBar &progress, size_t &num_finished_nodes, bool verbose);
         void                                        recursivelyCollectCharacterMapSamples(size_t node_index, size_t map_parent_state, bool root, bool conditional, Tree &final_summary_tree, const std::vector<TopologyNode*> &summary_nodes, std::vector<std::string> &map_character_history, std::vector<std::string> &map_character_history_posteriors, std::vector<std::string> &map_character_history_shift_prob, ProgressBar &progress, size_t &num_finished_nodes, int NUM_TIME_SLICES, bool verbose);
         void                                        computeMarginalCladogeneticStateProbs(std::vector<double> pp, std::vector<std::string> states, std::vector<double>& best_pp, std::vector<std::string>& best_states);
 
@@ -44,7 +49,13 @@ class Tree;
         bool                                        usingTreeTrace(void) const { return tree_trace.size() > 0; };
 
         std::vector<AncestralStateTrace>            ancestral_state_traces;
+        std::map<std::string, size_t>               ancestral_state_traces_lookup;
         size_t                                      num_sampled_states;
+
+        // the sampled states of one site, coded as indices into a shared dictionary of state labels
+        std::vector<std::string>                    site_state_labels;
+        std::map<std::string, unsigned int>         site_state_label_codes;
+        std::vector<std::vector<unsigned int> >     site_state_codes;
         TraceTree                                   tree_trace;
 
         size_t                                      burnin;
@@ -34,8 +34,8 @@ namespace RevBayesCore {
         virtual void                    addValueFromString(const std::string &s);
         virtual Trace*                  clone(void) const;                              //!< Clone object
 
-        const valueType&                objectAt(size_t index, bool post = false) const { return post ? values.at(index + burnin) : values.at(index); }
-        long                            size(bool post = false) const                   { return post ? values.size() - burnin : values.size(); }
+        virtual const valueType&        objectAt(size_t index, bool post = false) const { return post ? values.at(index + burnin) : values.at(index); }
+        virtual long                    size(bool post = false) const                   { return post ? values.size() - burnin : values.size(); }
 
         virtual void                    addObject(const valueType& d);
         virtual void                    addObject(valueType&& d);
@@ -43,15 +43,15 @@ namespace RevBayesCore {
         virtual int                     isCoveredInInterval(const std::string &v, double i, bool verbose);
         bool                            isDirty(void) const                             { return dirty; };
         void                            setDirty(bool d)                                { dirty = d; };
-        void                            removeLastObject();
-        void                            removeObjectAtIndex(int index);
+        virtual void                    removeLastObject();
+        virtual void                    removeObjectAtIndex(int index);
         
         // getters and setters
         size_t                          getBurnin() const                               { return burnin; }
-        const std::vector<valueType>&   getValues() const                               { return values; }
+        virtual const std::vector<valueType>&   getValues() const                       { return values; }
 
         virtual void                    setBurnin(long b);
-        void                            setValues(std::vector<valueType> v)             { values = v; }
+        virtual void                    setValues(std::vector<valueType> v)             { values = v; }
         
 
         // getters and setters
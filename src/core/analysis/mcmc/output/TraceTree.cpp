@@ -6,7 +6,8 @@ using namespace RevBayesCore;
 /*
  * TraceTree constructor
  */
-TraceTree::TraceTree( bool c ) : TreeSummary(this, c)
+TraceTree::TraceTree( bool c, bool cmp ) : TreeSummary(this, c),
+    compact( cmp )
 {
 }
 
@@ -23,6 +24,53 @@ TraceTree::TraceTree(const TraceTree& t ) : TreeSummary(this, t.isClock())
 }
 
 
+void TraceTree::addObject(const Tree& t)
+{
+    if ( compact == true )
+    {
+        topologies.addTree( t );
+        materialized_values.clear();
+        materialized_trees.resize( topologies.size() );
+        dirty = true;
+    }
+    else
+    {
+        Trace<Tree>::addObject( t );
+    }
+}
+
+
+void TraceTree::addObject(Tree&& t)
+{
+    if ( compact == true )
+    {
+        addObject( static_cast<const Tree&>( t ) );
+    }
+    else
+    {
+        Trace<Tree>::addObject( std::move(t) );
+    }
+}
+
+
+void TraceTree::addObject(Tree* t)
+{
+    addObject( static_cast<const Tree&>( *t ) );
+    delete t;
+}
+
+
+/**
+ * Forget the trees we created from the store, e.g., because the indices of the samples changed.
+ */
+void TraceTree::clearMaterializedTrees( void )
+{
+    materialized_trees.clear();
+    materialized_trees.resize( topologies.size() );
+    materialized_values.clear();
+}
+
+
 /**
  * The clone function is a convenience function to create proper copies of inherited objected.
  * E.g. a.clone() will create a clone of the correct type even if 'a' is of derived type 'b'.
@@ -35,3 +83,174 @@ TraceTree* TraceTree::clone(void) const
     
     return new TraceTree(*this);
 }
+
+
+/**
+ * Get all trees. A compact trace needs to create all trees for this,
+ * so callers that look at one tree after the other should use objectAt instead.
+ */
+const std::vector<Tree>& TraceTree::getValues(void) const
+{
+    if ( compact == false )
+    {
+        return Trace<Tree>::getValues();
+    }
+
+    if ( materialized_values.size() != topologies.size() )
+    {
+        materialized_values.clear();
+        materialized_values.reserve( topologies.size() );
+        for (size_t i = 0; i < topologies.size(); ++i)
+        {
+            Tree *t = topologies.getTree( i );
+            materialized_values.push_back( std::move( *t ) );
+            delete t;
+        }
+    }
+
+    return materialized_values;
+}
+
+
+/**
+ * Get the tree with the given index.
+ * A compact trace creates the tree from its store the first time it is requested and keeps it,
+ * so that the returned reference stays valid until the trace is changed.
+ */
+const Tree& TraceTree::objectAt(size_t index, bool post) const
+{
+    if ( compact == false )
+    {
+        return Trace<Tree>::objectAt( index, post );
+    }
+
+    if ( post == true )
+    {
+        index += burnin;
+    }
+
+    if ( materialized_values.size() == topologies.size() )
+    {
+        return materialized_values[index];
+    }
+
+    std::shared_ptr<const Tree> &tree = materialized_trees.at( index );
+    if ( tree == NULL )
+    {
+        tree = std::shared_ptr<const Tree>( topologies.getTree( index ) );
+    }
+
+    return *tree;
+}
+
+
+/**
+ * Remove the last tree.
+ */
+void TraceTree::removeLastObject( void )
+{
+    if ( compact == false )
+    {
+        Trace<Tree>::removeLastObject();
+        return;
+    }
+
+    topologies.removeLastTree();
+    clearMaterializedTrees();
+    dirty = true;
+}
+
+
+/**
+ * Remove the tree with the given index.
+ * The compact store can only remove its last tree, so we take out the later trees and add them again.
+ */
+void TraceTree::removeObjectAtIndex(int index)
+{
+    if ( compact == false )
+    {
+        Trace<Tree>::removeObjectAtIndex( index );
+        return;
+    }
+
+    std::vector< std::unique_ptr<Tree> > later_trees;
+    while ( topologies.size() > size_t(index) + 1 )
+    {
+        later_trees.push_back( std::unique_ptr<Tree>( topologies.getTree( topologies.size() - 1 ) ) );
+        topologies.removeLastTree();
+    }
+    topologies.removeLastTree();
+
+    for (std::vector< std::unique_ptr<Tree> >::reverse_iterator it = later_trees.rbegin(); it != later_trees.rend(); ++it)
+    {
+        topologies.addTree( **it );
+    }
+
+    clearMaterializedTrees();
+    dirty = true;
+}
+
+
+/**
+ * Replace all trees.
+ */
+void TraceTree::setValues(std::vector<Tree> v)
+{
+    if ( compact == false )
+    {
+        Trace<Tree>::setValues( v );
+        return;
+    }
+
+    topologies.clear();
+    for (size_t i = 0; i < v.size(); ++i)
+    {
+        topologies.addTree( v[i] );
+    }
+
+    clearMaterializedTrees();
+    dirty = true;
+}
+
+
+long TraceTree::size(bool post) const
+{
+    if ( compact == false )
+    {
+        return Trace<Tree>::size( post );
+    }
+
+    return post ? topologies.size() - burnin : topologies.size();
+}
+
+
+/**
+ * Get the tree with the given index, shared with the caller.
+ * A compact trace creates the tree from its store without keeping it, unless objectAt already did,
+ * so that looping through the samples does not create all trees at once.
+ */
+std::shared_ptr<const Tree> TraceTree::treeAt(size_t index, bool post) const
+{
+    if ( compact == false )
+    {
+        // the trace owns the tree, so we only refer to it
+        return std::shared_ptr<const Tree>( std::shared_ptr<const Tree>(), &Trace<Tree>::objectAt( index, post ) );
+    }
+
+    if ( post == true )
+    {
+        index += burnin;
+    }
+
+    if ( materialized_values.size() == topologies.size() )
+    {
+        return std::shared_ptr<const Tree>( std::shared_ptr<const Tree>(), &materialized_values[index] );
+    }
+
+    if ( materialized_trees.at( index ) != NULL )
+    {
+        return materialized_trees[index];
+    }
+
+    return std::shared_ptr<const Tree>( topologies.getTree( index ) );
+}
@@ -1,13 +1,25 @@
 #ifndef TraceTree_H
 #define TraceTree_H
 
+#include <memory>
+#include <vector>
+
 #include "Clade.h"
+#include "CompactTopologyStore.h"
 #include "Trace.h"
 #include "Tree.h"
 #include "TreeSummary.h"
 
 namespace RevBayesCore {
 
+    /**
+     * A trace of trees.
+     *
+     * A compact trace keeps its samples in a CompactTopologyStore instead of as Tree objects.
+     * The trees are then only created when they are accessed. The trees returned by objectAt are kept,
+     * so that the references stay valid as long as the trace is not changed. Callers that loop through
+     * the samples should use treeAt instead, which does not keep the trees of a compact trace.
+     */
     class TraceTree : public Trace<Tree>, public TreeSummary {
 
         public:
@@ -15,16 +27,36 @@ namespace RevBayesCore {
         /*
          * Declaration of the TreeTrace class
          */
-        TraceTree( bool c = true );
+        TraceTree( bool c = true, bool compact = false );
         TraceTree(const TraceTree& t );
         virtual ~TraceTree(){}
 
         TraceTree*                                 clone(void) const;
 
+        void                                       addObject(const Tree& d);
+        void                                       addObject(Tree&& d);
+        void                                       addObject(Tree* d);
+        const std::vector<Tree>&                   getValues() const;
         int                                        isCoveredInInterval(const std::string &v, double size, bool verbose){ return (TreeSummary::isCoveredInInterval(v,size,verbose) ? 0 : -1); };
         int                                        isCoveredInInterval(const Tree &t, double size, bool verbose){ return (TreeSummary::isCoveredInInterval(t,size,verbose) ? 0 : -1); };
+        bool                                       isCompact(void) const { return compact; };
         bool                                       isDirty(void) const { return Trace<Tree>::isDirty(); };
+        const Tree&                                objectAt(size_t index, bool post = false) const;
+        void                                       removeLastObject(void);
+        void                                       removeObjectAtIndex(int index);
         void                                       setDirty(bool d) { Trace<Tree>::setDirty(d); };
+        void                                       setValues(std::vector<Tree> v);
+        long                                       size(bool post = false) const;
+        std::shared_ptr<const Tree>                treeAt(size_t index, bool post = false) const;
+
+        private:
+
+        void                                       clearMaterializedTrees(void);
+
+        bool                                       compact;
+        CompactTopologyStore                       topologies;                                  //!< the samples of a compact trace
+        mutable std::vector< std::shared_ptr<const Tree> > materialized_trees;                  //!< the trees of a compact trace returned by objectAt
+        mutable std::vector<Tree>                  materialized_values;                         //!< all trees of a compact trace, if they were requested
     };
 
 }
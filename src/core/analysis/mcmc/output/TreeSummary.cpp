@@ -195,7 +195,8 @@ void TreeSummary::mapDiscrete(Tree &tree, const std::string &n, size_t paramInde
         // loop through all trees in tree trace
         for (size_t iteration = (*trace)->getBurnin(); iteration < (*trace)->size(); ++iteration)
         {
-            const Tree &sample_tree = (*trace)->objectAt( iteration );
+            std::shared_ptr<const Tree> trace_tree = (*trace)->treeAt( iteration );
+            const Tree &sample_tree = *trace_tree;
             const TopologyNode& sample_root = sample_tree.getRoot();
 
             // loop through all nodes in inputTree
@@ -416,7 +417,8 @@ void TreeSummary::mapContinuous(Tree &tree, const std::string &n, size_t paramIn
                 count++;
             }
 
-            const Tree &sample_tree = (*trace)->objectAt( i );
+            std::shared_ptr<const Tree> trace_tree = (*trace)->treeAt( i );
+            const Tree &sample_tree = *trace_tree;
             const TopologyNode& sample_root = sample_tree.getRoot();
 
             // create a map from newick strings to clade indices
@@ -1123,8 +1125,7 @@ std::vector<double> TreeSummary::computeTreeLengths( void )
         for (size_t i = (*trace)->getBurnin(); i < (*trace)->size(); ++i)
         {
 
-            const Tree &tree = (*trace)->objectAt(i);
-            tree_lengths.push_back( tree.getTreeLength() );
+            tree_lengths.push_back( (*trace)->treeAt(i)->getTreeLength() );
 
         }
     }
@@ -1941,7 +1942,7 @@ void TreeSummary::summarize( bool verbose )
                 count++;
             }
 
-            Tree tree = (*trace)->objectAt(i);
+            Tree tree = *(*trace)->treeAt(i);
 
             if ( rooted == false )
             {
@@ -99,19 +99,40 @@ TransitionProbabilityMatrix& TransitionProbabilityMatrix::operator=( TransitionP
 }
 
 
+/**
+ * Multiply this matrix with B and store the result in C.
+ * We accumulate whole rows of B, such that all rows are traversed contiguously, and we skip the zero entries of this matrix.
+ * Generators of the population-genetic models are very sparse, so products with their scaled versions come almost for free.
+ */
 void TransitionProbabilityMatrix::multiplyTo(const TransitionProbabilityMatrix& B, TransitionProbabilityMatrix& C) const
 {
     assert(B.getNumberOfStates() == num_states);
     assert(C.getNumberOfStates() == num_states);
+    assert(&C != this && &C != &B);
 
     for (size_t i=0; i<num_states; i++)
     {
+        const double* a_i = (*this)[i];
+        double*       c_i = C[i];
+
         for (size_t j=0; j<num_states; j++)
         {
-            double sum = 0.0;
-            for (size_t k=0; k<num_states; k++)
-                sum += (*this)[i][k] * B[k][j];
-            C[i][j] = sum;
+            c_i[j] = 0.0;
+        }
+
+        for (size_t k=0; k<num_states; k++)
+        {
+            double a_ik = a_i[k];
+            if ( a_ik == 0.0 )
+            {
+                continue;
+            }
+
+            const double* b_k = B[k];
+            for (size_t j=0; j<num_states; j++)
+            {
+                c_i[j] += a_ik * b_k[j];
+            }
         }
     }
 }
@@ -51,6 +51,9 @@ namespace RevBayesCore {
         virtual double                                              getPercentageMissing(void) const = 0;                               //!< Returns the percentage of missing data for this sequence
         virtual std::string                                         getStateLabels(void) = 0;                                           //!< Get the possible state labels
         virtual bool                                                isCharacterResolved(size_t idx) const = 0;                          //!< Returns whether the character is fully resolved (e.g., "A" or "1.32") or not (e.g., "AC" or "?")
+        virtual void                                                setCharacter(size_t index, const DiscreteCharacterState &c) = 0;    //!< Replace the character at position index
+        virtual void                                                setGapState(size_t index, bool tf) = 0;                             //!< Set whether the character at position index is a gap
+        virtual void                                                setMissingState(size_t index, bool tf) = 0;                         //!< Set whether the character at position index is missing
         
     protected:
         AbstractDiscreteTaxonData(const Taxon &t);                                                                                 //!< Default constructor
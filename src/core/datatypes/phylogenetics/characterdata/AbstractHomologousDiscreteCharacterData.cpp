@@ -30,14 +30,13 @@ void AbstractHomologousDiscreteCharacterData::applyMissingSitesMask( const std::
 
         for ( size_t site=0; site<num_sites; ++site)
         {
-            DiscreteCharacterState &c = taxon.getCharacter(site);
             if ( mask_gap[i][site] == true )
             {
-                c.setGapState( true );
+                taxon.setGapState( site, true );
             }
             if ( mask_missing[i][site] == true )
             {
-                c.setMissingState( true );
+                taxon.setMissingState( site, true );
             }
         }
 
@@ -93,11 +92,10 @@ void AbstractHomologousDiscreteCharacterData::removeRandomSites( double p )
 
         for ( size_t site=0; site<num_sites; ++site)
         {
-            DiscreteCharacterState &c = taxon.getCharacter(site);
             if ( p > rng->uniform01() )
             {
-                c.setGapState( true );
-                c.setMissingState( true );
+                taxon.setGapState( site, true );
+                taxon.setMissingState( site, true );
             }
             
         }
@@ -6,11 +6,50 @@
 #include "RbOptions.h"
 
 
+#include <deque>
+#include <map>
 #include <string>
 #include <vector>
 
 namespace RevBayesCore {
 
+    class DnaState;
+    class RnaState;
+    
+    /**
+     * Can characters of this type be shared between the sites of a DiscreteTaxonData object?
+     *
+     * We can only share characters whose value is fully described by their string value,
+     * which is the case for nucleotides. Characters of all other types get one entry per site.
+     */
+    template<class charType>
+    struct SharedCharacterStates {
+        static const bool                               value = false;
+    };
+    
+    template<>
+    struct SharedCharacterStates<DnaState> {
+        static const bool                               value = true;
+    };
+    
+    template<>
+    struct SharedCharacterStates<RnaState> {
+        static const bool                               value = true;
+    };
+    
+    
+    /**
+     * The sequence of discrete characters of a single taxon.
+     *
+     * A whole-genome alignment has millions of sites per taxon but only a handful of distinct
+     * nucleotides, so we do not store one character object per site. Instead, we keep a table
+     * of the distinct characters and one code per site into this table. The codes are a single
+     * byte as long as the table has at most 256 entries.
+     * The const accessors return the shared entry of the table. The non-const accessors give the
+     * site its own entry first, so that modifying the returned character does not change other sites.
+     * The site shares its entry again at the next non-const call, so the returned reference must not be
+     * kept beyond that. Characters of other types are stored once per site without a table.
+     */
     template<class charType>
     class DiscreteTaxonData : public AbstractDiscreteTaxonData {
 
@@ -46,10 +85,29 @@ namespace RevBayesCore {
         bool                                            isSequenceMissing(void) const;                                      //!< Returns whether the contains only missing data or has some actual observations
         void                                            removeCharacters(const std::set<size_t> &i);                        //!< Remove all the characters with a given index
         void                                            setAllCharactersMissing(void);                                      //!< Set all characters as missing
+        void                                            setCharacter(size_t index, const DiscreteCharacterState &c);        //!< Replace the character at position index
+        void                                            setCharacter(size_t index, const charType &c);                      //!< Replace the character at position index
+        void                                            setGapState(size_t index, bool tf);                                 //!< Set whether the character at position index is a gap
+        void                                            setMissingState(size_t index, bool tf);                             //!< Set whether the character at position index is missing
         
     private:
 
-        std::vector<charType>                           sequence;
+        size_t                                          addState(const charType &c);                                        //!< Add a new entry to the table of states
+        charType&                                       detachState(size_t index);                                          //!< Give the site its own entry in the table of states
+        size_t                                          getCode(size_t index) const;                                        //!< Get the entry in the table of states of the site
+        size_t                                          insertState(const charType &c);                                     //!< Get an entry for the character, adding it if needed
+        void                                            pushCode(size_t c);                                                 //!< Append a site with the given entry
+        void                                            releaseState(size_t s);                                             //!< One site less uses the entry
+        void                                            reshareStates(void);                                                //!< Share the entries of the detached sites again
+        void                                            setCode(size_t index, size_t c);                                    //!< Set the entry of the site
+
+        std::deque<charType>                            states;                                                             //!< The table of states (a deque so that references stay valid)
+        std::vector<size_t>                             state_counts;                                                       //!< The number of sites using each entry
+        std::map<std::string, size_t>                   shared_states;                                                      //!< The entries that may be shared between sites, by string value
+        std::vector<size_t>                             free_states;                                                        //!< The entries that are not used by any site
+        std::vector<unsigned char>                      codes;                                                              //!< The entry of each site, while there are at most 256 entries
+        std::vector<unsigned int>                       wide_codes;                                                         //!< The entry of each site, once there are more entries
+        std::vector<size_t>                             detached_sites;                                                     //!< The sites that got their own entry from the non-const accessors
         RbBitSet                                        is_resolved;
 
     };
@@ -72,7 +130,13 @@ namespace RevBayesCore {
  */
 template<class charType>
 RevBayesCore::DiscreteTaxonData<charType>::DiscreteTaxonData(const Taxon &t) : AbstractDiscreteTaxonData( t ),
-    sequence()
+    states(),
+    state_counts(),
+    shared_states(),
+    free_states(),
+    codes(),
+    wide_codes(),
+    detached_sites()
 {
 
 }
@@ -89,12 +153,13 @@ template<class charType>
 charType& RevBayesCore::DiscreteTaxonData<charType>::operator[](size_t i)
 {
 
-    if (i >= sequence.size())
+    if (i >= getNumberOfCharacters())
     {
         throw RbException("Index out of bounds");
     }
 
-    return sequence[i];
+    reshareStates();
+    return detachState( i );
 }
 
 
@@ -109,12 +174,12 @@ template<class charType>
 const charType& RevBayesCore::DiscreteTaxonData<charType>::operator[](size_t i) const
 {
 
-    if (i >= sequence.size())
+    if (i >= getNumberOfCharacters())
     {
         throw RbException("Index out of bounds");
     }
 
-    return sequence[i];
+    return states[ getCode( i ) ];
 }
 
 
@@ -252,7 +317,13 @@ template<class charType>
 void RevBayesCore::DiscreteTaxonData<charType>::concatenate(const DiscreteTaxonData<charType> &obsd)
 {
 
-    sequence.insert( sequence.end(), obsd.sequence.begin(), obsd.sequence.end() );
+    reshareStates();
+    
+    size_t n = obsd.getNumberOfCharacters();
+    for (size_t i = 0; i < n; ++i)
+    {
+        pushCode( insertState( obsd.states[ obsd.getCode( i ) ] ) );
+    }
 
 }
 
@@ -308,7 +379,8 @@ template<class charType>
 void RevBayesCore::DiscreteTaxonData<charType>::addCharacter( const charType &newChar )
 {
 
-    sequence.push_back( newChar );
+    reshareStates();
+    pushCode( insertState( newChar ) );
     is_resolved.push_back(true);
 }
 
@@ -363,26 +435,71 @@ template<class charType>
 void RevBayesCore::DiscreteTaxonData<charType>::addCharacter( const charType &newChar, bool tf )
 {
 
-    sequence.push_back( newChar );
+    reshareStates();
+    pushCode( insertState( newChar ) );
     is_resolved.push_back(tf);
 }
 
 
 
 /**
- * Push back a new character.
+ * Give the site its own entry in the table of states, unless it already has one,
+ * so that the returned character can be modified without changing other sites.
+ *
+ * \param[in]    index    The position of the character.
+ *
+ * \return                The entry of the site.
+ */
+template<class charType>
+charType& RevBayesCore::DiscreteTaxonData<charType>::detachState(size_t index)
+{
+    
+    size_t s = getCode( index );
+    
+    if ( SharedCharacterStates<charType>::value == true )
+    {
+        std::map<std::string, size_t>::iterator it = shared_states.find( states[s].getStringValue() );
+        if ( it != shared_states.end() && it->second == s )
+        {
+            if ( state_counts[s] == 1 )
+            {
+                // no other site uses this entry, so we only stop sharing it
+                shared_states.erase( it );
+            }
+            else
+            {
+                // copy the entry for this site
+                --state_counts[s];
+                s = addState( charType( states[s] ) );
+                setCode( index, s );
+            }
+            detached_sites.push_back( index );
+        }
+    }
+    
+    return states[s];
+}
+
+
+/**
+ * Get-operator for convenience access.
+ * The site gets its own copy of the character first, so that modifying it does not change other sites.
+ * Prefer the const version for reading and setCharacter for writing, because the site keeps its own copy.
  *
- * \param[in]    index    The position character.
+ * \param[in]    index  The position of the character.
+ *
+ * \return              A non-const reference to the character
  */
 template<class charType>
 charType& RevBayesCore::DiscreteTaxonData<charType>::getCharacter(size_t index)
 {
-    if (index >= sequence.size())
+    if (index >= getNumberOfCharacters())
     {
         throw RbException("Index out of bounds");
     }
 
-    return sequence[index];
+    reshareStates();
+    return detachState( index );
 }
 
 
@@ -397,12 +514,32 @@ template<class charType>
 const charType& RevBayesCore::DiscreteTaxonData<charType>::getCharacter(size_t index) const
 {
 
-    if (index >= sequence.size())
+    if (index >= getNumberOfCharacters())
     {
         throw RbException("Index out of bounds");
     }
 
-    return sequence[index];
+    return states[ getCode( index ) ];
+}
+
+
+/**
+ * Get the entry in the table of states that the site uses.
+ *
+ * \param[in]    index  The position of the character.
+ *
+ * \return              The index of the entry.
+ */
+template<class charType>
+size_t RevBayesCore::DiscreteTaxonData<charType>::getCode(size_t index) const
+{
+
+    if ( SharedCharacterStates<charType>::value == false )
+    {
+        return index;
+    }
+    
+    return ( states.size() > 256 ? size_t( wide_codes[index] ) : size_t( codes[index] ) );
 }
 
 
@@ -415,7 +552,12 @@ template<class charType>
 size_t RevBayesCore::DiscreteTaxonData<charType>::getNumberOfCharacters(void) const
 {
 
-    return sequence.size();
+    if ( SharedCharacterStates<charType>::value == false )
+    {
+        return states.size();
+    }
+    
+    return ( states.size() > 256 ? wide_codes.size() : codes.size() );
 }
 
 
@@ -432,10 +574,11 @@ std::string RevBayesCore::DiscreteTaxonData<charType>::getJsonRepresentation(voi
     jsonStr += "{\"DiscreteTaxonData\": ";
     jsonStr += taxon.getJsonRespresentation();
     jsonStr += ", \"charData\": [";
-    for (int i=0; i<sequence.size(); i++)
+    size_t n = getNumberOfCharacters();
+    for (size_t i=0; i<n; i++)
         {
-        jsonStr += "\"" + sequence[i].getStringValue() + "\"";
-        if (i + 1 < sequence.size())
+        jsonStr += "\"" + states[ getCode(i) ].getStringValue() + "\"";
+        if (i + 1 < n)
             jsonStr += ",";
         }
     jsonStr += "]";
@@ -454,16 +597,18 @@ std::string RevBayesCore::DiscreteTaxonData<charType>::getJsonRepresentation(voi
 template<class charType>
 double RevBayesCore::DiscreteTaxonData<charType>::getPercentageMissing( void ) const
 {
+    size_t n = getNumberOfCharacters();
     double numMissing = 0.0;
-    for (size_t i = 0; i < sequence.size(); ++i)
+    for (size_t i = 0; i < n; ++i)
     {
-        if ( sequence[i].isMissingState() == true || sequence[i].isGapState() == true )
+        const charType &c = states[ getCode(i) ];
+        if ( c.isMissingState() == true || c.isGapState() == true )
         {
             ++numMissing;
         }
     }
 
-    return numMissing / sequence.size();
+    return numMissing / n;
 }
 
 
@@ -471,12 +616,12 @@ template<class charType>
 std::string RevBayesCore::DiscreteTaxonData<charType>::getStateLabels(void)
 {
 
-    if (sequence.size() == 0)
+    if (getNumberOfCharacters() == 0)
     {
         return "";
     }
 
-    return sequence[0].getStateLabels();
+    return states[ getCode(0) ].getStateLabels();
 }
 
 
@@ -485,7 +630,178 @@ template<class charType>
 std::string RevBayesCore::DiscreteTaxonData<charType>::getStringRepresentation(size_t idx) const
 {
 
-    return sequence[idx].getStringValue();
+    return states[ getCode(idx) ].getStringValue();
+}
+
+
+/**
+ * Get an entry of the table of states for the character and count the site using it.
+ * Characters that can be shared reuse an existing entry with the same value.
+ * Characters of other types are appended as the entry of the next site.
+ *
+ * \param[in]    c      The character.
+ *
+ * \return              The index of the entry.
+ */
+template<class charType>
+size_t RevBayesCore::DiscreteTaxonData<charType>::insertState(const charType &c)
+{
+
+    if ( SharedCharacterStates<charType>::value == false )
+    {
+        states.push_back( c );
+        return states.size() - 1;
+    }
+    
+    std::string key = c.getStringValue();
+    std::map<std::string, size_t>::const_iterator it = shared_states.find( key );
+    if ( it != shared_states.end() )
+    {
+        ++state_counts[it->second];
+        return it->second;
+    }
+    
+    size_t s = addState( c );
+    shared_states.insert( std::make_pair( key, s ) );
+    
+    return s;
+}
+
+
+/**
+ * Add a new entry to the table of states, used by a single site.
+ * We reuse entries that no site uses anymore.
+ *
+ * \param[in]    c      The character.
+ *
+ * \return              The index of the entry.
+ */
+template<class charType>
+size_t RevBayesCore::DiscreteTaxonData<charType>::addState(const charType &c)
+{
+
+    size_t s = states.size();
+    if ( free_states.size() > 0 )
+    {
+        s = free_states.back();
+        free_states.pop_back();
+        states[s] = c;
+        state_counts[s] = 1;
+    }
+    else
+    {
+        states.push_back( c );
+        state_counts.push_back( 1 );
+        
+        // switch to wide codes once the codes do not fit into a byte anymore
+        if ( states.size() == 257 )
+        {
+            wide_codes.assign( codes.begin(), codes.end() );
+            std::vector<unsigned char>().swap( codes );
+        }
+    }
+    
+    return s;
+}
+
+
+/**
+ * Append a site using the given entry of the table of states.
+ *
+ * \param[in]    c      The index of the entry.
+ */
+template<class charType>
+void RevBayesCore::DiscreteTaxonData<charType>::pushCode(size_t c)
+{
+
+    if ( SharedCharacterStates<charType>::value == false )
+    {
+        // the site is the entry that insertState has just appended
+        return;
+    }
+    
+    if ( states.size() > 256 )
+    {
+        wide_codes.push_back( (unsigned int)c );
+    }
+    else
+    {
+        codes.push_back( (unsigned char)c );
+    }
+}
+
+
+/**
+ * A site does not use the entry of the table of states anymore.
+ * We keep the entry for reuse once no site uses it.
+ *
+ * \param[in]    s      The index of the entry.
+ */
+template<class charType>
+void RevBayesCore::DiscreteTaxonData<charType>::releaseState(size_t s)
+{
+
+    --state_counts[s];
+    if ( state_counts[s] == 0 )
+    {
+        std::map<std::string, size_t>::iterator it = shared_states.find( states[s].getStringValue() );
+        if ( it != shared_states.end() && it->second == s )
+        {
+            shared_states.erase( it );
+        }
+        free_states.push_back( s );
+    }
+}
+
+
+/**
+ * Let the sites that got their own entry from the non-const accessors share their entries again.
+ * A site moves to the shared entry with its current value, or its entry becomes the shared entry for the value.
+ */
+template<class charType>
+void RevBayesCore::DiscreteTaxonData<charType>::reshareStates( void )
+{
+
+    for (size_t i = 0; i < detached_sites.size(); ++i)
+    {
+        size_t index = detached_sites[i];
+        size_t s = getCode( index );
+        
+        std::map<std::string, size_t>::iterator it = shared_states.find( states[s].getStringValue() );
+        if ( it == shared_states.end() )
+        {
+            shared_states.insert( std::make_pair( states[s].getStringValue(), s ) );
+        }
+        else if ( it->second != s )
+        {
+            ++state_counts[it->second];
+            setCode( index, it->second );
+            releaseState( s );
+        }
+    }
+    
+    detached_sites.clear();
+}
+
+
+/**
+ * Set the entry of the table of states that the site uses.
+ *
+ * \param[in]    index  The position of the character.
+ * \param[in]    c      The index of the entry.
+ */
+template<class charType>
+void RevBayesCore::DiscreteTaxonData<charType>::setCode(size_t index, size_t c)
+{
+
+    if ( states.size() > 256 )
+    {
+        wide_codes[index] = (unsigned int)c;
+    }
+    else
+    {
+        codes[index] = (unsigned char)c;
+    }
 }
 
 
@@ -516,9 +832,11 @@ template<class charType>
 bool RevBayesCore::DiscreteTaxonData<charType>::isSequenceMissing( void ) const
 {
 
-    for (size_t i = 0; i < sequence.size(); ++i)
+    size_t n = getNumberOfCharacters();
+    for (size_t i = 0; i < n; ++i)
     {
-        if ( sequence[i].isMissingState() == false && sequence[i].isGapState() == false )
+        const charType &c = states[ getCode(i) ];
+        if ( c.isMissingState() == false && c.isGapState() == false )
         {
             return false;
         }
@@ -544,16 +862,41 @@ void RevBayesCore::DiscreteTaxonData<charType>::removeCharacters(const std::set<
 //        ++alreadyRemoved;
 //    }
 
-    std::vector<charType> included;
-    for (size_t i = 0; i < sequence.size(); ++i)
+    if ( SharedCharacterStates<charType>::value == false )
     {
+        std::deque<charType> included_states;
+        for (size_t i = 0; i < states.size(); ++i)
+        {
+            if ( idx.find(i) == idx.end() )
+            {
+                included_states.push_back( states[i] );
+            }
+        }
+        states.swap( included_states );
+        
+        return;
+    }
+    
+    reshareStates();
+    
+    size_t n = getNumberOfCharacters();
+    size_t num_included = 0;
+    for (size_t i = 0; i < n; ++i)
+    {
+        size_t c = getCode( i );
         if ( idx.find(i) == idx.end() )
         {
-            included.push_back( sequence[i] );
+            setCode( num_included, c );
+            ++num_included;
+        }
+        else
+        {
+            releaseState( c );
         }
     }
 
-    sequence = included;
+    codes.resize( states.size() > 256 ? 0 : num_included );
+    wide_codes.resize( states.size() > 256 ? num_included : 0 );
 
 }
 
@@ -566,11 +909,103 @@ template<class charType>
 void RevBayesCore::DiscreteTaxonData<charType>::setAllCharactersMissing( void )
 {
 
-    for (size_t i = 0; i < sequence.size(); ++i)
+    size_t n = getNumberOfCharacters();
+    for (size_t i = 0; i < n; ++i)
+    {
+        setMissingState( i, true );
+    }
+
+}
+
+
+/**
+ * Replace the character at the given position.
+ *
+ * \param[in]    index  The position of the character.
+ * \param[in]    c      The new character.
+ */
+template<class charType>
+void RevBayesCore::DiscreteTaxonData<charType>::setCharacter(size_t index, const DiscreteCharacterState &c)
+{
+
+#   ifdef ASSERTIONS_ALL
+    if ( dynamic_cast<const charType*>( &c ) == NULL )
+    {
+        throw RbException("Inserting wrong character type into TaxonData!!!");
+    }
+#   endif
+
+    setCharacter( index, static_cast<const charType &>(c) );
+}
+
+
+/**
+ * Replace the character at the given position.
+ * The site uses the shared entry for the new value, so unlike modifying the character
+ * returned by the non-const accessors this keeps the table of states small.
+ *
+ * \param[in]    index  The position of the character.
+ * \param[in]    c      The new character.
+ */
+template<class charType>
+void RevBayesCore::DiscreteTaxonData<charType>::setCharacter(size_t index, const charType &c)
+{
+
+    if (index >= getNumberOfCharacters())
+    {
+        throw RbException("Index out of bounds");
+    }
+
+    if ( SharedCharacterStates<charType>::value == false )
     {
-        sequence[i].setMissingState( true );
+        states[index] = c;
+        return;
     }
+    
+    reshareStates();
+    
+    // the new entry first, because releasing the old entry could free the character c refers to
+    size_t old_code = getCode( index );
+    size_t new_code = insertState( c );
+    releaseState( old_code );
+    setCode( index, new_code );
+
+}
 
+
+/**
+ * Set whether the character at the given position is a gap.
+ * We replace the character with a modified copy, so that it can still be shared with other sites.
+ *
+ * \param[in]    index  The position of the character.
+ * \param[in]    tf     Is the character a gap?
+ */
+template<class charType>
+void RevBayesCore::DiscreteTaxonData<charType>::setGapState(size_t index, bool tf)
+{
+
+    charType c = static_cast<const DiscreteTaxonData<charType>&>( *this ).getCharacter( index );
+    c.setGapState( tf );
+    
+    setCharacter( index, c );
+}
+
+
+/**
+ * Set whether the character at the given position is missing.
+ * We replace the character with a modified copy, so that it can still be shared with other sites.
+ *
+ * \param[in]    index  The position of the character.
+ * \param[in]    tf     Is the character missing?
+ */
+template<class charType>
+void RevBayesCore::DiscreteTaxonData<charType>::setMissingState(size_t index, bool tf)
+{
+
+    charType c = static_cast<const DiscreteTaxonData<charType>&>( *this ).getCharacter( index );
+    c.setMissingState( tf );
+    
+    setCharacter( index, c );
 }
 
 template<class charType>
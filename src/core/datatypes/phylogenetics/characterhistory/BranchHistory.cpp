@@ -188,36 +188,21 @@ void BranchHistory::clearEvents(void)
 void BranchHistory::clearEvents(const std::set<size_t>& indexSet)
 {
     
-    std::set<size_t>::iterator it_idx;
-    std::multiset<CharacterEvent*,CharacterEventCompare>::iterator it_h, it_tmp;
-    std::set<CharacterEvent*> to_be_deleted;
-    
     // for each event in history, delete if index matches indexSet
-    for (it_h = history.begin(); it_h != history.end(); it_h++)
+    // (erase by position, because erasing by value would also remove all other events of the same age)
+    std::multiset<CharacterEvent*,CharacterEventCompare>::iterator it_h = history.begin();
+    while ( it_h != history.end() )
     {
         if ( indexSet.find( (*it_h)->getSiteIndex() ) != indexSet.end() )
         {
-            to_be_deleted.insert(*it_h);
+            it_h = history.erase(it_h);
+        }
+        else
+        {
+            ++it_h;
         }
     }
     
-    std::set<CharacterEvent*>::iterator it_d;
-    for (it_d = to_be_deleted.begin(); it_d != to_be_deleted.end(); it_d++)
-    {
-        history.erase(*it_d);
-    }
-
-//            it_tmp = it_h;
-//            ++it_tmp;
-//            history.erase(it_h);
-//            //delete *it_h;
-//            it_h = it_tmp;
-//        }
-//        else
-//        {
-//            ++it_h;
-//        }
-//    }
 }
 
 void BranchHistory::removeEvent(CharacterEvent* evt)
@@ -267,15 +252,8 @@ void BranchHistory::updateHistory(const std::multiset<CharacterEvent*,CharacterE
 
 void BranchHistory::updateHistory(const std::multiset<CharacterEvent*,CharacterEventCompare>& updateSet)
 {
-    // erase events on branchHistory for indices in indexSet
-    clearEvents();
-
-    // insert elements into history
-    std::multiset<CharacterEvent*,CharacterEventCompare>::iterator it_h;
-    for (it_h = updateSet.begin(); it_h != updateSet.end(); it_h++)
-    {
-        history.insert(*it_h);
-    }
+    // replace all events (the assignment reuses the nodes of the old history)
+    history = updateSet;
 
 }
 
@@ -1,12 +1,61 @@
 #include "CharacterEventDiscrete.h"
 
+#include <new>
 #include <sstream> // IWYU pragma: keep
+#include <vector>
 
 #include "Cloneable.h"
 
 using namespace RevBayesCore;
 
 
+namespace {
+    
+    /**
+     * Flag whether the free list of this thread was already destroyed.
+     * The flag is trivially destructible, so it stays usable while the thread or the program shuts down,
+     * e.g., when the static workspaces delete their models after the thread-local free list is gone.
+     */
+    thread_local bool free_event_blocks_released = false;
+    
+    /**
+     * The free list of the memory blocks of deleted events.
+     * The blocks are handed out again to new events instead of going back to the heap.
+     * We keep at most max_blocks blocks and give them back to the heap when the thread ends.
+     */
+    struct FreeEventBlocks {
+        
+        static const size_t max_blocks = 4096;                         //!< The most blocks we keep for reuse
+        
+        FreeEventBlocks(void) { blocks.reserve( max_blocks ); }        //!< Reserve the space, so that adding a block never allocates
+        ~FreeEventBlocks(void)
+        {
+            for (size_t i = 0; i < blocks.size(); ++i)
+            {
+                ::operator delete( blocks[i] );
+            }
+            blocks.clear();
+            free_event_blocks_released = true;
+        }
+        
+        std::vector<void*> blocks;                                     //!< The unused memory blocks
+    };
+    
+    /** Get the free list of this thread, or NULL if it was already destroyed and events must use the heap directly. */
+    std::vector<void*>* freeEventBlocks( void )
+    {
+        if ( free_event_blocks_released == true )
+        {
+            return NULL;
+        }
+        
+        static thread_local FreeEventBlocks free_blocks;
+        return &free_blocks.blocks;
+    }
+    
+}
+
+
 CharacterEventDiscrete::CharacterEventDiscrete(void) : CharacterEvent()
 {
 
@@ -29,6 +78,38 @@ CharacterEventDiscrete::~CharacterEventDiscrete(void)
 
 }
 
+void* CharacterEventDiscrete::operator new(size_t size)
+{
+    std::vector<void*>* blocks = freeEventBlocks();
+    if ( size != sizeof(CharacterEventDiscrete) || blocks == NULL || blocks->empty() == true )
+    {
+        return ::operator new(size);
+    }
+    
+    void* p = blocks->back();
+    blocks->pop_back();
+    
+    return p;
+}
+
+void CharacterEventDiscrete::operator delete(void* p, size_t size)
+{
+    if ( p == NULL )
+    {
+        return;
+    }
+    
+    std::vector<void*>* blocks = freeEventBlocks();
+    if ( size != sizeof(CharacterEventDiscrete) || blocks == NULL || blocks->size() >= FreeEventBlocks::max_blocks )
+    {
+        ::operator delete(p);
+    }
+    else
+    {
+        blocks->push_back(p);
+    }
+}
+
 CharacterEventDiscrete* CharacterEventDiscrete::clone( void ) const
 {
     return new CharacterEventDiscrete( *this );
@@ -18,6 +18,10 @@ namespace RevBayesCore {
         CharacterEventDiscrete(const CharacterEventDiscrete& c);
         ~CharacterEventDiscrete(void);
 
+        // the events are recycled, because the data augmentation proposals create and delete them all the time
+        static void*                        operator new(size_t size);
+        static void                         operator delete(void* p, size_t size);
+
         CharacterEventDiscrete*             clone(void) const;
         size_t                              getState(void) const;
         std::string                         getStateStr(void) const;
@@ -0,0 +1,120 @@
+#include "StochasticCharacterMap.h"
+
+#include <algorithm>
+
+#include "StringUtilities.h"
+
+using namespace RevBayesCore;
+
+
+StochasticCharacterMap::StochasticCharacterMap(size_t ns, size_t nn) :
+    num_sites( ns ),
+    num_nodes( nn ),
+    first_interval( ns * nn, 0 ),
+    num_intervals( ns * nn, 0 ),
+    states(),
+    times()
+{
+    
+}
+
+
+void StochasticCharacterMap::addBranchHistory(size_t site, size_t node, const std::vector<size_t> &s, const std::vector<double> &t)
+{
+    size_t index = site * num_nodes + node;
+    first_interval[index] = states.size();
+    num_intervals[index]  = t.size();
+    
+    for (size_t i = 0; i < t.size(); ++i)
+    {
+        states.push_back( (unsigned int)s[i] );
+        times.push_back( t[i] );
+    }
+    
+}
+
+
+void StochasticCharacterMap::clear( void )
+{
+    
+    std::fill(first_interval.begin(), first_interval.end(), 0);
+    std::fill(num_intervals.begin(), num_intervals.end(), 0);
+    states.clear();
+    times.clear();
+    
+}
+
+
+size_t StochasticCharacterMap::getNumberOfIntervals(size_t site, size_t node) const
+{
+    
+    return num_intervals[site * num_nodes + node];
+}
+
+
+size_t StochasticCharacterMap::getNumberOfNodes( void ) const
+{
+    
+    return num_nodes;
+}
+
+
+size_t StochasticCharacterMap::getNumberOfSites( void ) const
+{
+    
+    return num_sites;
+}
+
+
+/**
+ * Get the history of a site along a branch as a SIMMAP string. By default the intervals are
+ * printed from the node towards the start of the branch, as expected by SIMMAP and phytools.
+ */
+std::string StochasticCharacterMap::getSimmapString(size_t site, size_t node, bool use_simmap_default) const
+{
+    size_t index = site * num_nodes + node;
+    size_t first = first_interval[index];
+    size_t n     = num_intervals[index];
+    
+    std::string simmap_string = "{";
+    
+    if (use_simmap_default == true)
+    {
+        for (size_t i = n; i > 0; i--)
+        {
+            simmap_string = simmap_string + StringUtilities::toString( states[first + i - 1] ) + "," + StringUtilities::toString(times[first + i - 1]);
+            if (i != 1)
+            {
+                simmap_string = simmap_string + ":";
+            }
+        }
+    }
+    else
+    {
+        for (size_t i = 0; i < n; i++)
+        {
+            if (i != 0)
+            {
+                simmap_string = simmap_string + ":";
+            }
+            simmap_string = simmap_string + StringUtilities::toString( states[first + i] ) + "," + StringUtilities::toString(times[first + i]);
+        }
+    }
+    simmap_string = simmap_string + "}";
+    
+    return simmap_string;
+}
+
+
+size_t StochasticCharacterMap::getState(size_t site, size_t node, size_t i) const
+{
+    
+    return states[ first_interval[site * num_nodes + node] + i ];
+}
+
+
+double StochasticCharacterMap::getTime(size_t site, size_t node, size_t i) const
+{
+    
+    return times[ first_interval[site * num_nodes + node] + i ];
+}
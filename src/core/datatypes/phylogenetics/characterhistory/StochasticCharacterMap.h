@@ -0,0 +1,47 @@
+#ifndef StochasticCharacterMap_H
+#define StochasticCharacterMap_H
+
+#include <stddef.h>
+#include <string>
+#include <vector>
+
+namespace RevBayesCore {
+    
+    /**
+     * @brief Compact record of stochastic character maps for several sites.
+     *
+     * The history of each site along each branch is a sequence of intervals, each given by
+     * a state index and the time spent in that state, ordered from the start of the branch
+     * towards the node. All intervals are stored in two flat arrays, so that many sites can
+     * be mapped without allocating a string per branch and site. SIMMAP strings are only
+     * created on request.
+     */
+    class StochasticCharacterMap {
+        
+    public:
+        
+        StochasticCharacterMap(size_t ns = 0, size_t nn = 0);
+        
+        void                                    addBranchHistory(size_t site, size_t node, const std::vector<size_t> &s, const std::vector<double> &t);      //!< Store the history of a site along a branch
+        void                                    clear(void);                                                                                                //!< Remove all histories but keep the dimensions
+        size_t                                  getNumberOfIntervals(size_t site, size_t node) const;
+        size_t                                  getNumberOfNodes(void) const;
+        size_t                                  getNumberOfSites(void) const;
+        std::string                             getSimmapString(size_t site, size_t node, bool use_simmap_default = true) const;                         //!< The history of a site along a branch in SIMMAP format
+        size_t                                  getState(size_t site, size_t node, size_t i) const;
+        double                                  getTime(size_t site, size_t node, size_t i) const;
+        
+    private:
+        
+        size_t                                  num_sites;
+        size_t                                  num_nodes;
+        std::vector<size_t>                     first_interval;                                         //!< Position of the first interval of each site and branch
+        std::vector<size_t>                     num_intervals;                                          //!< Number of intervals of each site and branch
+        std::vector<unsigned int>               states;
+        std::vector<double>                     times;
+        
+    };
+    
+}
+
+#endif
@@ -90,7 +90,7 @@ void CladogeneticProbabilityMatrix::initFromString( const std::string &s )
     throw RbException("MJL (23/10/2016): Missing implementation!");
 }
 
-void CladogeneticProbabilityMatrix::setEventMap(std::map<std::vector<unsigned>, double> m)
+void CladogeneticProbabilityMatrix::setEventMap(const std::map<std::vector<unsigned>, double>& m)
 {
     eventMapProbs = m;
 }
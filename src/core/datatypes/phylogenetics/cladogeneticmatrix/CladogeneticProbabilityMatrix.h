@@ -45,7 +45,7 @@ namespace RevBayesCore {
         virtual std::map<std::vector<unsigned>, double>         getEventMap(double t=0.0);
         virtual const std::map<std::vector<unsigned>, double>&  getEventMap(double t=0.0) const;
         std::vector<std::string>                                getEventTypes(void) const;
-        void                                                    setEventMap(std::map<std::vector<unsigned>, double> m);
+        void                                                    setEventMap(const std::map<std::vector<unsigned>, double>& m);
         void                                                    setEventTypes(std::vector<std::string> et);
 //        void                                                    setEventMap(std::map<std::vector<unsigned>, double> m, size_t k);
         
@@ -23,7 +23,9 @@ using namespace RevBayesCore;
 /** Construct rate matrix with n states */
 AbstractRateMatrix::AbstractRateMatrix(size_t n) : RateMatrix(n),
     the_rate_matrix( new MatrixReal(num_states, num_states, 1.0) ),
-    needs_update( true )
+    needs_update( true ),
+    dominating_rate( 0.0 ),
+    stored_dominating_rate( 0.0 )
 {
 
     // I cannot call a pure virtual function from the constructor (Sebastian)
@@ -32,10 +34,15 @@ AbstractRateMatrix::AbstractRateMatrix(size_t n) : RateMatrix(n),
 
 
 
-/** Copy constructor */
+/**
+ * Copy constructor.
+ * The cached powers of the uniformized matrix are not copied; the copy recomputes them when it needs them.
+ */
 AbstractRateMatrix::AbstractRateMatrix(const AbstractRateMatrix& m) : RateMatrix(m),
     the_rate_matrix( new MatrixReal(*m.the_rate_matrix) ),
-    needs_update( true )
+    needs_update( true ),
+    dominating_rate( m.dominating_rate ),
+    stored_dominating_rate( 0.0 )
 {
 
 }
@@ -62,6 +69,14 @@ AbstractRateMatrix& AbstractRateMatrix::operator=(const AbstractRateMatrix &r)
         the_rate_matrix       = new MatrixReal( *r.the_rate_matrix );
         needs_update         = true;
 
+        // the cached powers are not copied but recomputed when needed
+        dominating_rate                 = r.dominating_rate;
+        stochastic_matrix.clear();
+        stochastic_matrix_rates         = MatrixReal();
+        stored_dominating_rate          = 0.0;
+        stored_stochastic_matrix.clear();
+        stored_stochastic_matrix_rates  = MatrixReal();
+
     }
 
     return *this;
@@ -289,19 +304,33 @@ MatrixReal AbstractRateMatrix::getRateMatrix() const
     return *the_rate_matrix;
 }
 
+/**
+ * Get the uniformized matrix raised to the power of n.
+ * The powers are cached and only the missing ones are computed.
+ */
 MatrixReal AbstractRateMatrix::getStochasticMatrix(size_t n)
 {
-    if (n >= stochastic_matrix.size())
+    updateStochasticMatrices();
+
+    while ( stochastic_matrix.size() <= n )
     {
-        std::stringstream ss;
-        ss << "Cannot access stochastic matrix R^" << n;
-        throw RbException(ss.str());
+        computeStochasticMatrix( stochastic_matrix.size() );
     }
-    return stochastic_matrix[n];
+
+    MatrixReal r_n = stochastic_matrix[n];
+    trimStochasticMatrices();
+
+    return r_n;
 }
 
 void AbstractRateMatrix::computeStochasticMatrix(size_t n)
 {
+    // nothing to do if we already have this power
+    if ( n < stochastic_matrix.size() )
+    {
+        return;
+    }
+
     MatrixReal r;
     if (n == 0) {
         // identity matrix, R^0
@@ -335,11 +364,82 @@ void AbstractRateMatrix::computeStochasticMatrix(size_t n)
 
     }
 
-    if (stochastic_matrix.size() <= n) {
-        stochastic_matrix.push_back(r);
+    stochastic_matrix.push_back(r);
+}
+
+namespace {
+
+    /** Check whether two rate matrices hold exactly the same rates. */
+    bool haveSameRates(const MatrixReal& a, const MatrixReal& b)
+    {
+        if ( a.getNumberOfRows() != b.getNumberOfRows() || a.getNumberOfColumns() != b.getNumberOfColumns() )
+        {
+            return false;
+        }
+
+        for (size_t i = 0; i < a.getNumberOfRows(); ++i)
+        {
+            for (size_t j = 0; j < a.getNumberOfColumns(); ++j)
+            {
+                if ( a[i][j] != b[i][j] )
+                {
+                    return false;
+                }
+            }
+        }
+
+        return true;
     }
+
 }
 
+
+/**
+ * Make sure that the dominating rate and the cached powers of the uniformized matrix, R = I + Q/mu,
+ * belong to the current rates.
+ * Derived classes write their rates directly into the_rate_matrix, so instead of relying on each of them
+ * to invalidate the cache we compare the rates with those the cache was computed from. The cache of the
+ * previous rates is kept as well, such that restoring the rates after a rejected proposal does not
+ * recompute the powers.
+ */
+void AbstractRateMatrix::updateStochasticMatrices(void)
+{
+    if ( haveSameRates( stochastic_matrix_rates, *the_rate_matrix ) == true )
+    {
+        return;
+    }
+
+    std::swap( dominating_rate, stored_dominating_rate );
+    stochastic_matrix.swap( stored_stochastic_matrix );
+    std::swap( stochastic_matrix_rates, stored_stochastic_matrix_rates );
+
+    if ( haveSameRates( stochastic_matrix_rates, *the_rate_matrix ) == false )
+    {
+        stochastic_matrix.clear();
+        stochastic_matrix_rates = *the_rate_matrix;
+        computeDominatingRate();
+    }
+}
+
+
+/**
+ * Drop the highest cached powers of the uniformized matrix if the cache holds more than MAX_CACHED_POWER_ENTRIES values.
+ * A single long branch may need many powers; we do not want to keep all of them for the remaining branches.
+ * We always keep R^0 and R^1.
+ */
+void AbstractRateMatrix::trimStochasticMatrices(void)
+{
+    size_t entries_per_power = std::max<size_t>( 1, num_states * num_states );
+    size_t max_powers = std::max<size_t>( 2, MAX_CACHED_POWER_ENTRIES / entries_per_power );
+
+    if ( stochastic_matrix.size() > max_powers )
+    {
+        stochastic_matrix.erase( stochastic_matrix.begin() + max_powers, stochastic_matrix.end() );
+        stochastic_matrix.shrink_to_fit();
+    }
+}
+
+
 /** Rescale the rates such that the average rate is r */
 void AbstractRateMatrix::rescaleToAverageRate(double r)
 {
@@ -362,14 +462,33 @@ void AbstractRateMatrix::rescaleToAverageRate(double r)
 
 bool AbstractRateMatrix::simulateStochasticMapping(double startAge, double endAge, double rate,std::vector<size_t>& transition_states, std::vector<double>& transition_times)
 {
-    // start and end states
-    size_t start_state = transition_states[0];
-    size_t end_state = transition_states[1];
+    std::vector<std::vector<size_t> > states = std::vector<std::vector<size_t> >(1, transition_states);
+    std::vector<std::vector<double> > times = std::vector<std::vector<double> >(1, transition_times);
+
+    bool success = simulateStochasticMappings(startAge, endAge, rate, states, times);
+
+    transition_states.swap( states[0] );
+    transition_times.swap( times[0] );
+
+    return success;
+}
+
+
+/**
+ * Simulate the histories of several sites along the same branch, each conditioned on its start and end state.
+ * The transition probabilities, the dominating rate and the powers of the uniformized matrix only depend on
+ * the branch, so they are computed once and shared by all sites.
+ */
+bool AbstractRateMatrix::simulateStochasticMappings(double startAge, double endAge, double rate, std::vector<std::vector<size_t> >& transition_states, std::vector<std::vector<double> >& transition_times)
+{
     double branch_length = (startAge - endAge);
 
     if (branch_length == 0.0) {
-        transition_states = std::vector<size_t>(1, start_state);
-        transition_times = std::vector<double>(1, 0.0);
+        for (size_t k = 0; k < transition_states.size(); ++k)
+        {
+            transition_states[k] = std::vector<size_t>(1, transition_states[k][0]);
+            transition_times[k] = std::vector<double>(1, 0.0);
+        }
         return true;
     }
 
@@ -377,10 +496,33 @@ bool AbstractRateMatrix::simulateStochasticMapping(double startAge, double endAg
     TransitionProbabilityMatrix P(num_states);
     calculateTransitionProbabilitiesForStochasticMapping(startAge, endAge, rate, P);
 //    exponentiateMatrixByScalingAndSquaring(branch_length * rate, P);
-    stochastic_matrix = std::vector<MatrixReal>();
 
-    // dominating rate
-    computeDominatingRate();
+    // dominating rate and powers of the uniformized matrix, reused from earlier branches if the rates did not change
+    updateStochasticMatrices();
+
+    bool success = true;
+    for (size_t k = 0; k < transition_states.size(); ++k)
+    {
+        success &= sampleStochasticMapping(P, branch_length, rate, transition_states[k], transition_times[k]);
+    }
+
+    // do not keep the powers needed only by this branch
+    trimStochasticMatrices();
+
+    return success;
+}
+
+
+/**
+ * Sample the history of one site by uniformization, given the transition probabilities of the branch.
+ * The powers of the uniformized matrix are taken from stochastic_matrix and only extended when a path
+ * needs more events than any path before it.
+ */
+bool AbstractRateMatrix::sampleStochasticMapping(const TransitionProbabilityMatrix& P, double branch_length, double rate, std::vector<size_t>& transition_states, std::vector<double>& transition_times)
+{
+    // start and end states
+    size_t start_state = transition_states[0];
+    size_t end_state = transition_states[1];
 
     // sample number of events
     size_t num_events = 0;
@@ -402,10 +544,13 @@ bool AbstractRateMatrix::simulateStochasticMapping(double startAge, double endAg
         prob_num_events_sum += prob_num_events;
 
         // add the R^n stochastic matrix
-        computeStochasticMatrix(num_events);
+        if ( num_events >= stochastic_matrix.size() )
+        {
+            computeStochasticMatrix(num_events);
+        }
 
         // probability of start_state -> end_state after num_events
-        const MatrixReal& R_n = getStochasticMatrix(num_events);
+        const MatrixReal& R_n = stochastic_matrix[num_events];
         double prob_transition_dtmc = R_n[start_state][end_state];
 
         // update sampling prob
@@ -467,8 +612,8 @@ bool AbstractRateMatrix::simulateStochasticMapping(double startAge, double endAg
         size_t prev_state = transition_states[n];
         size_t num_events_left = num_events - n - 1;
 
-        const MatrixReal& R_1 = getStochasticMatrix(1);
-        const MatrixReal& R_n = getStochasticMatrix(num_events_left);
+        const MatrixReal& R_1 = stochastic_matrix[1];
+        const MatrixReal& R_n = stochastic_matrix[num_events_left];
 
         // get the normalization constant for sampling
         double p_sum = 0.0;
@@ -612,11 +757,12 @@ void AbstractRateMatrix::exponentiateMatrixByScalingAndSquaring(double t,  Trans
     // Its kind of complicated, so we should probably use Eigen if we switch to that.
 
     // calculate the scaled matrix raised to powers 2, 3 and 4
+    // we always keep the scaled rate matrix on the left, because its zero entries are skipped in the product
     TransitionProbabilityMatrix p_2 = p * p;
 
     TransitionProbabilityMatrix p_3 = p * p_2;
 
-    TransitionProbabilityMatrix p_4 = p_2 * p_2;
+    TransitionProbabilityMatrix p_4 = p * p_3;
 
     // add k=0 (the identity matrix) and k=1 terms
     for ( size_t i = 0; i < num_states; i++ )
@@ -651,6 +797,124 @@ void AbstractRateMatrix::exponentiateMatrixByScalingAndSquaring(double t,  Trans
     }
 }
 
+/**
+ * Compute the matrix exponential by uniformization using only the non-zero rates of the rate matrix.
+ *
+ * With mu the largest exit rate and R = I + Q/mu, we have P(t) = sum_k Pois(k; mu t) R^k.
+ * Generators of the chromosome-number and PoMo models have only a handful of non-zero rates per row, so each
+ * further power of R costs O(n * nnz) instead of the O(n^3) of a dense product, and all terms stay non-negative.
+ * If the number of Poisson terms needed makes this more expensive than scaling and squaring,
+ * or if exp(-mu t) would underflow, we fall back to scaling and squaring.
+ */
+void AbstractRateMatrix::exponentiateSparseMatrix(double t,  TransitionProbabilityMatrix& p) const
+{
+    assert(t >= 0);
+    assert(p.num_states == p.getNumberOfStates());
+
+    size_t n = num_states;
+
+    double mu = 0.0;
+    for ( size_t i = 0; i < n; i++ )
+    {
+        mu = std::max(mu, -(*the_rate_matrix)[i][i]);
+    }
+
+    double lambda = mu * t;
+    if ( lambda == 0.0 )
+    {
+        for ( size_t i = 0; i < n; i++ )
+        {
+            for ( size_t j = 0; j < n; j++ )
+            {
+                p[i][j] = ( i == j ? 1.0 : 0.0 );
+            }
+        }
+        return;
+    }
+
+    // store the uniformized matrix R row by row, keeping only the non-zero entries
+    std::vector<size_t> row_start(n+1, 0);
+    std::vector<size_t> columns;
+    std::vector<double> values;
+    for ( size_t i = 0; i < n; i++ )
+    {
+        for ( size_t j = 0; j < n; j++ )
+        {
+            double r = (*the_rate_matrix)[i][j] / mu + ( i == j ? 1.0 : 0.0 );
+            if ( r != 0.0 )
+            {
+                columns.push_back( j );
+                values.push_back( r );
+            }
+        }
+        row_start[i+1] = values.size();
+    }
+
+    // the Poisson tail beyond this bound is negligible
+    double max_terms = lambda + 10.0 * sqrt(lambda) + 20.0;
+
+    // compare with the cost of scaling and squaring, see exponentiateMatrixByScalingAndSquaring
+    int s = 0;
+    std::frexp(L1norm(*the_rate_matrix) * t, &s);
+    s = std::max(10 + s, 0);
+    double dense_cost  = (s + 4.0) * n * n * n;
+    double sparse_cost = max_terms * (values.size() + n) * n;
+    if ( lambda > 700.0 || sparse_cost > dense_cost )
+    {
+        exponentiateMatrixByScalingAndSquaring(t, p);
+        return;
+    }
+
+    // start with the k=0 term, the identity matrix
+    std::vector<double> power(n * n, 0.0);
+    std::vector<double> next(n * n, 0.0);
+    double weight = exp( -lambda );
+    double mass   = weight;
+    for ( size_t i = 0; i < n; i++ )
+    {
+        power[i * n + i] = 1.0;
+        for ( size_t j = 0; j < n; j++ )
+        {
+            p[i][j] = ( i == j ? weight : 0.0 );
+        }
+    }
+
+    for ( size_t k = 1; k < max_terms && (1.0 - mass) > 1E-12; k++ )
+    {
+        // R^k = R * R^(k-1), accumulating the rows of R^(k-1) selected by the non-zero entries of R
+        for ( size_t i = 0; i < n; i++ )
+        {
+            double* next_i = &next[i * n];
+            std::fill(next_i, next_i + n, 0.0);
+            for ( size_t e = row_start[i]; e < row_start[i+1]; e++ )
+            {
+                double r_ie = values[e];
+                const double* power_e = &power[columns[e] * n];
+                for ( size_t j = 0; j < n; j++ )
+                {
+                    next_i[j] += r_ie * power_e[j];
+                }
+            }
+        }
+        power.swap( next );
+
+        weight *= lambda / k;
+        mass   += weight;
+        for ( size_t i = 0; i < n; i++ )
+        {
+            const double* power_i = &power[i * n];
+            double* p_i = p[i];
+            for ( size_t j = 0; j < n; j++ )
+            {
+                p_i[j] += weight * power_i[j];
+            }
+        }
+    }
+
+    // put the truncated Poisson tail back into the rows
+    normalize_rows(p);
+}
+
 /** Set the diagonal of the rate matrix such that each row sums to zero */
 void AbstractRateMatrix::setDiagonal(void)
 {
@@ -59,6 +59,7 @@ namespace RevBayesCore {
         virtual MatrixReal                  getStochasticMatrix(size_t n);
         virtual double                      getDominatingRate(void) const;
         virtual bool                        simulateStochasticMapping(double startAge, double endAge, double rate,std::vector<size_t>& transition_states, std::vector<double>& transition_times);
+        virtual bool                        simulateStochasticMappings(double startAge, double endAge, double rate, std::vector<std::vector<size_t> >& transition_states, std::vector<std::vector<double> >& transition_times);
         
 
     protected:
@@ -72,15 +73,24 @@ namespace RevBayesCore {
         bool                                checkTimeReversibity(double tolerance);
         virtual void                        computeStochasticMatrix(size_t n);
         virtual void                        computeDominatingRate(void);
+        void                                updateStochasticMatrices(void);                                                             //!< Make sure the cached powers of the uniformized matrix belong to the current rates
+        void                                trimStochasticMatrices(void);                                                               //!< Drop the highest cached powers if the cache grew too large
         void                                exponentiateMatrixByScalingAndSquaring(double t,  TransitionProbabilityMatrix& p) const;
+        void                                exponentiateSparseMatrix(double t,  TransitionProbabilityMatrix& p) const;                  //!< Exponentiate by uniformization over the non-zero rates only
+        bool                                sampleStochasticMapping(const TransitionProbabilityMatrix& P, double branch_length, double rate, std::vector<size_t>& transition_states, std::vector<double>& transition_times);
         
         // protected members available for derived classes
         MatrixReal*                         the_rate_matrix;                                                                            //!< Holds the rate matrix
         bool                                needs_update;
         
         // stochastic matrix
+        static const size_t                 MAX_CACHED_POWER_ENTRIES = 1 << 22;                                                         //!< Maximum number of values kept in the cached powers of the uniformized matrix (32MB)
         double                              dominating_rate;
         std::vector<MatrixReal>             stochastic_matrix;                                                                          //!< Stochastic matrix raised to the power of n
+        MatrixReal                          stochastic_matrix_rates;                                                                    //!< The rates from which the stochastic matrices were computed
+        double                              stored_dominating_rate;
+        std::vector<MatrixReal>             stored_stochastic_matrix;                                                                   //!< The powers for the previous rates, kept for a rejected proposal
+        MatrixReal                          stored_stochastic_matrix_rates;
         
     };
     
@@ -241,6 +241,22 @@ bool RateGenerator::simulateStochasticMapping(double startAge, double endAge, do
 }
 
 
+/**
+ * Simulate the histories of several sites along the same branch.
+ * Derived classes may override this to share the work that only depends on the branch.
+ */
+bool RateGenerator::simulateStochasticMappings(double startAge, double endAge, double rate, std::vector<std::vector<size_t> >& transition_states, std::vector<std::vector<double> >& transition_times)
+{
+    bool success = true;
+    for (size_t k = 0; k < transition_states.size(); ++k)
+    {
+        success &= simulateStochasticMapping(startAge, endAge, rate, transition_states[k], transition_times[k]);
+    }
+
+    return success;
+}
+
+
 
 void RateGenerator::printForUser(std::ostream &o, const std::string &sep, int l, bool left) const
 {
@@ -38,6 +38,7 @@ namespace RevBayesCore {
 
         // virtual methods that may need to overwritten
         virtual bool                        simulateStochasticMapping(double startAge, double endAge, double rate,std::vector<size_t>& transition_states, std::vector<double>& transition_times);
+        virtual bool                        simulateStochasticMappings(double startAge, double endAge, double rate, std::vector<std::vector<size_t> >& transition_states, std::vector<std::vector<double> >& transition_times);
         virtual void                        update(void) {};
 
         // public methods
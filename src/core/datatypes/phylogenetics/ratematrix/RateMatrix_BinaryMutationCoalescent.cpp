@@ -111,68 +111,14 @@ void RateMatrix_BinaryMutationCoalescent::buildRateMatrix(void)
 void RateMatrix_BinaryMutationCoalescent::calculateTransitionProbabilities(double startAge, double endAge, double rate, TransitionProbabilityMatrix& P) const
 {
     
-    //Now the instantaneous rate matrix has been filled up entirely.
-    //We use repeated squaring to quickly obtain exponentials, as in Poujol and Lartillot, Bioinformatics 2014.
+    // The generator has only a few non-zero rates per row, so we exponentiate it by uniformization over these rates.
+    // This falls back to scaling and squaring when that is cheaper.
     double t = rate * (startAge - endAge);
-    computeExponentialMatrixByRepeatedSquaring(t, P);
+    exponentiateSparseMatrix(t, P);
     
     return;
 }
 
-void RateMatrix_BinaryMutationCoalescent::computeExponentialMatrixByRepeatedSquaring(double t,  TransitionProbabilityMatrix& P ) const
-{
-    //We use repeated squaring to quickly obtain exponentials, as in Poujol and Lartillot, Bioinformatics 2014.
-    //Ideally one should dynamically decide how many squarings are necessary.
-    //For the moment, we arbitrarily do 10 such squarings, as it seems to perform well in practice (N. Lartillot, personal communication).
-    //first, multiply the matrix by the right scalar
-    //2^10 = 1024
-    double tOver2s = t/(1024);
-    for ( size_t i = 0; i < matrix_size; i++ )
-    {
-        for ( size_t j = 0; j < matrix_size; j++ )
-        {
-            P[i][j] = (*the_rate_matrix)[i][j] * tOver2s;
-        }
-    }
-    
-    //Add the identity matrix:
-    for ( size_t i = 0; i < matrix_size; i++ )
-    {
-        P[i][i] += 1;
-    }
-    //Now we can do the multiplications
-    TransitionProbabilityMatrix P2 (matrix_size);
-    squareMatrix (P, P2); //P2 at power 2
-    squareMatrix (P2, P); //P at power 4
-    squareMatrix (P, P2); //P2 at power 8
-    squareMatrix (P2, P); //P at power 16
-    squareMatrix (P, P2); //P2 at power 32
-    squareMatrix (P2, P); //P at power 64
-    squareMatrix (P, P2); //P2 at power 128
-    squareMatrix (P2, P); //P at power 256
-    squareMatrix (P, P2); //P2 at power 512
-    squareMatrix (P2, P); //P at power 1024
-    
-    return;
-}
-
-inline void RateMatrix_BinaryMutationCoalescent::squareMatrix( TransitionProbabilityMatrix& P,  TransitionProbabilityMatrix& P2) const
-{
-    //Could probably use boost::ublas here, for the moment we do it ourselves.
-    for ( size_t i = 0; i < matrix_size; i++ )
-    {
-        for ( size_t j = 0; j < matrix_size; j++ )
-        {
-            P2.getElement ( i, j ) = 0;
-            for ( size_t k = 0; k < matrix_size; k++ )
-            {
-                P2.getElement ( i, j ) += P.getElement ( i, k ) * P.getElement ( k, j );
-                
-            }
-        }
-    }
-}
-
 
 
 RateMatrix_BinaryMutationCoalescent* RateMatrix_BinaryMutationCoalescent::clone( void ) const
@@ -34,8 +34,6 @@ namespace RevBayesCore {
         
     private:
         void                                            buildRateMatrix(void);
-        void                                            computeExponentialMatrixByRepeatedSquaring(double t,  TransitionProbabilityMatrix& P ) const;
-        inline void                                     squareMatrix( TransitionProbabilityMatrix& P,  TransitionProbabilityMatrix& P2) const;
         
         
         size_t                                          N;                          //!< Number of individuals in population
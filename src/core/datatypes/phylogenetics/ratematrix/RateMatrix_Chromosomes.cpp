@@ -96,8 +96,10 @@ void RateMatrix_Chromosomes::calculateTransitionProbabilities(double startAge, d
     
     // We use repeated squaring to quickly obtain exponentials, as in Poujol and Lartillot, Bioinformatics 2014.
 	// Mayrose et al. 2010 also used this method for chromosome evolution (named the squaring and scaling method in Moler and Van Loan 2003).
+    // The generator has at most five non-zero rates per row, so we first try uniformization over these rates only,
+    // which falls back to scaling and squaring when that is cheaper.
     double t = rate * (startAge - endAge);
-    exponentiateMatrixByScalingAndSquaring(t, P);
+    exponentiateSparseMatrix(t, P);
     
 }
 
@@ -9,6 +9,7 @@
 //#define DEBUG_DEC
 
 #include <stddef.h>
+#include <bitset>
 #include <cmath>
 #include <list>
 #include <complex>
@@ -56,7 +57,7 @@ RateMatrix_DECRateMatrix::RateMatrix_DECRateMatrix(size_t ns, size_t nc, bool cs
     c_ijk.resize(num_states * num_states * num_states);
     cc_ijk.resize(num_states * num_states * num_states);
     
-    makeBits();
+    makeMasks();
     makeTransitions();
     
     for (size_t i = 0; i < num_states; ++i)
@@ -77,10 +78,8 @@ RateMatrix_DECRateMatrix::RateMatrix_DECRateMatrix(const RateMatrix_DECRateMatri
     stationaryMatrix(m.stationaryMatrix)
 {
     
-    bits                 = m.bits;
-    inverseBits          = m.inverseBits;
-    statesToBitsByNumOn  = m.statesToBitsByNumOn;
-    bitsToStatesByNumOn  = m.bitsToStatesByNumOn;
+    statesToMasks        = m.statesToMasks;
+    masksToStates        = m.masksToStates;
     transitions          = m.transitions;
     lossOrGain           = m.lossOrGain;
     transitionAreas      = m.transitionAreas;
@@ -107,7 +106,7 @@ RateMatrix_DECRateMatrix::RateMatrix_DECRateMatrix(const RateMatrix_DECRateMatri
     maxSizeStoredTransitionProbabilites = m.maxSizeStoredTransitionProbabilites;
     useStoredTransitionProbabilities = m.useStoredTransitionProbabilities;
     changedAreas = m.changedAreas;
-    affectingAreas = m.affectingAreas;
+    stateAreas = m.stateAreas;
     
     theEigenSystem->setRateMatrixPtr(the_rate_matrix);
     update();
@@ -130,10 +129,8 @@ RateMatrix_DECRateMatrix& RateMatrix_DECRateMatrix::operator=(const RateMatrix_D
         
         delete theEigenSystem;
         
-        bits                 = r.bits;
-        inverseBits          = r.inverseBits;
-        statesToBitsByNumOn  = r.statesToBitsByNumOn;
-        bitsToStatesByNumOn  = r.bitsToStatesByNumOn;
+        statesToMasks        = r.statesToMasks;
+        masksToStates        = r.masksToStates;
         transitions          = r.transitions;
         lossOrGain           = r.lossOrGain;
         transitionAreas      = r.transitionAreas;
@@ -160,7 +157,7 @@ RateMatrix_DECRateMatrix& RateMatrix_DECRateMatrix::operator=(const RateMatrix_D
         maxSizeStoredTransitionProbabilites = r.maxSizeStoredTransitionProbabilites;
         useStoredTransitionProbabilities = r.useStoredTransitionProbabilities;
         changedAreas = r.changedAreas;
-        affectingAreas = r.affectingAreas;
+        stateAreas = r.stateAreas;
 //        stationaryMatrix     = r.stationaryMatrix;
 
         theEigenSystem->setRateMatrixPtr(the_rate_matrix);
@@ -201,9 +198,6 @@ void RateMatrix_DECRateMatrix::fillRateMatrix( void )
         
     MatrixReal& m = *the_rate_matrix;
     
-    std::vector<std::vector<unsigned> >::iterator it;
-    std::vector<unsigned>::iterator jt;
-    
     // get normalize range sizes s.t. expected multiplier == 1
     std::vector<double> normalizedRangeSize = rangeSize;
     for (size_t i = 0; i < rangeSize.size(); i++)
@@ -216,11 +210,11 @@ void RateMatrix_DECRateMatrix::fillRateMatrix( void )
     {
         unsigned startState = (unsigned)i;
         
+        // the areas of the starting range affect all moves leaving state i
+        const std::vector<unsigned>& affecting_areas = stateAreas[i];
+        
         // get range size weights
-        int n = 0;
-        for (size_t j = 0; j < statesToBitsByNumOn[i].size(); j++)
-            n += statesToBitsByNumOn[i][j];
-        double p = normalizedRangeSize[n-1];
+        double p = normalizedRangeSize[affecting_areas.size()-1];
         
         double sum = 0.0;
         
@@ -232,11 +226,6 @@ void RateMatrix_DECRateMatrix::fillRateMatrix( void )
             
             double v = 0.0;
             
-            std::vector<unsigned> b1 = statesToBitsByNumOn[startState];
-            std::vector<unsigned> b2 = statesToBitsByNumOn[endState];
-            
-//            std::cout << getRangeStr(b1) << "->" << getRangeStr(b2) << " " << (lossOrGain[i][j]==0 ? "LOSS" : "GAIN") << " :\n";
-            
             // extinction
             if (lossOrGain[i][j] == 0)
             {
@@ -247,7 +236,6 @@ void RateMatrix_DECRateMatrix::fillRateMatrix( void )
                 else
                 {
                     unsigned changed_area = changedAreas[i][j];
-                    std::vector<unsigned> affecting_areas = affectingAreas[i][j];
                     
                     for (size_t k = 0; k < affecting_areas.size(); k++)
                     {
@@ -262,7 +250,6 @@ void RateMatrix_DECRateMatrix::fillRateMatrix( void )
             else if (lossOrGain[i][j] == 1)
             {
                 unsigned changed_area = changedAreas[i][j];
-                std::vector<unsigned> affecting_areas = affectingAreas[i][j];
                 
                 for (size_t k = 0; k < affecting_areas.size(); k++)
                 {
@@ -527,59 +514,42 @@ std::vector<double> RateMatrix_DECRateMatrix::getStationaryFrequencies(void) con
     return(f);
 }
 
-void RateMatrix_DECRateMatrix::makeBits(void)
+void RateMatrix_DECRateMatrix::makeMasks(void)
 {
     
-    size_t num_all_states = (size_t)pow(2,numCharacters);
-    bitsByNumOn.resize(numCharacters+1);
-    statesToBitsByNumOn.resize(num_all_states);
-    bits = std::vector<std::vector<unsigned> >(num_all_states, std::vector<unsigned>(numCharacters, 0));
-    bitsByNumOn[0].push_back(bits[0]);
-    for (size_t i = 1; i < num_all_states; i++)
+    if ( numCharacters >= 32 )
     {
-        size_t m = i;
-        for (size_t j = 0; j < numCharacters; j++)
-        {
-            bits[i][j] = m % 2;
-            m /= 2;
-            if (m == 0)
-                break;
-        }
-        size_t j = numBitsOn(bits[i]);
-        bitsByNumOn[j].push_back(bits[i]);
-        
+        throw RbException("The DEC rate matrix only supports up to 31 areas.");
     }
-    for (size_t i = 0; i < num_all_states; i++)
+    
+    // bit j of a range mask is set if the range contains area j
+    size_t num_all_states = (size_t)1 << numCharacters;
+    std::vector<unsigned> mask_sizes(num_all_states, 0);
+    for (size_t i = 1; i < num_all_states; i++)
     {
-        inverseBits[ bits[i] ] = (unsigned)i;
+        mask_sizes[i] = mask_sizes[i >> 1] + (i & 1);
     }
     
-    // assign state to each bit vector, sorted by numOn
-    size_t k = 0;
-    for (size_t i = 0; i < bitsByNumOn.size(); i++)
+    // assign state to each range mask, sorted by numOn
+    statesToMasks.clear();
+    statesToMasks.reserve(num_all_states);
+    for (size_t n = 0; n <= numCharacters; n++)
     {
-        for (size_t j = 0; j < bitsByNumOn[i].size(); j++)
+        for (size_t i = 0; i < num_all_states; i++)
         {
-            statesToBitsByNumOn[k++] = bitsByNumOn[i][j];
+            if (mask_sizes[i] == n)
+            {
+                statesToMasks.push_back( (unsigned)i );
+            }
         }
     }
     
-    for (size_t i = 0; i < statesToBitsByNumOn.size(); i++)
+    masksToStates = std::vector<unsigned>(num_all_states, 0);
+    for (size_t i = 0; i < statesToMasks.size(); i++)
     {
-        bitsToStatesByNumOn[ statesToBitsByNumOn[i] ] = (unsigned)i;
+        masksToStates[ statesToMasks[i] ] = (unsigned)i;
     }
     
-
-    
-}
-
-size_t RateMatrix_DECRateMatrix::numBitsOn(std::vector<unsigned> v)
-{
-    size_t n = 0;
-    for (size_t i = 0; i < v.size(); i++) {
-        n += v[i];
-    }
-    return n;
 }
 
 void RateMatrix_DECRateMatrix::makeTransitions(void)
@@ -589,44 +559,40 @@ void RateMatrix_DECRateMatrix::makeTransitions(void)
     lossOrGain.resize(num_states);
     transitionAreas.resize(num_states);
     changedAreas.resize(num_states);
-    affectingAreas.resize(num_states);
+    stateAreas.resize(num_states);
     
     // populate integer-valued transitions between states
     for (size_t i = 1; i < num_states; i++)
     {
-        std::vector<unsigned> b = statesToBitsByNumOn[i];
+        unsigned b = statesToMasks[i];
         
-        // each row has b.size() events (excluding i==0)
-        for (size_t j = 0; j < b.size(); j++)
+        for (size_t k = 0; k < numCharacters; k++)
+        {
+            if ( (b >> k) & 1 )
+            {
+                stateAreas[i].push_back((unsigned)k);
+            }
+        }
+        
+        // each row has numCharacters events (excluding i==0)
+        for (size_t j = 0; j < numCharacters; j++)
         {
-            std::vector<unsigned> tmp = b;
-            
             // change the range cfg at area j
-            tmp[j] = (b[j] == 0 ? 1 : 0);
+            unsigned tmp = b ^ (1u << j);
             
             // ignore events larger than maxRangeSize
-            if (numBitsOn(tmp) > maxRangeSize || numBitsOn(b) > maxRangeSize)
+            if (std::bitset<32>(tmp).count() > maxRangeSize || stateAreas[i].size() > maxRangeSize)
             {
                 continue;
             }
             
             // store integer-valued event
-            transitions[i].push_back(bitsToStatesByNumOn[tmp]);
+            transitions[i].push_back(masksToStates[tmp]);
             
             // is event a gain or a loss?
-            lossOrGain[i].push_back(tmp[j]);
+            lossOrGain[i].push_back( (tmp >> j) & 1 );
             
-            std::vector<unsigned> a;
-
             changedAreas[i].push_back((unsigned)j);
-            for (size_t k = 0; k < b.size(); k++)
-            {
-                if (b[k]==1)
-                {
-                    a.push_back((unsigned)k);
-                }
-            }
-            affectingAreas[i].push_back(a);
         }
     }
 }
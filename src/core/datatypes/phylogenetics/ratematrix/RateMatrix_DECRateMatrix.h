@@ -53,20 +53,16 @@ namespace RevBayesCore {
         void                                updateEigenSystem(void);                                                            //!< Update the system of eigenvalues and eigenvectors
         
         
-        size_t                                              numBitsOn(std::vector<unsigned> v);
-        void                                                makeBits(void);
+        void                                                makeMasks(void);
         void                                                makeTransitions(void);
         
-        std::vector<std::vector<unsigned> >                 bits;
-        std::map<std::vector<unsigned>, unsigned>           inverseBits;
-        std::vector<std::vector<std::vector<unsigned> > >   bitsByNumOn;
-        std::vector<std::vector<unsigned> >                 statesToBitsByNumOn;
-        std::map< std::vector<unsigned>, unsigned>          bitsToStatesByNumOn;
+        std::vector<unsigned>                               statesToMasks;                  //!< The range of each state as a bitmask over the areas, sorted by range size
+        std::vector<unsigned>                               masksToStates;                  //!< The state of each range bitmask
         std::vector<std::vector<unsigned> >                 transitions;
         std::vector<std::vector<unsigned> >                 lossOrGain;
         std::vector<std::vector<std::vector<unsigned> > >   transitionAreas;
         std::vector<std::vector<unsigned> >                 changedAreas;
-        std::vector<std::vector<std::vector<unsigned> > >   affectingAreas;
+        std::vector<std::vector<unsigned> >                 stateAreas;                     //!< The areas of each state, which affect all transitions leaving it
         size_t                                              numCharacters;
         size_t                                              num_states;
         bool                                                useSquaring;
@@ -66,8 +66,6 @@ class Assignable;
     private:
         void                                        buildRateMatrix(void);
         double                                      computeEntryFromMoranProcessWithSelection(size_t state1, size_t state2, double& count1);
-        void                                        computeExponentialMatrixByRepeatedSquaring(double t, TransitionProbabilityMatrix& P ) const;
-        inline void                                 squareMatrix( TransitionProbabilityMatrix& P, TransitionProbabilityMatrix& P2) const;
         
         
         size_t                                      N;                          //!< Number of individuals in idealized population
@@ -379,10 +379,10 @@ void RateMatrix_ReversiblePoMo::calculateTransitionProbabilities(double startAge
 {
 
 
-  // We use repeated squaring to quickly obtain exponentials, as in Poujol and Lartillot, Bioinformatics 2014.
-      // Mayrose et al. 2010 also used this method for chromosome evolution (named the squaring and scaling method in Moler and Van Loan 2003).
+  // The PoMo generators have only a few non-zero rates per row, so we exponentiate them by uniformization over these rates.
+  // This falls back to scaling and squaring (Moler and Van Loan 2003) when that is cheaper.
   double t = rate * (startAge - endAge);
-  exponentiateMatrixByScalingAndSquaring(t, P );
+  exponentiateSparseMatrix(t, P );
 
   //std::cout << "Transition probability matrix on branch of length "<<t<< " : " << P << std::endl;
 
@@ -0,0 +1,415 @@
+#include "CompactTopologyStore.h"
+
+#include <cmath>
+#include <algorithm>
+#include <limits>
+
+#include "RbConstants.h"
+#include "RbException.h"
+#include "RbMathLogic.h"
+#include "Taxon.h"
+#include "TopologyNode.h"
+#include "Tree.h"
+
+using namespace RevBayesCore;
+
+
+namespace {
+
+    // the flags of the nodes
+    const std::uint8_t USE_AGES            = 1 << 0;
+    const std::uint8_t SAMPLED_ANCESTOR    = 1 << 1;
+    const std::uint8_t BURST_SPECIATION    = 1 << 2;
+    const std::uint8_t SAMPLING_EVENT      = 1 << 3;
+    const std::uint8_t SERIAL_SAMPLING     = 1 << 4;
+    const std::uint8_t SERIAL_SPECIATION   = 1 << 5;
+
+    // the flags of the annotations
+    const std::uint8_t BRANCH_PARAMETER    = 1 << 0;
+    const std::uint8_t HAS_VALUE           = 1 << 1;
+
+    const std::uint32_t NO_TAXON = std::numeric_limits<std::uint32_t>::max();
+    const std::uint32_t NO_INDEX = std::numeric_limits<std::uint32_t>::max();
+
+
+    /** Compute the branch length from the ages in the same way as TopologyNode::recomputeBranchLength does. */
+    double recomputedBranchLength(const TopologyNode *parent, double age)
+    {
+        if ( parent == NULL )
+        {
+            return 0.0;
+        }
+        else if ( RbMath::isFinite( age ) == true )
+        {
+            return parent->getAge() - age;
+        }
+
+        return RbConstants::Double::nan;
+    }
+
+
+    /** Are the two times the same, including both being NaN? */
+    bool isSameTime(double a, double b)
+    {
+        return a == b || ( std::isnan( a ) && std::isnan( b ) );
+    }
+
+}
+
+
+CompactTopologyStore::CompactTopologyStore( void ) :
+    tree_offsets( 1, 0 ),
+    annotation_offsets( 1, 0 )
+{
+
+}
+
+
+/**
+ * Add a tree to the end of the store.
+ * We store the nodes in pre-order, so that the parent of a node is always stored before the node
+ * and the order of the children is kept.
+ */
+void CompactTopologyStore::addTree(const Tree &t)
+{
+
+    if ( t.getNumberOfNodes() >= std::numeric_limits<std::uint32_t>::max() )
+    {
+        throw RbException()<<"The tree with "<<t.getNumberOfNodes()<<" nodes is too large for the compact tree store.";
+    }
+
+    std::uint32_t num_stored = 0;
+    storeNode( t.getRoot(), 0, num_stored );
+
+    rooted.push_back( t.isRooted() );
+    negative_constraint.push_back( t.isNegativeConstraint() );
+
+    tree_offsets.push_back( parents.size() );
+    annotation_offsets.push_back( annotations.size() );
+}
+
+
+/**
+ * Store the comments of a node as annotations.
+ * The comments have the form 'name=value', and we intern the name as a column.
+ */
+void CompactTopologyStore::addAnnotations(const std::vector<std::string> &comments, std::uint32_t node, bool branch)
+{
+
+    for (size_t i = 0; i < comments.size(); ++i)
+    {
+        const std::string &comment = comments[i];
+        size_t equal_sign = comment.find( '=' );
+
+        Annotation a;
+        a.node          = node;
+        a.flags         = ( branch == true ? BRANCH_PARAMETER : 0 );
+        a.value_begin   = values.size();
+        a.value_length  = 0;
+
+        if ( equal_sign == std::string::npos )
+        {
+            a.column = getColumn( comment );
+        }
+        else
+        {
+            a.column = getColumn( comment.substr( 0, equal_sign ) );
+            a.flags |= HAS_VALUE;
+            a.value_length = std::uint32_t( comment.size() - equal_sign - 1 );
+            values.append( comment, equal_sign + 1, std::string::npos );
+        }
+
+        annotations.push_back( a );
+    }
+
+}
+
+
+void CompactTopologyStore::clear( void )
+{
+
+    tree_offsets.assign( 1, 0 );
+    rooted.clear();
+    negative_constraint.clear();
+    parents.clear();
+    indices.clear();
+    taxa.clear();
+    times.clear();
+    node_flags.clear();
+    other_times.clear();
+    shift_events.clear();
+    state_time_offsets.clear();
+    state_times.clear();
+
+    taxon_map = TaxonMap();
+
+    annotation_offsets.assign( 1, 0 );
+    annotations.clear();
+    columns.clear();
+    column_indices.clear();
+    values.clear();
+}
+
+
+/** Get the index of the column for the parameter with this name, adding the column if we have not seen the name yet. */
+std::uint32_t CompactTopologyStore::getColumn(const std::string &name)
+{
+
+    std::map<std::string, std::uint32_t>::const_iterator it = column_indices.find( name );
+    if ( it != column_indices.end() )
+    {
+        return it->second;
+    }
+
+    std::uint32_t index = std::uint32_t( columns.size() );
+    columns.push_back( name );
+    column_indices.insert( std::make_pair( name, index ) );
+
+    return index;
+}
+
+
+const TaxonMap& CompactTopologyStore::getTaxonMap( void ) const
+{
+
+    return taxon_map;
+}
+
+
+/**
+ * Create the i-th tree from the store.
+ * We restore the members of the nodes directly, so that the tree is identical to the tree we stored.
+ * The caller is responsible for deleting the tree.
+ */
+Tree* CompactTopologyStore::getTree(size_t i) const
+{
+
+    if ( i >= size() )
+    {
+        throw RbException()<<"Cannot get tree "<<i+1<<" from a store with "<<size()<<" trees.";
+    }
+
+    size_t begin = tree_offsets[i];
+    size_t end   = tree_offsets[i+1];
+
+    std::vector<TopologyNode*> nodes( end - begin, NULL );
+    for (size_t j = begin; j < end; ++j)
+    {
+        TopologyNode *node = new TopologyNode();
+        nodes[j-begin] = node;
+
+        if ( indices[j] != NO_INDEX )
+        {
+            node->index = size_t( indices[j] );
+        }
+        if ( taxa[j] != NO_TAXON )
+        {
+            node->taxon = taxon_map.getTaxon( taxa[j] );
+        }
+
+        std::uint8_t flags = node_flags[j];
+        node->use_ages          = ( flags & USE_AGES ) != 0;
+        node->sampled_ancestor  = ( flags & SAMPLED_ANCESTOR ) != 0;
+        node->burst_speciation  = ( flags & BURST_SPECIATION ) != 0;
+        node->sampling_event    = ( flags & SAMPLING_EVENT ) != 0;
+        node->serial_sampling   = ( flags & SERIAL_SAMPLING ) != 0;
+        node->serial_speciation = ( flags & SERIAL_SPECIATION ) != 0;
+
+        // the root is the first node, and all other parents come before their children
+        if ( j > begin )
+        {
+            TopologyNode *parent = nodes[ parents[j] ];
+            parent->children.push_back( node );
+            node->parent = parent;
+        }
+
+        if ( node->use_ages == true )
+        {
+            node->age           = times[j];
+            node->branch_length = recomputedBranchLength( node->parent, node->age );
+        }
+        else
+        {
+            node->age           = RbConstants::Double::nan;
+            node->branch_length = times[j];
+        }
+    }
+
+    // restore the times we could not recompute
+    std::vector< std::pair<size_t, double> >::const_iterator it = std::lower_bound( other_times.begin(), other_times.end(), std::make_pair( begin, -std::numeric_limits<double>::infinity() ) );
+    for ( ; it != other_times.end() && it->first < end; ++it)
+    {
+        TopologyNode *node = nodes[it->first - begin];
+        if ( node->use_ages == true )
+        {
+            node->branch_length = it->second;
+        }
+        else
+        {
+            node->age = it->second;
+        }
+    }
+
+    // restore the character history summaries
+    std::vector< std::pair<size_t, size_t> >::const_iterator shifts = std::lower_bound( shift_events.begin(), shift_events.end(), std::make_pair( begin, size_t(0) ) );
+    for ( ; shifts != shift_events.end() && shifts->first < end; ++shifts)
+    {
+        nodes[shifts->first - begin]->num_shift_events = shifts->second;
+    }
+    std::vector< std::pair<size_t, size_t> >::const_iterator state_time = std::lower_bound( state_time_offsets.begin(), state_time_offsets.end(), std::make_pair( begin, size_t(0) ) );
+    for ( ; state_time != state_time_offsets.end() && state_time->first < end; ++state_time)
+    {
+        size_t state_time_end = ( state_time + 1 == state_time_offsets.end() ? state_times.size() : (state_time + 1)->second );
+        nodes[state_time->first - begin]->time_in_states.assign( state_times.begin() + state_time->second, state_times.begin() + state_time_end );
+    }
+
+    // restore the node and branch parameters
+    for (size_t j = annotation_offsets[i]; j < annotation_offsets[i+1]; ++j)
+    {
+        const Annotation &a = annotations[j];
+
+        std::string comment = columns[a.column];
+        if ( ( a.flags & HAS_VALUE ) != 0 )
+        {
+            comment += "=";
+            comment.append( values, a.value_begin, a.value_length );
+        }
+
+        if ( ( a.flags & BRANCH_PARAMETER ) != 0 )
+        {
+            nodes[a.node]->branch_comments.push_back( comment );
+        }
+        else
+        {
+            nodes[a.node]->node_comments.push_back( comment );
+        }
+    }
+
+    Tree *t = new Tree();
+    t->setRoot( nodes[0], false );
+    t->setRooted( rooted[i] );
+    t->setNegativeConstraint( negative_constraint[i] );
+
+    return t;
+}
+
+
+/** Remove the last tree, e.g., if we added a tree that we should not have added. */
+void CompactTopologyStore::removeLastTree( void )
+{
+
+    if ( size() == 0 )
+    {
+        return;
+    }
+
+    size_t begin = tree_offsets[ size()-1 ];
+    tree_offsets.pop_back();
+    rooted.pop_back();
+    negative_constraint.pop_back();
+
+    parents.resize( begin );
+    indices.resize( begin );
+    taxa.resize( begin );
+    times.resize( begin );
+    node_flags.resize( begin );
+    while ( other_times.empty() == false && other_times.back().first >= begin )
+    {
+        other_times.pop_back();
+    }
+    while ( shift_events.empty() == false && shift_events.back().first >= begin )
+    {
+        shift_events.pop_back();
+    }
+    while ( state_time_offsets.empty() == false && state_time_offsets.back().first >= begin )
+    {
+        state_times.resize( state_time_offsets.back().second );
+        state_time_offsets.pop_back();
+    }
+
+    // we keep the taxa and columns, they may be used again by the next tree
+    annotation_offsets.pop_back();
+    annotations.resize( annotation_offsets.back() );
+    values.resize( annotations.empty() ? 0 : annotations.back().value_begin + annotations.back().value_length );
+}
+
+
+size_t CompactTopologyStore::size( void ) const
+{
+
+    return tree_offsets.size() - 1;
+}
+
+
+/** Store the node and, recursively, its subtree in pre-order. */
+void CompactTopologyStore::storeNode(const TopologyNode &n, std::uint32_t parent, std::uint32_t &num_stored)
+{
+
+    std::uint32_t position = num_stored;
+    ++num_stored;
+
+    parents.push_back( n.parent == NULL ? position : parent );
+    indices.push_back( n.index ? std::uint32_t( *n.index ) : NO_INDEX );
+
+    // only named nodes have a taxon that we need to keep
+    const Taxon &taxon = n.getTaxon();
+    if ( taxon.getName().empty() == true && taxon.getSpeciesName().empty() == true )
+    {
+        taxa.push_back( NO_TAXON );
+    }
+    else
+    {
+        if ( taxon_map.hasTaxon( taxon ) == false )
+        {
+            taxon_map.addTaxon( taxon );
+        }
+        taxa.push_back( std::uint32_t( taxon_map.getTaxonIndex( taxon ) ) );
+    }
+
+    std::uint8_t flags = 0;
+    flags |= ( n.use_ages          == true ? USE_AGES          : 0 );
+    flags |= ( n.sampled_ancestor  == true ? SAMPLED_ANCESTOR  : 0 );
+    flags |= ( n.burst_speciation  == true ? BURST_SPECIATION  : 0 );
+    flags |= ( n.sampling_event    == true ? SAMPLING_EVENT    : 0 );
+    flags |= ( n.serial_sampling   == true ? SERIAL_SAMPLING   : 0 );
+    flags |= ( n.serial_speciation == true ? SERIAL_SPECIATION : 0 );
+    node_flags.push_back( flags );
+
+    // we store the time the node uses, and the other time only if we cannot recompute it
+    size_t flat_position = times.size();
+    if ( n.use_ages == true )
+    {
+        times.push_back( n.age );
+        if ( isSameTime( n.branch_length, recomputedBranchLength( n.parent, n.age ) ) == false )
+        {
+            other_times.push_back( std::make_pair( flat_position, n.branch_length ) );
+        }
+    }
+    else
+    {
+        times.push_back( n.branch_length );
+        if ( std::isnan( n.age ) == false )
+        {
+            other_times.push_back( std::make_pair( flat_position, n.age ) );
+        }
+    }
+
+    if ( n.num_shift_events > 0 )
+    {
+        shift_events.push_back( std::make_pair( flat_position, n.num_shift_events ) );
+    }
+    if ( n.time_in_states.empty() == false )
+    {
+        state_time_offsets.push_back( std::make_pair( flat_position, state_times.size() ) );
+        state_times.insert( state_times.end(), n.time_in_states.begin(), n.time_in_states.end() );
+    }
+
+    addAnnotations( n.node_comments, position, false );
+    addAnnotations( n.branch_comments, position, true );
+
+    for (size_t i = 0; i < n.children.size(); ++i)
+    {
+        storeNode( *n.children[i], position, num_stored );
+    }
+
+}
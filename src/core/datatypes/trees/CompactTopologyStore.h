@@ -0,0 +1,95 @@
+#ifndef CompactTopologyStore_H
+#define CompactTopologyStore_H
+
+#include <stddef.h>
+#include <cstdint>
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "TaxonMap.h"
+
+namespace RevBayesCore {
+
+    class Tree;
+    class TopologyNode;
+
+
+    /**
+     * @brief Compact storage of many trees over the same taxa, e.g., the samples of a tree trace.
+     *
+     * A Tree object allocates every node on the heap, and every node stores its own taxon, comments and parameters.
+     * For a trace of many thousand trees the taxon names alone repeat in every sample.
+     * Here we store all trees in a few flat arrays instead:
+     * the nodes of each tree in pre-order, with the position of their parent, their index, their time and their flags.
+     * The taxa of the nodes are kept once in a shared TaxonMap and the node and branch parameters are stored
+     * as columns, i.e., the parameter name is interned and only the value is stored per node.
+     * We only store the time the tree uses (the age or the branch length); the other one is recomputed,
+     * unless it differs from what we would recompute, which we then store separately.
+     * The character history summaries of the nodes (time in states and number of shifts) are rarely set,
+     * so we store them separately for the nodes that have them.
+     *
+     * Trees are materialized into Tree objects only on demand.
+     *
+     * @copyright Copyright 2009-
+     * @author The RevBayes Development Core Team (Sebastian Hoehna)
+     * @since 2026-10-19, version 1.2
+     */
+    class CompactTopologyStore {
+
+    public:
+
+        CompactTopologyStore(void);
+
+        void                                        addTree(const Tree &t);                                     //!< Add a tree to the end of the store
+        void                                        clear(void);                                                //!< Remove all trees
+        Tree*                                       getTree(size_t i) const;                                    //!< Create the i-th tree; the caller owns it
+        const TaxonMap&                             getTaxonMap(void) const;                                    //!< Get the taxa of all the named nodes
+        void                                        removeLastTree(void);                                       //!< Remove the last tree
+        size_t                                      size(void) const;                                           //!< The number of trees
+
+    private:
+
+        /** A node or branch parameter of a node, as stored in the annotation columns */
+        struct Annotation {
+            std::uint32_t                           node;                                                       //!< The position of the node in its tree
+            std::uint32_t                           column;                                                     //!< The name of the parameter
+            size_t                                  value_begin;                                                //!< The start of the value in the value buffer
+            std::uint32_t                           value_length;                                               //!< The length of the value
+            std::uint8_t                            flags;                                                      //!< Whether this is a branch parameter, and whether it has a value
+        };
+
+        void                                        addAnnotations(const std::vector<std::string> &comments, std::uint32_t node, bool branch);
+        std::uint32_t                               getColumn(const std::string &name);
+        void                                        storeNode(const TopologyNode &n, std::uint32_t parent, std::uint32_t &num_stored);
+
+        // the topology and times of all trees, with the nodes of each tree in pre-order
+        std::vector<size_t>                         tree_offsets;                                               //!< The position of the first node of each tree (plus the end)
+        std::vector<bool>                           rooted;
+        std::vector<bool>                           negative_constraint;
+        std::vector<std::uint32_t>                  parents;                                                    //!< The position of the parent in the same tree (the root refers to itself)
+        std::vector<std::uint32_t>                  indices;                                                    //!< The index of the node in the tree
+        std::vector<std::uint32_t>                  taxa;                                                       //!< The index of the taxon in the taxon map, or NO_TAXON
+        std::vector<double>                         times;                                                      //!< The age if the node uses ages, and the branch length otherwise
+        std::vector<std::uint8_t>                   node_flags;
+        std::vector< std::pair<size_t, double> >    other_times;                                                //!< The other time for nodes where we cannot recompute it
+        std::vector< std::pair<size_t, size_t> >    shift_events;                                               //!< The number of shift events for nodes that have any
+        std::vector< std::pair<size_t, size_t> >    state_time_offsets;                                         //!< The start of the time in states for nodes that have any
+        std::vector<double>                         state_times;                                                //!< The time in states of these nodes, one after the other
+
+        // the shared taxa
+        TaxonMap                                    taxon_map;
+
+        // the node and branch parameters
+        std::vector<size_t>                         annotation_offsets;                                         //!< The position of the first annotation of each tree (plus the end)
+        std::vector<Annotation>                     annotations;
+        std::vector<std::string>                    columns;                                                    //!< The names of the parameters
+        std::map<std::string, std::uint32_t>        column_indices;
+        std::string                                 values;                                                     //!< The values of all parameters, one after the other
+
+    };
+
+}
+
+#endif
@@ -231,6 +231,8 @@ void TopologyNode::addChild(TopologyNode* c, size_t pos )
     // fire tree change event
     if ( tree != NULL )
     {
+        tree->flagTopologyChange( *this );
+        tree->flagTopologyChange( *c );
         tree->getTreeChangeEventHandler().fire( *c, RevBayesCore::TreeChangeEventMessage::TOPOLOGY );
     }
 }
@@ -963,6 +965,33 @@ std::vector<int> TopologyNode::getChildrenIndices() const
 }
 
 
+/**
+ * Get the hash of the clade below this node, i.e., the XOR of the hashes of the taxa below this node.
+ * The tree caches these hashes, so we ask the tree if we belong to one.
+ */
+std::uint64_t TopologyNode::getCladeHash( void ) const
+{
+
+    if ( tree != NULL )
+    {
+        return tree->getCladeHash( *this );
+    }
+
+    if ( isTip() == true )
+    {
+        return Tree::getTaxonHash( taxon.getName() );
+    }
+
+    std::uint64_t h = 0;
+    for ( std::vector<TopologyNode* >::const_iterator i=children.begin(); i!=children.end(); i++ )
+    {
+        h ^= (*i)->getCladeHash();
+    }
+
+    return h;
+}
+
+
 Clade TopologyNode::getClade( void ) const
 {
     Clade c;
@@ -1774,6 +1803,8 @@ size_t TopologyNode::removeChild(TopologyNode* c)
     // fire tree change event
     if ( tree != NULL )
     {
+        tree->flagTopologyChange( *this );
+        tree->flagTopologyChange( *c );
         tree->getTreeChangeEventHandler().fire( *c, RevBayesCore::TreeChangeEventMessage::TOPOLOGY );
         tree->getTreeChangeEventHandler().fire( *this, RevBayesCore::TreeChangeEventMessage::TOPOLOGY );
     }
@@ -1906,6 +1937,12 @@ void TopologyNode::setName(std::string const &n)
     taxon.setName( n );
     taxon.setSpeciesName( n );
 
+    // the clade hashes of the tree depend on the names of the taxa
+    if ( tree != NULL )
+    {
+        tree->resetCladeHashes();
+    }
+
 }
 
 
@@ -1988,6 +2025,12 @@ void TopologyNode::setTaxon(Taxon const &t)
 
     taxon = t;
 
+    // the clade hashes of the tree depend on the names of the taxa
+    if ( tree != NULL )
+    {
+        tree->resetCladeHashes();
+    }
+
 }
 
 
@@ -43,6 +43,7 @@
 #include "TreeChangeEventMessage.h"
 #include "Taxon.h"
 
+#include <cstdint>
 #include <vector>
 #include <map>
 #include <string>
@@ -54,6 +55,9 @@ namespace RevBayesCore {
     
     class TopologyNode  {
         
+        // the compact store reads and restores the members of the nodes directly
+        friend class CompactTopologyStore;
+
     public:
         TopologyNode();                                                                                                                 //!< Default constructor with no index
         TopologyNode(size_t indx);                                                                                                      //!< Default constructor with index
@@ -100,6 +104,7 @@ namespace RevBayesCore {
         const std::vector<TopologyNode*>&           getChildren(void) const;
         std::vector<int>                            getChildrenIndices(void) const;                                                     //!< Return children indices
         Clade                                       getClade(void) const;                                                               //!< Get the clade this node represents
+        std::uint64_t                               getCladeHash(void) const;                                                           //!< Get the hash of the taxa below this node
         bool                                        hasIndex(void) const;                                                               //!< Does the node have an index
         size_t                                      getIndex(void) const;                                                               //!< Get index of node
         void                                        getIndicesOfNodesInSubtree(bool countTips, std::vector<size_t>* indices) const;                                                               //!< Get index of node
@@ -23,12 +23,35 @@
 #include "StringUtilities.h"
 #include "TaxonMap.h"
 #include "TreeChangeEventHandler.h"
+#include "TreeChangeEventMessage.h"
 
 namespace RevBayesCore { class AbstractHomologousDiscreteCharacterData; }
 namespace RevBayesCore { class TreeChangeEventListener; }
 
 using namespace RevBayesCore;
 
+
+namespace {
+
+    /** The finalizer of splitmix64, which spreads the bits of a 64-bit integer over the whole word. */
+    std::uint64_t mixHash(std::uint64_t x)
+    {
+        x ^= x >> 30;
+        x *= 0xbf58476d1ce4e5b9ULL;
+        x ^= x >> 27;
+        x *= 0x94d049bb133111ebULL;
+        x ^= x >> 31;
+
+        return x;
+    }
+
+    // the salts that distinguish the hash of a rooted topology from the unrooted topology with the same clades
+    const std::uint64_t ROOTED_TOPOLOGY_SALT    = 0x9e3779b97f4a7c15ULL;
+    const std::uint64_t UNROOTED_TOPOLOGY_SALT  = 0x6a09e667f3bcc909ULL;
+
+}
+
+
 /* Copy constructor */
 Tree::Tree(const Tree& t) :
     changeEventHandler( ),
@@ -104,6 +127,12 @@ Tree& Tree::operator=(const Tree &t)
         // do not reorder node indices when copying (WP)
         setRoot(newRoot, false);
 
+        // the listeners stay with this tree, so we need to tell them that every node may have changed
+        for (size_t i = 0; i < nodes.size(); ++i)
+        {
+            changeEventHandler.fire( *nodes[i], TreeChangeEventMessage::TOPOLOGY );
+        }
+
     }
 
     return *this;
@@ -137,6 +166,9 @@ Tree& Tree::operator=(Tree&& t)
 
         for(auto& node: t.nodes)
             node->setTree(&t);
+
+        resetCladeHashes();
+        t.resetCladeHashes();
     }
 
     return *this;
@@ -600,6 +632,33 @@ void Tree::fillNodesByPhylogeneticTraversal(TopologyNode* node)
     }
 }
 
+/**
+ * The children of this node changed, e.g., by a topology move.
+ * We only remember the node here and recompute the clade hashes of the node and its ancestors when they are needed next,
+ * because the tree may be in an intermediate state while the move rearranges the nodes.
+ */
+void Tree::flagTopologyChange(const TopologyNode &n)
+{
+
+    if ( clade_hashes_valid == false )
+    {
+        return;
+    }
+
+    // nodes that are not (yet) part of the nodes vector require a complete update,
+    // and so does a long list of changes since the last update
+    if ( n.hasIndex() == false || n.getIndex() >= nodes.size() || nodes[n.getIndex()] != &n || topology_changes.size() > nodes.size() )
+    {
+        resetCladeHashes();
+    }
+    else
+    {
+        topology_changes.push_back( n.getIndex() );
+    }
+
+}
+
+
 const std::vector<std::vector<double> > Tree::getAdjacencyMatrix(void) const
 {
     std::vector<std::vector<double> > adjacency(num_nodes, std::vector<double>(num_nodes, 0.0));
@@ -768,6 +827,57 @@ std::map<RbBitSet, TopologyNode*> Tree::getBitsetToNodeMap(void) const
 }
 
 
+/**
+ * Get the hash of the clade with these taxa.
+ * The bits of the bitset are the indices of the taxa in the taxon bitset map, as for TopologyNode::getTaxa.
+ */
+std::uint64_t Tree::getCladeHash(const RbBitSet &taxa) const
+{
+
+    std::uint64_t h = 0;
+
+    const std::map<std::string, size_t> &taxon_map = getTaxonBitSetMap();
+    for (std::map<std::string, size_t>::const_iterator it = taxon_map.begin(); it != taxon_map.end(); ++it)
+    {
+        if ( it->second < taxa.size() && taxa.test( it->second ) == true )
+        {
+            h ^= getTaxonHash( it->first );
+        }
+    }
+
+    return h;
+}
+
+
+/**
+ * Get the hash of the clade below this node, i.e., the XOR of the hashes of all taxa below the node.
+ * Two nodes of trees over the same taxa have the same hash iff they have the same clade (up to hash collisions).
+ * The hashes of the nodes of this tree are cached and updated incrementally after topology changes.
+ */
+std::uint64_t Tree::getCladeHash(const TopologyNode &n) const
+{
+
+    if ( updateCladeHashes() == true && n.hasIndex() == true && n.getIndex() < nodes.size() && nodes[n.getIndex()] == &n )
+    {
+        return clade_hashes[ n.getIndex() ];
+    }
+
+    // the node is not part of this tree (anymore), so we compute the hash directly
+    if ( n.isTip() == true )
+    {
+        return getTaxonHash( n.getTaxon().getName() );
+    }
+
+    std::uint64_t h = 0;
+    for (size_t i = 0; i < n.getNumberOfChildren(); ++i)
+    {
+        h ^= getCladeHash( n.getChild( i ) );
+    }
+
+    return h;
+}
+
+
 std::vector<long> Tree::getNodeIndices(void) const
 {
     std::vector<long> indices;
@@ -889,6 +999,75 @@ std::string Tree::getSimmapNewickRepresentation(bool round) const
 }
 
 
+/**
+ * Get the hash of the split below node i, if it is a non-trivial split.
+ * For rooted trees, these are the clades of the interior nodes except the root.
+ * For unrooted trees, a clade and its complement are the same split, so we use the smaller of the two hashes,
+ * and we skip the splits of a single taxon. The two children of a bifurcating root have the same split,
+ * so we only use the first child.
+ */
+bool Tree::getSplitHash(size_t i, bool rooted_split, std::uint64_t &h) const
+{
+
+    const TopologyNode &n = *nodes[i];
+    if ( n.isRoot() == true || n.isTip() == true )
+    {
+        return false;
+    }
+
+    h = clade_hashes[i];
+    if ( rooted_split == true )
+    {
+        return true;
+    }
+
+    size_t root_index = root->getIndex();
+    size_t n_taxa = clade_sizes[root_index];
+    if ( clade_sizes[i] < 2 || clade_sizes[i] + 2 > n_taxa )
+    {
+        return false;
+    }
+
+    const TopologyNode &parent = n.getParent();
+    if ( parent.isRoot() == true && parent.getNumberOfChildren() == 2 && &parent.getChild( 1 ) == &n )
+    {
+        return false;
+    }
+
+    h = std::min( h, h ^ clade_hashes[root_index] );
+
+    return true;
+}
+
+
+/**
+ * Get the sorted hashes of the non-trivial splits of this tree (see getSplitHash).
+ * The Robinson-Foulds distance between two trees is the size of the symmetric difference of their split hashes,
+ * which we can compute in linear time by merging the sorted vectors.
+ */
+std::vector<std::uint64_t> Tree::getSplitHashes( void ) const
+{
+
+    if ( updateCladeHashes() == false )
+    {
+        throw RbException("Problem while working with tree: The nodes are not ordered by their index.");
+    }
+
+    std::vector<std::uint64_t> splits;
+    for (size_t i = 0; i < nodes.size(); ++i)
+    {
+        std::uint64_t h = 0;
+        if ( getSplitHash( i, rooted, h ) == true )
+        {
+            splits.push_back( h );
+        }
+    }
+    std::sort( splits.begin(), splits.end() );
+
+    return splits;
+}
+
+
 /**
  * Get all the species names for this topology.
  * This might include duplicates.
@@ -952,6 +1131,25 @@ const std::map<std::string, size_t>& Tree::getTaxonBitSetMap( void ) const
     return taxon_bitset_map;
 }
 
+/**
+ * Get the hash of a taxon for the clade hashes.
+ * The hash only depends on the name of the taxon, so that we can compare the clade hashes of different trees.
+ */
+std::uint64_t Tree::getTaxonHash(const std::string &name)
+{
+
+    // FNV-1a over the characters of the name
+    std::uint64_t h = 0xcbf29ce484222325ULL;
+    for (size_t i = 0; i < name.size(); ++i)
+    {
+        h ^= static_cast<unsigned char>( name[i] );
+        h *= 0x100000001b3ULL;
+    }
+
+    return mixHash( h );
+}
+
+
 /**
  * Get the tip index for this name.
  */
@@ -1101,6 +1299,33 @@ double Tree::getTmrca(const std::vector<Taxon> &t)
 }
 
 
+/**
+ * Get a hash of the topology of this tree.
+ * The hash is the sum of the mixed hashes of all splits (see getSplitHash) and of the taxa,
+ * so it does not depend on the order of the children.
+ * We keep the sums up to date with the clade hashes, so this is constant time unless the topology changed.
+ */
+std::uint64_t Tree::getTopologyHash( void ) const
+{
+
+    if ( updateCladeHashes() == false )
+    {
+        throw RbException("Problem while working with tree: The nodes are not ordered by their index.");
+    }
+
+    std::uint64_t taxa_hash = clade_hashes[ root->getIndex() ];
+    if ( rooted == true )
+    {
+        return mixHash( taxa_hash ^ ROOTED_TOPOLOGY_SALT ) + rooted_split_sum;
+    }
+    else
+    {
+        return mixHash( taxa_hash ^ UNROOTED_TOPOLOGY_SALT ) + unrooted_split_sum;
+    }
+
+}
+
+
 TreeChangeEventHandler& Tree::getTreeChangeEventHandler( void ) const
 {
 
@@ -1133,6 +1358,15 @@ double Tree::getTreeLength( void ) const
 bool Tree::hasSameTopology(const Tree &t) const
 {
 
+    // trees with the same newick string have the same clades, so different clade hashes are a quick rejection
+    if ( root != NULL && t.root != NULL && updateCladeHashes() == true && t.updateCladeHashes() == true )
+    {
+        if ( clade_hashes[ root->getIndex() ] != t.clade_hashes[ t.root->getIndex() ] || rooted_split_sum != t.rooted_split_sum )
+        {
+            return false;
+        }
+    }
+
     std::string a = getPlainNewickRepresentation();
     std::string b = t.getPlainNewickRepresentation();
 
@@ -1397,6 +1631,7 @@ void Tree::orderNodesByIndex( void )
 
     nodes = nodes_copy;
 
+    resetCladeHashes();
 }
 
 // Prints tree for user (rounding)
@@ -1579,6 +1814,8 @@ void Tree::reindexNodes()
     }
 
     num_nodes = nodes.size();
+
+    resetCladeHashes();
 }
 
 void Tree::removeDegree2Node(TopologyNode* n)
@@ -1679,6 +1916,19 @@ void Tree::removeDuplicateTaxa( void )
 }
 
 
+/**
+ * Forget all clade hashes, so that we recompute them when they are needed next.
+ * This is necessary when the taxa or the indices of the nodes changed.
+ */
+void Tree::resetCladeHashes( void )
+{
+
+    clade_hashes_valid = false;
+    topology_changes.clear();
+
+}
+
+
 void Tree::renameNodeParameter(const std::string &old_name, const std::string &new_name)
 {
     getRoot().renameNodeParameter(old_name, new_name);
@@ -1805,6 +2055,7 @@ void Tree::reroot(TopologyNode &n, bool make_bifurcating, bool reindex)
 void Tree::resetTaxonBitSetMap( void )
 {
     taxon_bitset_map.clear();
+    resetCladeHashes();
     
     // get all taxon names
     std::vector<Taxon> unordered_taxa = getTaxa();
@@ -1879,6 +2130,7 @@ void Tree::setRoot( TopologyNode* r, bool reindex )
     root = r;
 
     nodes.clear();
+    resetCladeHashes();
 
     // bootstrap all nodes from the root and add the in a pre-order traversal
     fillNodesByPhylogeneticTraversal(r);
@@ -1994,6 +2246,7 @@ void Tree::setTaxonName(const std::string& current_name, const std::string& new_
     TopologyNode& node = getTipNodeWithName( current_name );
     Taxon& t = node.getTaxon();
     t.setName( new_name );
+    resetCladeHashes();
     taxon_bitset_map.erase( current_name );
     taxon_bitset_map.insert( std::pair<std::string, size_t>( new_name, node.getIndex() ) );
 }
@@ -2012,6 +2265,7 @@ void Tree::setTaxonObject(const std::string& current_name, const Taxon& new_taxo
 
     TopologyNode& node = getTipNodeWithName( current_name );
     node.setTaxon( new_taxon );
+    resetCladeHashes();
 
     taxon_bitset_map.erase( current_name );
     taxon_bitset_map.insert( std::pair<std::string, size_t>( new_name, node.getIndex() ) );
@@ -2082,6 +2336,158 @@ void Tree::writeToFile( const path &dir, const std::string &fn ) const
 }
 
 
+/**
+ * Recompute the hash of the clade below this node, recursing into the children that need an update.
+ * If all is true, we recompute the hashes of all nodes below this node.
+ */
+std::uint64_t Tree::updateCladeHash(const TopologyNode &n, bool all) const
+{
+
+    size_t i = n.getIndex();
+    if ( all == false && clade_hash_dirty[i] == false )
+    {
+        return clade_hashes[i];
+    }
+
+    std::uint64_t h = 0;
+    size_t size = 0;
+    if ( n.isTip() == true )
+    {
+        h = getTaxonHash( n.getTaxon().getName() );
+        size = 1;
+    }
+    else
+    {
+        for (size_t j = 0; j < n.getNumberOfChildren(); ++j)
+        {
+            const TopologyNode &child = n.getChild( j );
+            h ^= updateCladeHash( child, all );
+            size += clade_sizes[ child.getIndex() ];
+        }
+    }
+
+    clade_hashes[i] = h;
+    clade_sizes[i] = size;
+
+    return h;
+}
+
+
+/**
+ * Bring the clade hashes and the topology hash sums up to date.
+ * After topology changes we only recompute the changed nodes and their ancestors,
+ * otherwise (e.g., after a new root was set) we recompute all nodes.
+ * We return false if we cannot use the cache because the nodes are not ordered by their index.
+ */
+bool Tree::updateCladeHashes( void ) const
+{
+
+    if ( root == NULL )
+    {
+        return false;
+    }
+
+    std::vector<size_t> changed_nodes;
+    if ( clade_hashes_valid == true && clade_hashes.size() == nodes.size() )
+    {
+        if ( topology_changes.empty() == true )
+        {
+            return true;
+        }
+
+        size_t root_index = root->getIndex();
+        std::uint64_t taxa_hash = clade_hashes[root_index];
+        size_t n_taxa = clade_sizes[root_index];
+
+        // flag the changed nodes and all their ancestors
+        for (size_t i = 0; i < topology_changes.size() && clade_hashes_valid == true; ++i)
+        {
+            const TopologyNode *n = nodes[ topology_changes[i] ];
+            while ( n != NULL )
+            {
+                if ( n->hasIndex() == false || n->getIndex() >= nodes.size() || nodes[n->getIndex()] != n )
+                {
+                    clade_hashes_valid = false;
+                    break;
+                }
+                if ( clade_hash_dirty[ n->getIndex() ] == true )
+                {
+                    break;
+                }
+                clade_hash_dirty[ n->getIndex() ] = true;
+                changed_nodes.push_back( n->getIndex() );
+                n = ( n->isRoot() == true ? NULL : &n->getParent() );
+            }
+        }
+        topology_changes.clear();
+
+        if ( clade_hashes_valid == true )
+        {
+            updateCladeHash( *root, false );
+
+            // the unrooted splits of all nodes depend on the taxa of the tree, so if they changed we need to start over
+            if ( root->getIndex() != root_index || clade_hashes[root_index] != taxa_hash || clade_sizes[root_index] != n_taxa )
+            {
+                clade_hashes_valid = false;
+            }
+        }
+    }
+
+    if ( clade_hashes_valid == false || clade_hashes.size() != nodes.size() )
+    {
+        for (size_t i = 0; i < nodes.size(); ++i)
+        {
+            if ( nodes[i]->hasIndex() == false || nodes[i]->getIndex() != i )
+            {
+                return false;
+            }
+        }
+
+        clade_hashes            = std::vector<std::uint64_t>( nodes.size(), 0 );
+        clade_sizes             = std::vector<size_t>( nodes.size(), 0 );
+        clade_hash_dirty        = std::vector<bool>( nodes.size(), false );
+        rooted_split_terms      = std::vector<std::uint64_t>( nodes.size(), 0 );
+        unrooted_split_terms    = std::vector<std::uint64_t>( nodes.size(), 0 );
+        rooted_split_sum        = 0;
+        unrooted_split_sum      = 0;
+        topology_changes.clear();
+
+        updateCladeHash( *root, true );
+
+        changed_nodes.clear();
+        for (size_t i = 0; i < nodes.size(); ++i)
+        {
+            changed_nodes.push_back( i );
+        }
+        clade_hashes_valid = true;
+    }
+
+    // whether a child of the root counts as a split depends on the other children of the root
+    for (size_t i = 0; i < root->getNumberOfChildren(); ++i)
+    {
+        changed_nodes.push_back( root->getChild( i ).getIndex() );
+    }
+
+    // the split of the changed nodes may have changed, so we replace their terms in the topology hashes
+    for (size_t i = 0; i < changed_nodes.size(); ++i)
+    {
+        size_t j = changed_nodes[i];
+        clade_hash_dirty[j] = false;
+
+        std::uint64_t h = 0;
+        std::uint64_t rooted_term   = ( getSplitHash( j, true, h )  == true ? mixHash( h ) : 0 );
+        std::uint64_t unrooted_term = ( getSplitHash( j, false, h ) == true ? mixHash( h ) : 0 );
+
+        rooted_split_sum   += rooted_term - rooted_split_terms[j];
+        unrooted_split_sum += unrooted_term - unrooted_split_terms[j];
+        rooted_split_terms[j]   = rooted_term;
+        unrooted_split_terms[j] = unrooted_term;
+    }
+
+    return true;
+}
+
+
 std::ostream& RevBayesCore::operator<<(std::ostream& o, const Tree& x)
 {
 
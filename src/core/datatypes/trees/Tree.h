@@ -29,6 +29,7 @@
 #include "TreeChangeEventHandler.h"
 #include "Printable.h"
 
+#include <cstdint>
 #include <vector>
 #include <string>
 
@@ -76,7 +77,10 @@ namespace RevBayesCore {
         void                                                executeMethod(const std::string &n, const std::vector<const DagNode*> &args, double &rv) const;     //!< Map the member methods to internal function calls
         void                                                executeMethod(const std::string &n, const std::vector<const DagNode*> &args, long &rv) const;       //!< Map the member methods to internal function calls
         void                                                executeMethod(const std::string &n, const std::vector<const DagNode*> &args, Boolean &rv) const;    //!< Map the member methods to internal function calls
+        void                                                flagTopologyChange(const TopologyNode &n);                                                          //!< The children of this node changed
         std::map<RbBitSet, TopologyNode*>                   getBitsetToNodeMap(void) const;                                                                     //!< Get a map between node bitsets and nodes in the Tree
+        std::uint64_t                                       getCladeHash(const RbBitSet &taxa) const;                                                           //!< Get the hash of the clade with these taxa (using the taxon bitset map)
+        std::uint64_t                                       getCladeHash(const TopologyNode &n) const;                                                          //!< Get the hash of the clade below this node
         std::vector<Taxon>                                  getFossilTaxa() const;                                                                              //!< Get all the taxa in the tree
         const TopologyNode&                                 getMrca(const TopologyNode &n) const;
         TopologyNode&                                       getMrca(const Clade &c);
@@ -102,9 +106,11 @@ namespace RevBayesCore {
         const TopologyNode&                                 getRoot(void) const;                                                                                //!< Get a pointer to the root node of the Tree
         std::string                                         getSimmapNewickRepresentation(bool round = true ) const;                                            //!< Get the SIMMAP and phytools compatible newick representation of this Tree
         std::vector<std::string>                            getSpeciesNames() const;                                                                            //!< Get all the species represented in the tree
+        std::vector<std::uint64_t>                          getSplitHashes(void) const;                                                                         //!< Get the sorted hashes of the non-trivial clades (rooted) or splits (unrooted)
         std::vector<Taxon>                                  getTaxa() const;                                                                                    //!< Get all the taxa in the tree
 
         const std::map<std::string, size_t>&                getTaxonBitSetMap(void) const;                                                                      //!< Returns a map that holds the BitSet index for each taxon
+        static std::uint64_t                                getTaxonHash(const std::string &name);                                                              //!< Get the hash of a taxon used for the clade hashes
         size_t                                              getTipIndex(const std::string &name) const;
         std::vector<std::string>                            getTipNames() const;
         TopologyNode&                                       getTipNode(size_t indx);                                                                            //!< Get a pointer to tip node i
@@ -115,6 +121,7 @@ namespace RevBayesCore {
         double                                              getTmrca(const TopologyNode& n);
         double                                              getTmrca(const Clade& c);
         double                                              getTmrca(const std::vector<Taxon>& t);
+        std::uint64_t                                       getTopologyHash(void) const;                                                                        //!< Get a hash of the (rooted or unrooted) topology
         TreeChangeEventHandler&                             getTreeChangeEventHandler(void) const;                                                              //!< Get the change-event handler for this tree
         double                                              getTreeLength(void) const;
         bool                                                hasSameTopology(const Tree &t) const;                                                             //!< Has this tree the same topology?
@@ -140,6 +147,7 @@ namespace RevBayesCore {
         bool                                                removeNodeIfDegree2(TopologyNode& n);
         bool                                                removeRootIfDegree2();
         void                                                renameNodeParameter(const std::string &old_name, const std::string &new_name);
+        void                                                resetCladeHashes(void);                                                                             //!< Recompute all clade hashes next time, e.g., after renaming a taxon
         void                                                resetTaxonBitSetMap(void);                                                                          //!< Resets the map that holds the BitSet index for each taxon
         TopologyNode&                                       reverseParentChild(TopologyNode &n);                                                                //!< Reverse the parent child relationship.
         void                                                setNegativeConstraint(bool);
@@ -159,8 +167,11 @@ namespace RevBayesCore {
 //    private:
 
         void                                                fillNodesByPhylogeneticTraversal(TopologyNode* node);               //!< fill the nodes vector by a preorder traversal recursively starting with this node.
+        bool                                                getSplitHash(size_t i, bool rooted, std::uint64_t &h) const;        //!< Get the hash of the split of node i, if it is a non-trivial split
         bool                                                recursivelyPruneTaxa(TopologyNode*, const RbBitSet&);
         void                                                reindexNodes();
+        std::uint64_t                                       updateCladeHash(const TopologyNode &n, bool all) const;
+        bool                                                updateCladeHashes(void) const;                                      //!< Bring the clade hashes up to date; false if the nodes are not ordered by index
 
         // private members
         TopologyNode*                                       root = nullptr;
@@ -171,6 +182,17 @@ namespace RevBayesCore {
         size_t                                              num_nodes = 0;
         mutable std::map<std::string, size_t>               taxon_bitset_map;
 
+        // the clade hashes, by node index. The hash of a clade is the XOR of the hashes of its taxa.
+        mutable std::vector<std::uint64_t>                  clade_hashes;
+        mutable std::vector<size_t>                         clade_sizes;                                                            //!< The number of tips below each node
+        mutable std::vector<bool>                           clade_hash_dirty;
+        mutable std::vector<std::uint64_t>                  rooted_split_terms;                                                     //!< The term of each node in the rooted topology hash
+        mutable std::vector<std::uint64_t>                  unrooted_split_terms;                                                   //!< The term of each node in the unrooted topology hash
+        mutable std::uint64_t                               rooted_split_sum = 0;
+        mutable std::uint64_t                               unrooted_split_sum = 0;
+        mutable bool                                        clade_hashes_valid = false;                                             //!< False if we need to recompute all clade hashes
+        mutable std::vector<size_t>                         topology_changes;                                                       //!< The indices of the nodes whose children changed since the last update
+
     };
 
     // Global functions using the class
@@ -516,12 +516,12 @@ void RevBayesCore::GeneralTreeHistoryCtmc<charType>::initializeTipValues( void )
             TopologyNode* node = nodes[i];
             if ( node->isTip() == true )
             {
-                DiscreteTaxonData<charType>& d = static_cast< DiscreteTaxonData<charType>& >( this->value->getTaxonData( node->getName() ) );
+                const DiscreteTaxonData<charType>& d = static_cast< const DiscreteTaxonData<charType>& >( this->value->getTaxonData( node->getName() ) );
                 
                 std::vector<CharacterEvent*> tipState;
                 for (size_t j = 0; j < d.getNumberOfCharacters(); ++j)
                 {
-                    DiscreteCharacterState &state = d[j];
+                    const DiscreteCharacterState &state = d[j];
                     unsigned s = 0;
                     
                     s = (unsigned) state.getStateIndex();
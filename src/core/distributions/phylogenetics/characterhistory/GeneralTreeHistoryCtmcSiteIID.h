@@ -3,6 +3,7 @@
 
 #include "TreeHistoryCtmc.h"
 
+#include "AbstractRateMatrix.h"
 #include "ConstantNode.h"
 #include "DiscreteCharacterState.h"
 #include "HomologousDiscreteCharacterData.h"
@@ -188,6 +189,35 @@ double RevBayesCore::GeneralTreeHistoryCtmcSiteIID<charType>::computeInternalNod
     double branch_rate = this->getBranchRate(node_index);
     const RateGenerator& rm = homogeneousRateGenerator->getValue();
 
+    // a rate matrix is time-homogeneous, so the branch likelihood only depends on the transition counts
+    // and the times spent in each state, which are kept until the history or the node ages change
+    if ( dynamic_cast<const AbstractRateMatrix*>( &rm ) != NULL )
+    {
+        const typename TreeHistoryCtmc<charType>::BranchHistoryStatistics& stats = this->getBranchHistoryStatistics(node);
+        if ( stats.consistent == false )
+        {
+            return RbConstants::Double::neginf;
+        }
+
+        double lnL = 0.0;
+        for (size_t i = 0; i < this->num_states; ++i)
+        {
+            for (size_t j = 0; j < this->num_states; ++j)
+            {
+                size_t n = stats.transition_counts[i * this->num_states + j];
+                if ( n > 0 )
+                {
+                    lnL += n * log( rm.getRate(i, j, 0.0, branch_rate) );
+                }
+            }
+
+            // the diagonal holds the negative rate of leaving state i
+            lnL += rm.getRate(i, i, 0.0, 1.0) * branch_rate * stats.time_in_states[i];
+        }
+
+        return lnL;
+    }
+
     // get the branch history
     BranchHistory* bh = this->histories[node_index];
 
@@ -201,13 +231,13 @@ double RevBayesCore::GeneralTreeHistoryCtmcSiteIID<charType>::computeInternalNod
     // check parent and child states to make sure they match with the
     // ancestral and descendant branches; otherwise, return -Inf
     std::vector<CharacterEvent*> curr_state = bh->getParentCharacters();
-    std::vector<CharacterEvent*> end_state  = bh->getChildCharacters();
+    const std::vector<CharacterEvent*>& end_state = bh->getChildCharacters();
     for (size_t i = 0; i < node.getNumberOfChildren(); ++i)
     {
         const TopologyNode &child = node.getChild(i);
         size_t child_index = child.getIndex();
         BranchHistory* child_bh = this->histories[child_index];
-        std::vector<CharacterEvent*> child_state = child_bh->getParentCharacters();
+        const std::vector<CharacterEvent*>& child_state = child_bh->getParentCharacters();
         for (size_t j = 0; j < this->num_sites; ++j)
         {
             if ( static_cast<CharacterEventDiscrete*>(end_state[j])->getState() != static_cast<CharacterEventDiscrete*>(child_state[j])->getState() )
@@ -371,12 +401,12 @@ void RevBayesCore::GeneralTreeHistoryCtmcSiteIID<charType>::initializeTipValues(
             TopologyNode* node = nodes[i];
             if ( node->isTip() == true )
             {
-                DiscreteTaxonData<charType>& d = static_cast< DiscreteTaxonData<charType>& >( this->value->getTaxonData( node->getName() ) );
+                const DiscreteTaxonData<charType>& d = static_cast< const DiscreteTaxonData<charType>& >( this->value->getTaxonData( node->getName() ) );
 
                 std::vector<CharacterEvent*> tipState;
                 for (size_t j = 0; j < d.getNumberOfCharacters(); ++j)
                 {
-                    DiscreteCharacterState &state = d[j];
+                    const DiscreteCharacterState &state = d[j];
                     unsigned s = 0;
 
                     s = (unsigned) state.getStateIndex();
@@ -78,12 +78,26 @@ namespace RevBayesCore {
 
     protected:
 
+        /**
+         * Sufficient statistics of the character history along one branch, summed over all sites.
+         * Under a time-homogeneous rate matrix the branch likelihood only depends on these numbers,
+         * so they survive any change of the substitution parameters and are only recomputed when
+         * the history itself, or the ages of the branch, change.
+         */
+        struct BranchHistoryStatistics {
+            bool                                                            consistent;                                     //!< Are the event ages and the states at the branch ends compatible with the tree?
+            std::vector<size_t>                                             transition_counts;                              //!< Number of i->j events, stored at index i*num_states+j
+            std::vector<double>                                             time_in_states;                                 //!< Total time (over all sites) spent in each state
+        };
+
         // Parameter management functions.
         virtual void                                                        swapParameterInternal(const DagNode *oldP, const DagNode *newP);            //!< Swap a parameter
 
         // helper method for this and derived classes
         void                                                                flagNodeDirty(const TopologyNode& n);
         double                                                              computeBranchRate(size_t index);
+        void                                                                flagBranchHistoryStatisticsDirty(const TopologyNode& n);
+        const BranchHistoryStatistics&                                      getBranchHistoryStatistics(const TopologyNode& n);
 
         // virtual methods that may be overwritten, but then the derived class should call this methods
         virtual void                                                        keepSpecialization(const DagNode* affecter);
@@ -115,6 +129,8 @@ namespace RevBayesCore {
         // convenience variables available for derived classes too
         std::vector<bool>                                                   changedNodes;
         std::vector<bool>                                                   dirtyNodes;
+        std::vector<BranchHistoryStatistics>                                branchStatistics;
+        std::vector<bool>                                                   dirtyBranchStatistics;
 
         // flags
         bool                                                                usingAmbiguousCharacters;
@@ -139,6 +155,7 @@ namespace RevBayesCore {
         const TypedDagNode< RbVector< double > >*           siteRatesProbs;
         
         // private methods
+        void                                                                computeBranchHistoryStatistics(const TopologyNode &n, BranchHistoryStatistics &stats) const;
         void                                                                fillLikelihoodVector(const TopologyNode &n);
         void                                                                initializeHistoriesVector(void);
         virtual void                                                        simulate(const TopologyNode& node, BranchHistory* bh, std::vector<DiscreteTaxonData< charType > >& taxa) = 0;
@@ -161,6 +178,8 @@ RevBayesCore::TreeHistoryCtmc<charType>::TreeHistoryCtmc(const TypedDagNode<Tree
     histories(),
     changedNodes( std::vector<bool>(tau->getValue().getNumberOfNodes(),false) ),
     dirtyNodes( std::vector<bool>(tau->getValue().getNumberOfNodes(), true) ),
+    branchStatistics(),
+    dirtyBranchStatistics(),
     usingAmbiguousCharacters( useAmbigChar ),
     treatUnknownAsGap( true ),
     treatAmbiguousAsGaps( true ),
@@ -212,6 +231,8 @@ RevBayesCore::TreeHistoryCtmc<charType>::TreeHistoryCtmc(const TreeHistoryCtmc &
     tipProbs( n.tipProbs ),
     changedNodes( n.changedNodes ),
     dirtyNodes( n.dirtyNodes ),
+    branchStatistics( n.branchStatistics ),
+    dirtyBranchStatistics( n.dirtyBranchStatistics ),
     usingAmbiguousCharacters( n.usingAmbiguousCharacters ),
     treatUnknownAsGap( n.treatUnknownAsGap ),
     treatAmbiguousAsGaps( n.treatAmbiguousAsGaps ),
@@ -265,6 +286,90 @@ double RevBayesCore::TreeHistoryCtmc<charType>::computeBranchRate(size_t index)
     return 1.0;
 }
 
+/**
+ * Collect the transition counts and the time spent in each state along the branch leading to this node.
+ * The events are visited once from the parent towards the node. The time in a state is only accumulated
+ * when the number of sites in that state changes, so each event costs constant time.
+ */
+template<class charType>
+void RevBayesCore::TreeHistoryCtmc<charType>::computeBranchHistoryStatistics(const TopologyNode &node, BranchHistoryStatistics &stats) const
+{
+    stats.consistent = true;
+    stats.transition_counts.assign(num_states * num_states, 0);
+    stats.time_in_states.assign(num_states, 0.0);
+
+    if ( node.isRoot() == true )
+    {
+        return;
+    }
+
+    const BranchHistory* bh = histories[ node.getIndex() ];
+
+    // check that node ages are consistent with character event ages
+    if ( bh->areEventTimesValid(node) == false )
+    {
+        stats.consistent = false;
+        return;
+    }
+
+    // check that the states at the end of the branch match the states at the start of the child branches
+    const std::vector<CharacterEvent*>& end_state = bh->getChildCharacters();
+    for (size_t i = 0; i < node.getNumberOfChildren(); ++i)
+    {
+        const BranchHistory* child_bh = histories[ node.getChild(i).getIndex() ];
+        const std::vector<CharacterEvent*>& child_state = child_bh->getParentCharacters();
+        for (size_t j = 0; j < num_sites; ++j)
+        {
+            if ( static_cast<CharacterEventDiscrete*>(end_state[j])->getState() != static_cast<CharacterEventDiscrete*>(child_state[j])->getState() )
+            {
+                stats.consistent = false;
+                return;
+            }
+        }
+    }
+
+    const std::vector<CharacterEvent*>& start_state = bh->getParentCharacters();
+    std::vector<size_t> curr_state = std::vector<size_t>(num_sites, 0);
+    std::vector<size_t> counts = std::vector<size_t>(num_states, 0);
+    for (size_t j = 0; j < num_sites; ++j)
+    {
+        curr_state[j] = static_cast<CharacterEventDiscrete*>(start_state[j])->getState();
+        ++counts[ curr_state[j] ];
+    }
+
+    // the age at which the count of each state last changed
+    std::vector<double> last_age = std::vector<double>(num_states, node.getParent().getAge());
+
+    const std::multiset<CharacterEvent*,CharacterEventCompare>& history = bh->getHistory();
+    for (std::multiset<CharacterEvent*,CharacterEventCompare>::const_reverse_iterator it_h = history.rbegin(); it_h != history.rend(); ++it_h)
+    {
+        const CharacterEventDiscrete* char_event = static_cast<CharacterEventDiscrete*>(*it_h);
+        size_t site = char_event->getSiteIndex();
+        size_t from = curr_state[site];
+        size_t to   = char_event->getState();
+        double age  = char_event->getAge();
+
+        stats.time_in_states[from] += counts[from] * (last_age[from] - age);
+        last_age[from] = age;
+        --counts[from];
+
+        stats.time_in_states[to] += counts[to] * (last_age[to] - age);
+        last_age[to] = age;
+        ++counts[to];
+
+        ++stats.transition_counts[from * num_states + to];
+        curr_state[site] = to;
+    }
+
+    double end_age = node.getAge();
+    for (size_t i = 0; i < num_states; ++i)
+    {
+        stats.time_in_states[i] += counts[i] * (last_age[i] - end_age);
+    }
+
+}
+
+
 template<class charType>
 double RevBayesCore::TreeHistoryCtmc<charType>::computeLnProbability( void )
 {
@@ -275,6 +380,7 @@ double RevBayesCore::TreeHistoryCtmc<charType>::computeLnProbability( void )
     {
         tau->getValue().getTreeChangeEventHandler().addListener( this );
         dirtyNodes = std::vector<bool>(tau->getValue().getNumberOfNodes(), true);
+        dirtyBranchStatistics = std::vector<bool>(dirtyBranchStatistics.size(), true);
     }
 
     this->lnProb = 0.0;
@@ -429,6 +535,26 @@ void RevBayesCore::TreeHistoryCtmc<charType>::fireTreeChangeEvent( const RevBaye
     // call a recursive flagging of all node above (closer to the root) and including this node
     flagNodeDirty(n);
 
+    // the history statistics of this branch, its parent branch and its child branches might depend on this node
+    flagBranchHistoryStatisticsDirty(n);
+    if ( n.isRoot() == false )
+    {
+        dirtyBranchStatistics[ n.getParent().getIndex() ] = true;
+    }
+    for (size_t i = 0; i < n.getNumberOfChildren(); ++i)
+    {
+        flagBranchHistoryStatisticsDirty( n.getChild(i) );
+    }
+
+}
+
+
+template<class charType>
+void RevBayesCore::TreeHistoryCtmc<charType>::flagBranchHistoryStatisticsDirty( const RevBayesCore::TopologyNode &n )
+{
+
+    dirtyBranchStatistics[ n.getIndex() ] = true;
+
 }
 
 
@@ -546,6 +672,21 @@ const RevBayesCore::Tree& RevBayesCore::TreeHistoryCtmc<charType>::getTree( void
 }
 
 
+template<class charType>
+const typename RevBayesCore::TreeHistoryCtmc<charType>::BranchHistoryStatistics& RevBayesCore::TreeHistoryCtmc<charType>::getBranchHistoryStatistics(const TopologyNode &node)
+{
+    size_t node_index = node.getIndex();
+
+    if ( dirtyBranchStatistics[node_index] == true )
+    {
+        computeBranchHistoryStatistics(node, branchStatistics[node_index]);
+        dirtyBranchStatistics[node_index] = false;
+    }
+
+    return branchStatistics[node_index];
+}
+
+
 
 template<class charType>
 void RevBayesCore::TreeHistoryCtmc<charType>::initializeHistoriesVector( void )
@@ -571,6 +712,9 @@ void RevBayesCore::TreeHistoryCtmc<charType>::initializeHistoriesVector( void )
         historyLikelihoods[i].resize(nodes.size(), 0.0);
     }
 
+    branchStatistics.resize(nodes.size());
+    dirtyBranchStatistics = std::vector<bool>(nodes.size(), true);
+
 }
 
 
@@ -618,6 +762,12 @@ void RevBayesCore::TreeHistoryCtmc<charType>::restoreSpecialization( const DagNo
         changedNodes[index] = false;
     }
 
+    // the histories or the node ages have been restored, unless the restorer was a substitution parameter
+    if ( affecter == tau || (affecter == this->dag_node && useDirtyNodes == false) )
+    {
+        dirtyBranchStatistics = std::vector<bool>(dirtyBranchStatistics.size(), true);
+    }
+
 
     return;
 }
@@ -695,6 +845,8 @@ void RevBayesCore::TreeHistoryCtmc<charType>::setHistory(const BranchHistoryDisc
     // create new branch history object
     histories[ nd.getIndex() ] = new BranchHistoryDiscrete(bh);
 
+    dirtyBranchStatistics = std::vector<bool>(dirtyBranchStatistics.size(), true);
+
 }
 
 
@@ -707,6 +859,8 @@ void RevBayesCore::TreeHistoryCtmc<charType>::setHistories(const std::vector<Bra
         histories[i] = bh[i];
     }
 
+    dirtyBranchStatistics = std::vector<bool>(dirtyBranchStatistics.size(), true);
+
 }
 
 
@@ -837,6 +991,8 @@ void RevBayesCore::TreeHistoryCtmc<charType>::simulate(void)
 
     simulate(nd, bh, taxa);
 
+    dirtyBranchStatistics = std::vector<bool>(dirtyBranchStatistics.size(), true);
+
     // add the taxon data for tips to the character data
     for (size_t i = 0; i < tau->getValue().getNumberOfTips(); ++i)
     {
@@ -906,6 +1062,12 @@ void RevBayesCore::TreeHistoryCtmc<charType>::touchSpecialization( const DagNode
     else if ( affecter != tau )
     {
 
+        // the history statistics only change when the histories themselves have changed
+        if ( affecter == this->dag_node )
+        {
+            dirtyBranchStatistics = std::vector<bool>(dirtyBranchStatistics.size(), true);
+        }
+
         for (std::vector<bool>::iterator it = dirtyNodes.begin(); it != dirtyNodes.end(); ++it)
         {
             (*it) = true;
@@ -924,6 +1086,11 @@ void RevBayesCore::TreeHistoryCtmc<charType>::touchSpecialization( const DagNode
         }
 
     }
+    else
+    {
+        // the node ages may have changed, so the times spent in each state are outdated
+        dirtyBranchStatistics = std::vector<bool>(dirtyBranchStatistics.size(), true);
+    }
 
 }
 
@@ -13,6 +13,7 @@
 #include "RbVector.h"
 #include "RateGenerator.h"
 #include "Simplex.h"
+#include "StochasticCharacterMap.h"
 #include "TopologyNode.h"
 #include "TransitionProbabilityMatrix.h"
 #include "Tree.h"
@@ -97,11 +98,13 @@ namespace RevBayesCore {
         virtual void                                                        drawJointConditionalAncestralStates(std::vector<std::vector<charType> >& startStates, std::vector<std::vector<charType> >& endStates); //!< Simulate ancestral states for each node and each site
         virtual void                                                        drawSiteMixtureAllocations(); //!< For site mixture models (rates and/or matrices), sample the allocation of each site among the mixture categories
         virtual void                                                        drawStochasticCharacterMap(std::vector<std::string>& character_histories, size_t site, bool use_simmap_default=true); //!< Simulate the history of evolution along each branch for each site
+        virtual void                                                        drawStochasticCharacterMap(std::vector<std::vector<std::string> >& character_histories, const std::vector<size_t>& sites, bool use_simmap_default=true); //!< Simulate the history of evolution along each branch for several sites at once
+        virtual void                                                        drawStochasticCharacterMaps(StochasticCharacterMap& character_maps, const std::vector<size_t>& sites); //!< Simulate the history of evolution along each branch for several sites at once
         void                                                                executeMethod(const std::string &n, const std::vector<const DagNode*> &args, RbVector<double> &rv) const;     //!< Map the member methods to internal function calls
         void                                                                executeMethod(const std::string &n, const std::vector<const DagNode*> &args, MatrixReal &rv) const;     //!< Map the member methods to internal function calls
         void                                                                fireTreeChangeEvent(const TopologyNode &n, const unsigned& m=0);                                                 //!< The tree has changed and we want to know which part.
         virtual void                                                        recursivelyDrawJointConditionalAncestralStates(const TopologyNode &node, std::vector<std::vector<charType> >& startStates, std::vector<std::vector<charType> >& endStates, const std::vector<size_t>& sampledSiteRates); //!< Simulate the ancestral states for a given node, conditional on its ancestor's state and the tip data
-        virtual bool                                                        recursivelyDrawStochasticCharacterMap(const TopologyNode &node, std::vector<std::string>& character_histories, std::vector<std::vector<charType> >& start_states, std::vector<std::vector<charType> >& end_states, size_t site, bool use_simmap_default); //!< Simulate the history of evolution for a given site on a given branch, conditional on start and end states
+        virtual bool                                                        recursivelyDrawStochasticCharacterMaps(const TopologyNode &node, StochasticCharacterMap& character_maps, std::vector<std::vector<charType> >& start_states, std::vector<std::vector<charType> >& end_states, const std::vector<size_t>& sites, const std::vector<std::vector<size_t> >& site_groups); //!< Simulate the history of evolution for the given sites on a given branch, conditional on start and end states
         virtual void                                                        redrawValue(void);
         void                                                                reInitialized(void);
         void                                                                setMcmcMode(bool tf);                                                                       //!< Change the likelihood computation to or from MCMC mode.
@@ -272,6 +275,7 @@ namespace RevBayesCore {
         virtual void                                                        scale(size_t i, size_t l, size_t r, size_t m);
         virtual void                                                        simulate(const TopologyNode& node, std::vector< DiscreteTaxonData< charType > > &t, const std::vector<bool> &inv, const std::vector<size_t> &perSiteRates);
         virtual void                                                        updateTransitionProbabilityMatrix(size_t node_idx);
+        void                                                                getBranchAgesAndClockRate(size_t node_idx, double &start_age, double &end_age, double &rate) const;
         
         
         
@@ -287,8 +291,10 @@ namespace RevBayesCore {
 #include "RandomNumberGenerator.h"
 #include "RateMatrix_JC.h"
 #include "StochasticNode.h"
+#include "StringUtilities.h"
 
 #include <cmath>
+#include <map>
 
 #ifdef RB_MPI
 #include <mpi.h>
@@ -553,11 +559,11 @@ inline void mark_ambiguous_and_missing_as_gap(AbstractHomologousDiscreteCharacte
             AbstractDiscreteTaxonData& taxon_data = data.getTaxonData( node->getName() );
             for (auto site_index: site_indices)
             {
-                DiscreteCharacterState &c = taxon_data.getCharacter(site_index);
+                const DiscreteCharacterState &c = static_cast<const AbstractDiscreteTaxonData&>( taxon_data ).getCharacter(site_index);
 
                 if ( c.isAmbiguous() or  c.isMissingState() )
                 {
-                    c.setGapState( true );
+                    taxon_data.setGapState( site_index, true );
                 }
             }
         }
@@ -573,27 +579,27 @@ inline void mark_unknown_as_gap(AbstractHomologousDiscreteCharacterData& data, c
             AbstractDiscreteTaxonData& taxon_data = data.getTaxonData( node->getName() );
             for (auto site_index: site_indices)
             {
-                DiscreteCharacterState &c = taxon_data.getCharacter(site_index);
+                const DiscreteCharacterState &c = static_cast<const AbstractDiscreteTaxonData&>( taxon_data ).getCharacter(site_index);
 
                 if ( c.getNumberOfStates() == c.getNumberObservedStates() or c.isMissingState())
                 {
-                    c.setGapState( true );
+                    taxon_data.setGapState( site_index, true );
                 }
             }
         }
     }
 }
 
-inline bool has_ambiguous_nongap_characters(AbstractHomologousDiscreteCharacterData& data, const vector<size_t>& site_indices, std::vector<TopologyNode*> nodes)
+inline bool has_ambiguous_nongap_characters(const AbstractHomologousDiscreteCharacterData& data, const vector<size_t>& site_indices, std::vector<TopologyNode*> nodes)
 {
     for (auto& node: nodes)
     {
         if ( node->isTip() )
         {
-            AbstractDiscreteTaxonData& taxon_data = data.getTaxonData( node->getName() );
+            const AbstractDiscreteTaxonData& taxon_data = data.getTaxonData( node->getName() );
             for (auto site_index: site_indices)
             {
-                DiscreteCharacterState &c = taxon_data.getCharacter(site_index);
+                const DiscreteCharacterState &c = taxon_data.getCharacter(site_index);
 
                 if ( not c.isGapState() and (c.isAmbiguous() or c.isMissingState()) )
                     return true;
@@ -604,16 +610,16 @@ inline bool has_ambiguous_nongap_characters(AbstractHomologousDiscreteCharacterD
     return false;
 }
 
-inline bool has_weighted_characters(AbstractHomologousDiscreteCharacterData& data, const vector<size_t>& site_indices, std::vector<TopologyNode*> nodes)
+inline bool has_weighted_characters(const AbstractHomologousDiscreteCharacterData& data, const vector<size_t>& site_indices, std::vector<TopologyNode*> nodes)
 {
     for (auto& node: nodes)
     {
         if ( node->isTip() )
         {
-            AbstractDiscreteTaxonData& taxon_data = data.getTaxonData( node->getName() );
+            const AbstractDiscreteTaxonData& taxon_data = data.getTaxonData( node->getName() );
             for (auto site_index: site_indices)
             {
-                DiscreteCharacterState &c = taxon_data.getCharacter(site_index);
+                const DiscreteCharacterState &c = taxon_data.getCharacter(site_index);
 
                 if ( c.isWeighted() ) return true;
             }
@@ -686,8 +692,8 @@ void RevBayesCore::AbstractPhyloCTMCSiteHomogeneous<charType>::compress( void )
             {
                 if ( node->isTip() )
                 {
-                    AbstractDiscreteTaxonData& taxon = value->getTaxonData( node->getName() );
-                    CharacterState &c = taxon.getCharacter(site_indices[site]);
+                    const AbstractDiscreteTaxonData& taxon = value->getTaxonData( node->getName() );
+                    const CharacterState &c = taxon.getCharacter(site_indices[site]);
                     pattern += c.getStringValue();
                 }
             }
@@ -755,7 +761,7 @@ void RevBayesCore::AbstractPhyloCTMCSiteHomogeneous<charType>::compress( void )
         {
             size_t node_index = the_node->getIndex();
             taxon_name_2_tip_index_map.insert( std::pair<std::string,size_t>(the_node->getName(), node_index) );
-            AbstractDiscreteTaxonData& taxon = value->getTaxonData( the_node->getName() );
+            const AbstractDiscreteTaxonData& taxon = value->getTaxonData( the_node->getName() );
 
             // resize the column
             if ( using_ambiguous_characters == true )
@@ -772,7 +778,7 @@ void RevBayesCore::AbstractPhyloCTMCSiteHomogeneous<charType>::compress( void )
                 // set the counts for this patter
                 process_pattern_counts[patternIndex] = pattern_counts[patternIndex+pattern_block_start];
 
-                charType &c = static_cast<charType &>( taxon.getCharacter(site_indices[indexOfSitePattern[patternIndex+pattern_block_start]]) );
+                const charType &c = static_cast<const charType &>( taxon.getCharacter(site_indices[indexOfSitePattern[patternIndex+pattern_block_start]]) );
                 gap_matrix[node_index][patternIndex] = c.isGapState();
 
                 if ( using_ambiguous_characters == true )
@@ -1417,6 +1423,58 @@ void RevBayesCore::AbstractPhyloCTMCSiteHomogeneous<charType>::drawSiteMixtureAl
 
 template<class charType>
 void RevBayesCore::AbstractPhyloCTMCSiteHomogeneous<charType>::drawStochasticCharacterMap(std::vector<std::string>& character_histories, size_t site, bool use_simmap_default)
+{
+
+    std::vector<std::vector<std::string> > site_histories;
+    drawStochasticCharacterMap( site_histories, std::vector<size_t>(1, site), use_simmap_default );
+    character_histories = site_histories[0];
+
+}
+
+
+/**
+ * Draw the character histories of several sites in one pass and store them as SIMMAP strings.
+ * The i-th vector of histories belongs to the i-th site and holds one string per node.
+ */
+template<class charType>
+void RevBayesCore::AbstractPhyloCTMCSiteHomogeneous<charType>::drawStochasticCharacterMap(std::vector<std::vector<std::string> >& character_histories, const std::vector<size_t>& sites, bool use_simmap_default)
+{
+
+    StochasticCharacterMap character_maps = StochasticCharacterMap(sites.size(), this->num_nodes);
+    drawStochasticCharacterMaps( character_maps, sites );
+
+    const TopologyNode &root = this->tau->getValue().getRoot();
+    size_t root_index = root.getIndex();
+    character_histories.resize( sites.size() );
+    for (size_t k = 0; k < sites.size(); ++k)
+    {
+        character_histories[k].resize( this->num_nodes );
+
+        // save the character history for the root using the state label
+        charType root_state = charType( template_state );
+        root_state.setStateByIndex( character_maps.getState(k, root_index, 0) );
+        character_histories[k][root_index] = "{" + root_state.getStringValue() + "," + StringUtilities::toString( root.getBranchLength() ) + "}";
+
+        // make the SIMMAP strings for all other branches
+        for (size_t i = 0; i < this->num_nodes; ++i)
+        {
+            if ( i != root_index )
+            {
+                character_histories[k][i] = character_maps.getSimmapString(k, i, use_simmap_default);
+            }
+        }
+    }
+
+}
+
+
+/**
+ * Draw stochastic character maps for several sites from the same joint ancestral state sample.
+ * Sites that share the same sampled mixture component also share the rate matrix and clock rate,
+ * so their histories along a branch are simulated together.
+ */
+template<class charType>
+void RevBayesCore::AbstractPhyloCTMCSiteHomogeneous<charType>::drawStochasticCharacterMaps(StochasticCharacterMap& character_maps, const std::vector<size_t>& sites)
 {
 
     bool success = false;
@@ -1424,6 +1482,8 @@ void RevBayesCore::AbstractPhyloCTMCSiteHomogeneous<charType>::drawStochasticCha
     size_t n_draws = 0;
 
     while (!success && n_draws != max_draws) {
+        character_maps.clear();
+
         // first draw joint ancestral states
         std::vector<std::vector<charType> > start_states(this->num_nodes, std::vector<charType>(this->num_sites, template_state));
         std::vector<std::vector<charType> > end_states(this->num_nodes, std::vector<charType>(this->num_sites, template_state));
@@ -1432,17 +1492,32 @@ void RevBayesCore::AbstractPhyloCTMCSiteHomogeneous<charType>::drawStochasticCha
         // save the character history for the root
         const TopologyNode &root = this->tau->getValue().getRoot();
         size_t root_index = root.getIndex();
-        std::string simmap_string = "{" + end_states[root_index][site].getStringValue() + "," + StringUtilities::toString( root.getBranchLength() ) + "}";
-        character_histories[root_index] = simmap_string;
+        for (size_t k = 0; k < sites.size(); ++k)
+        {
+            character_maps.addBranchHistory(k, root_index, std::vector<size_t>(1, end_states[root_index][sites[k]].getStateIndex()), std::vector<double>(1, root.getBranchLength()) );
+        }
 
-        // get the sampled site-matrix and site-rate indexes
-        getSampledMixtureComponents(site, sampled_site_rate_component, sampled_site_matrix_component);
+        // group the sites by their sampled site-matrix and site-rate indexes
+        std::map<std::pair<size_t, size_t>, std::vector<size_t> > groups;
+        for (size_t k = 0; k < sites.size(); ++k)
+        {
+            size_t site = sites[k];
+            size_t rate_component = 0;
+            size_t matrix_component = 0;
+            getSampledMixtureComponents(site, rate_component, matrix_component);
+            groups[ std::pair<size_t, size_t>(rate_component, matrix_component) ].push_back( k );
+        }
+        std::vector<std::vector<size_t> > site_groups;
+        for (std::map<std::pair<size_t, size_t>, std::vector<size_t> >::const_iterator it = groups.begin(); it != groups.end(); ++it)
+        {
+            site_groups.push_back( it->second );
+        }
 
         // recurse towards tips
         const TopologyNode &right = root.getChild(0);
         const TopologyNode &left = root.getChild(1);
-        success = recursivelyDrawStochasticCharacterMap(left,  character_histories, start_states, end_states, site, use_simmap_default);
-        success &= recursivelyDrawStochasticCharacterMap(right, character_histories, start_states, end_states, site, use_simmap_default);
+        success = recursivelyDrawStochasticCharacterMaps(left,  character_maps, start_states, end_states, sites, site_groups);
+        success &= recursivelyDrawStochasticCharacterMaps(right, character_maps, start_states, end_states, sites, site_groups);
 
         if (n_draws != 0) {
             std::cout << "Warning: numerical instability in P(t)=exp(Qt) caused stochastic mapping to fail (attempt: " << n_draws << "/" << max_draws << ")\n";
@@ -1500,73 +1575,12 @@ void RevBayesCore::AbstractPhyloCTMCSiteHomogeneous<charType>::getSampledMixture
 
 
 template<class charType>
-bool RevBayesCore::AbstractPhyloCTMCSiteHomogeneous<charType>::recursivelyDrawStochasticCharacterMap(const TopologyNode &node, std::vector<std::string>& character_histories, std::vector<std::vector<charType> >& start_states, std::vector<std::vector<charType> >& end_states, size_t site, bool use_simmap_default)
+bool RevBayesCore::AbstractPhyloCTMCSiteHomogeneous<charType>::recursivelyDrawStochasticCharacterMaps(const TopologyNode &node, StochasticCharacterMap& character_maps, std::vector<std::vector<charType> >& start_states, std::vector<std::vector<charType> >& end_states, const std::vector<size_t>& sites, const std::vector<std::vector<size_t> >& site_groups)
 {
 
-    bool success = false;
+    bool success = true;
 
-    // get the start and end states
     size_t node_index = node.getIndex();
-    size_t start_state = start_states[node_index][site].getStateIndex();
-    size_t end_state = start_state;
-
-    // NOTE: ambiguous tip states are sampled along with internal node states
-    end_state = end_states[node_index][site].getStateIndex();
-
-    // set up vectors to hold the character transition events
-    std::vector<size_t> transition_states;
-    std::vector<double> transition_times;
-    transition_states.push_back(start_state);
-
-    // get the rate matrix for this branch (or site if using a mixture of matrices over sites)
-    RateMatrix_JC jc(this->num_chars);
-    const RateGenerator *rate_matrix = &jc;
-    if ( this->branch_heterogeneous_substitution_matrices == true )
-    {
-        if (this->heterogeneous_rate_matrices != NULL)
-        {
-            rate_matrix = &this->heterogeneous_rate_matrices->getValue()[node_index];
-        }
-        else if (this->homogeneous_rate_matrix != NULL)
-        {
-            rate_matrix = &this->homogeneous_rate_matrix->getValue();
-        }
-    }
-    else
-    {
-        if (this->homogeneous_rate_matrix != NULL)
-        {
-            rate_matrix = &this->homogeneous_rate_matrix->getValue();
-        }
-        else if (this->site_matrix_probs != NULL)
-        {
-        	rate_matrix = &this->heterogeneous_rate_matrices->getValue()[this->sampled_site_matrix_component];
-        }
-    }
-
-    // get the clock rate for the branch
-    double clock_rate = 1.0;
-    if ( this->branch_heterogeneous_clock_rates == true )
-    {
-        if (this->heterogeneous_clock_rates != NULL)
-        {
-            clock_rate = this->heterogeneous_clock_rates->getValue()[node_index];
-        }
-    }
-    else
-    {
-        if (this->homogeneous_clock_rate != NULL)
-        {
-            clock_rate = this->homogeneous_clock_rate->getValue();
-        }
-    }
-
-    // multiply by the clock-rate for the site
-    if (this->site_rates != NULL)
-    {
-    	// there is a mixture over site rates
-    	clock_rate *= this->site_rates->getValue()[this->sampled_site_rate_component];
-    }
 
     // now sample a character history for the branch leading to this node
     double start_age;
@@ -1587,48 +1601,92 @@ bool RevBayesCore::AbstractPhyloCTMCSiteHomogeneous<charType>::recursivelyDrawSt
         end_age = 0.0;
     }
 
+    for (size_t g = 0; g < site_groups.size(); ++g)
+    {
+        const std::vector<size_t>& group = site_groups[g];
 
-    // simulate stochastic map
-    transition_states.push_back(end_state);
-    success = const_cast<RateGenerator*>(rate_matrix)->simulateStochasticMapping(start_age, end_age, clock_rate, transition_states, transition_times);
+        // get the sampled site-matrix and site-rate indexes, which are shared by all sites of the group
+        size_t first_site = sites[ group[0] ];
+        getSampledMixtureComponents(first_site, sampled_site_rate_component, sampled_site_matrix_component);
 
-    // make SIMMAP string
-    std::string simmap_string = "{";
+        // get the rate matrix for this branch (or site if using a mixture of matrices over sites)
+        RateMatrix_JC jc(this->num_chars);
+        const RateGenerator *rate_matrix = &jc;
+        if ( this->branch_heterogeneous_substitution_matrices == true )
+        {
+            if (this->heterogeneous_rate_matrices != NULL)
+            {
+                rate_matrix = &this->heterogeneous_rate_matrices->getValue()[node_index];
+            }
+            else if (this->homogeneous_rate_matrix != NULL)
+            {
+                rate_matrix = &this->homogeneous_rate_matrix->getValue();
+            }
+        }
+        else
+        {
+            if (this->homogeneous_rate_matrix != NULL)
+            {
+                rate_matrix = &this->homogeneous_rate_matrix->getValue();
+            }
+            else if (this->site_matrix_probs != NULL)
+            {
+                rate_matrix = &this->heterogeneous_rate_matrices->getValue()[this->sampled_site_matrix_component];
+            }
+        }
 
-    if (use_simmap_default == true)
-    {
-        for (size_t i = transition_times.size(); i > 0; i--)
+        // get the clock rate for the branch
+        double clock_rate = 1.0;
+        if ( this->branch_heterogeneous_clock_rates == true )
         {
-            simmap_string = simmap_string + StringUtilities::toString(transition_states[i - 1]) + "," + StringUtilities::toString(transition_times[i - 1]);
-            if (i != 1)
+            if (this->heterogeneous_clock_rates != NULL)
             {
-                simmap_string = simmap_string + ":";
+                clock_rate = this->heterogeneous_clock_rates->getValue()[node_index];
             }
         }
-    }
-    else
-    {
-        for (size_t i = 0; i < transition_times.size(); i++)
+        else
         {
-            if (i != 0)
+            if (this->homogeneous_clock_rate != NULL)
             {
-                simmap_string = simmap_string + ":";
+                clock_rate = this->homogeneous_clock_rate->getValue();
             }
-            simmap_string = simmap_string + StringUtilities::toString(transition_states[i]) + "," + StringUtilities::toString(transition_times[i]);
         }
-    }
-    simmap_string = simmap_string + "}";
 
-    // save the character history for this branch
-    character_histories[node_index] = simmap_string;
+        // multiply by the clock-rate for the site
+        if (this->site_rates != NULL)
+        {
+            // there is a mixture over site rates
+            clock_rate *= this->site_rates->getValue()[this->sampled_site_rate_component];
+        }
+
+        // set up vectors to hold the character transition events, starting with the start and end states
+        // NOTE: ambiguous tip states are sampled along with internal node states
+        std::vector<std::vector<size_t> > transition_states( group.size(), std::vector<size_t>(2, 0) );
+        std::vector<std::vector<double> > transition_times( group.size(), std::vector<double>() );
+        for (size_t k = 0; k < group.size(); ++k)
+        {
+            size_t site = sites[ group[k] ];
+            transition_states[k][0] = start_states[node_index][site].getStateIndex();
+            transition_states[k][1] = end_states[node_index][site].getStateIndex();
+        }
+
+        // simulate stochastic maps
+        success &= const_cast<RateGenerator*>(rate_matrix)->simulateStochasticMappings(start_age, end_age, clock_rate, transition_states, transition_times);
+
+        // save the character histories for this branch
+        for (size_t k = 0; k < group.size(); ++k)
+        {
+            character_maps.addBranchHistory(group[k], node_index, transition_states[k], transition_times[k]);
+        }
+    }
 
     // recurse towards tips
     if ( node.isTip() == false )
     {
         const TopologyNode &right = node.getChild(0);
         const TopologyNode &left = node.getChild(1);
-        success &= recursivelyDrawStochasticCharacterMap(left, character_histories, start_states, end_states, site, use_simmap_default);
-        success &= recursivelyDrawStochasticCharacterMap(right, character_histories, start_states, end_states, site, use_simmap_default);
+        success &= recursivelyDrawStochasticCharacterMaps(left, character_maps, start_states, end_states, sites, site_groups);
+        success &= recursivelyDrawStochasticCharacterMaps(right, character_maps, start_states, end_states, sites, site_groups);
     }
 
     return success;
@@ -4242,17 +4300,15 @@ void RevBayesCore::AbstractPhyloCTMCSiteHomogeneous<charType>::updateTransitionP
 
 
 /*
- * Update the transition probability matrices for the branch attached to the given node index.
+ * Get the start and end age of the branch attached to the given node index, and the clock rate along it.
  */
 template<class charType>
-void RevBayesCore::AbstractPhyloCTMCSiteHomogeneous<charType>::updateTransitionProbabilityMatrix(size_t node_idx)
+void RevBayesCore::AbstractPhyloCTMCSiteHomogeneous<charType>::getBranchAgesAndClockRate(size_t node_idx, double &start_age, double &end_age, double &rate) const
 {
     const TopologyNode* node = tau->getValue().getNodes()[node_idx];
     
-    if (node->isRoot()) throw RbException("dnPhyloCTMC called updateTransitionProbabilityMatrix for the root node\n");
-    
-    // second, get the clock rate for the branch
-    double rate = 1.0;
+    // get the clock rate for the branch
+    rate = 1.0;
     if ( this->branch_heterogeneous_clock_rates == true )
     {
         rate = this->heterogeneous_clock_rates->getValue()[node_idx];
@@ -4265,7 +4321,7 @@ void RevBayesCore::AbstractPhyloCTMCSiteHomogeneous<charType>::updateTransitionP
     // we rescale the rate by the inverse of the proportion of invariant sites
     rate /= ( 1.0 - getPInv() );
     
-    double end_age = node->getAge();
+    end_age = node->getAge();
     
     // if the tree is not a time tree, then the age will be not a number
     if ( RbMath::isFinite(end_age) == false )
@@ -4273,7 +4329,24 @@ void RevBayesCore::AbstractPhyloCTMCSiteHomogeneous<charType>::updateTransitionP
         // we assume by default that the end is at time 0
         end_age = 0.0;
     }
-    double start_age = end_age + node->getBranchLength();
+    start_age = end_age + node->getBranchLength();
+}
+
+
+/*
+ * Update the transition probability matrices for the branch attached to the given node index.
+ */
+template<class charType>
+void RevBayesCore::AbstractPhyloCTMCSiteHomogeneous<charType>::updateTransitionProbabilityMatrix(size_t node_idx)
+{
+    const TopologyNode* node = tau->getValue().getNodes()[node_idx];
+    
+    if (node->isRoot()) throw RbException("dnPhyloCTMC called updateTransitionProbabilityMatrix for the root node\n");
+    
+    double start_age = 0.0;
+    double end_age   = 0.0;
+    double rate      = 1.0;
+    getBranchAgesAndClockRate(node_idx, start_age, end_age, rate);
     
     // first, get the rate matrix for this branch
     RateMatrix_JC jc(this->num_chars);
@@ -4339,7 +4412,15 @@ void RevBayesCore::AbstractPhyloCTMCSiteHomogeneous<charType>::updateTransitionP
 {
     
     std::vector<TopologyNode*> nodes = tau->getValue().getNodes();
-        
+    
+    // Branches with the same ages and clock rate have the same transition probabilities if all branches share the
+    // substitution matrices, e.g. the two tips of a cherry in a time tree. We compute these only once per update,
+    // which matters for the large matrices of the population-genetic models.
+    // We do not keep them across updates: only the branches of dirty nodes are recomputed anyway, and after a
+    // rejected proposal the stored matrices are restored by flipping the active matrices. A cache keyed on the
+    // branch times would therefore rarely be hit, but would need to copy every matrix for the large models.
+    std::map< std::vector<double>, size_t > computed_branches;
+    
     for (std::vector<TopologyNode*>::iterator it = nodes.begin(); it != nodes.end(); ++it)
     {
         size_t node_index = (*it)->getIndex();
@@ -4347,7 +4428,34 @@ void RevBayesCore::AbstractPhyloCTMCSiteHomogeneous<charType>::updateTransitionP
         {
             if ((*it)->isRoot() == false)
             {
-                updateTransitionProbabilityMatrix(node_index);
+                bool computed = false;
+                if ( branch_heterogeneous_substitution_matrices == false )
+                {
+                    std::vector<double> branch(3, 0.0);
+                    getBranchAgesAndClockRate(node_index, branch[0], branch[1], branch[2]);
+                    
+                    std::map< std::vector<double>, size_t >::const_iterator source = computed_branches.find( branch );
+                    if ( source != computed_branches.end() )
+                    {
+                        size_t source_offset = this->active_pmatrices[source->second] * this->activePmatrixOffset + source->second * this->pmatNodeOffset;
+                        size_t pmat_offset   = this->active_pmatrices[node_index] * this->activePmatrixOffset + node_index * this->pmatNodeOffset;
+                        for (size_t i = 0; i < this->pmatNodeOffset; ++i)
+                        {
+                            const TransitionProbabilityMatrix& from = this->pmatrices[source_offset + i];
+                            std::copy(from.getElements(), from.getElements() + from.size(), this->pmatrices[pmat_offset + i].getElements());
+                        }
+                        computed = true;
+                    }
+                    else if ( RbMath::isFinite(branch[0]) == true && RbMath::isFinite(branch[2]) == true )
+                    {
+                        computed_branches[branch] = node_index;
+                    }
+                }
+                
+                if ( computed == false )
+                {
+                    updateTransitionProbabilityMatrix(node_index);
+                }
             }
 
             // mark as computed
@@ -486,12 +486,12 @@ void RevBayesCore::CTMCProcess<charType>::compress( void )
     // check whether there are ambiguous characters (besides gaps)
     bool ambiguous_characters = false;
 
-    AbstractDiscreteTaxonData& seq = *(this->value);
+    const AbstractDiscreteTaxonData& seq = *(this->value);
     // find the unique site patterns and compute their respective frequencies
     for (size_t site = 0; site < num_sites; ++site)
     {
 
-        DiscreteCharacterState &c = seq.getCharacter(site_indices[site]);
+        const DiscreteCharacterState &c = seq.getCharacter(site_indices[site]);
 
         // if we treat unknown characters as gaps and this is an unknown character then we change it
         // because we might then have a pattern more
@@ -511,7 +511,7 @@ void RevBayesCore::CTMCProcess<charType>::compress( void )
     for (size_t site = 0; site < num_sites; ++site)
     {
         
-        DiscreteCharacterState &c = seq.getCharacter(site_indices[site]);
+        const DiscreteCharacterState &c = seq.getCharacter(site_indices[site]);
 
         if ( c.isWeighted() )
         {
@@ -536,7 +536,7 @@ void RevBayesCore::CTMCProcess<charType>::compress( void )
             // create the site pattern
             std::string pattern = "";
             
-            DiscreteCharacterState &c = seq.getCharacter(site_indices[site]);
+            const DiscreteCharacterState &c = seq.getCharacter(site_indices[site]);
             pattern += c.getStringValue();
             
             // check if we have already seen this site pattern
@@ -605,7 +605,7 @@ void RevBayesCore::CTMCProcess<charType>::compress( void )
         // set the counts for this patter
         process_pattern_counts[pattern_index] = pattern_counts[pattern_index+pattern_block_start];
 
-        charType &c = static_cast<charType &>( seq.getCharacter(site_indices[index_of_site_pattern[pattern_index+pattern_block_start]]) );
+        const charType &c = static_cast<const charType &>( seq.getCharacter(site_indices[index_of_site_pattern[pattern_index+pattern_block_start]]) );
         gap_vector[pattern_index] = c.isGapState();
 
         if ( using_ambiguous_characters == true )
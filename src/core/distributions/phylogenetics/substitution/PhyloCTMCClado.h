@@ -60,6 +60,23 @@ namespace RevBayesCore {
         virtual std::vector< std::vector< double > >*       sumMarginalLikelihoods(size_t node_index);
         
         virtual void                                        swapParameterInternal(const DagNode *oldP, const DagNode *newP);            //!< Swap a parameter
+        virtual void                                        restoreSpecialization(const DagNode *restorer);
+        virtual void                                        touchSpecialization(const DagNode *toucher, bool touchAll);
+
+        /**
+         * The events of a cladogenetic probability matrix compiled into flat arrays,
+         * so that the likelihood kernels neither copy the event map nor walk the map nodes.
+         * The events are in the same order as in the event map.
+         */
+        struct CladogeneticEventTable {
+            std::vector<size_t>                             ancestor;                                                                   //!< The state before cladogenesis
+            std::vector<size_t>                             left;                                                                       //!< The state of the left daughter
+            std::vector<size_t>                             right;                                                                      //!< The state of the right daughter
+            std::vector<double>                             probability;
+        };
+
+        const CladogeneticEventTable&                       getCladogeneticEvents(const std::map<std::vector<unsigned>, double> &event_map);
+        const CladogeneticEventTable&                       getCladogeneticEvents(size_t node_index, double age);
 
         // the likelihoods
         double*                                             cladoPartialLikelihoods;
@@ -86,6 +103,9 @@ namespace RevBayesCore {
         bool branchHeterogeneousCladogenesis;
         bool store_internal_nodes;
         bool gap_match_clamped;
+
+        // the compiled event tables, by the event map they were compiled from (cleared whenever a parameter might have changed)
+        std::map<const std::map<std::vector<unsigned>, double>*, CladogeneticEventTable>   cladogenetic_event_tables;
     };
 
 }
@@ -275,9 +295,8 @@ void RevBayesCore::PhyloCTMCClado<charType>::computeRootLikelihood( size_t root,
     // get the root frequencies
     const std::vector<double> &f = this->getRootFrequencies();
     const TopologyNode& node = this->tau->getValue().getRoot();
-    std::map<std::vector<unsigned>, double> eventMapProbs = ( branchHeterogeneousCladogenesis ?
-                                                              heterogeneousCladogenesisMatrices->getValue()[root].getEventMap(node.getAge()) :
-                                                              homogeneousCladogenesisMatrix->getValue().getEventMap(node.getAge()) );
+    const CladogeneticEventTable& events = getCladogeneticEvents( root, node.getAge() );
+    const size_t num_events = events.probability.size();
     // bypass cladogenetic probs if it's a sampled ancestor
     bool has_sampled_ancestor_child = node.getChild(0).isSampledAncestor() || node.getChild(1).isSampledAncestor();
     
@@ -300,27 +319,18 @@ void RevBayesCore::PhyloCTMCClado<charType>::computeRootLikelihood( size_t root,
         for (size_t site = 0; site < this->num_patterns ; ++site)
         {
             // first compute clado probs at younger end of branch
-            std::map<std::vector<unsigned>, double>::iterator it;
-            
             for (size_t i = 0; i < this->num_chars; i++)
                 p_site_mixture[i] = 0.0;
             
             // cladogenetic probs for bifurcations
             if (!has_sampled_ancestor_child)
             {
-                for ( it = eventMapProbs.begin(); it != eventMapProbs.end(); ++it)
+                for (size_t e = 0; e < num_events; ++e)
                 {
-                    // sparse elements from map
-                    const std::vector<unsigned>& idx = it->first;
-                    const size_t c1 = idx[0];
-                    const size_t c2 = idx[1];
-                    const size_t c3 = idx[2];
-                    
-                    const double pl = *(p_site_mixture_left + c2);
-                    const double pr = *(p_site_mixture_right + c3);
-                    const double pcl = it->second;
+                    const double pl = p_site_mixture_left[ events.left[e] ];
+                    const double pr = p_site_mixture_right[ events.right[e] ];
                     
-                    p_site_mixture[c1] += pl * pr * pcl;
+                    p_site_mixture[ events.ancestor[e] ] += pl * pr * events.probability[e];
                 }
                 
             }
@@ -368,9 +378,8 @@ template<class charType>
 void RevBayesCore::PhyloCTMCClado<charType>::computeInternalNodeLikelihood(const TopologyNode &node, size_t node_index, size_t left, size_t right)
 {
 
-    std::map<std::vector<unsigned>, double> eventMapProbs = ( branchHeterogeneousCladogenesis ?
-                                                              heterogeneousCladogenesisMatrices->getValue()[node_index].getEventMap(node.getAge()) :
-                                                              homogeneousCladogenesisMatrix->getValue().getEventMap(node.getAge()) );
+    const CladogeneticEventTable& events = getCladogeneticEvents( node_index, node.getAge() );
+    const size_t num_events = events.probability.size();
 
 
     // bypass cladogenetic probs if it's a sampled ancestor
@@ -403,27 +412,18 @@ void RevBayesCore::PhyloCTMCClado<charType>::computeInternalNodeLikelihood(const
         {
     
             // first compute clado probs at younger end of branch
-            std::map<std::vector<unsigned>, double>::iterator it;
-            
             for (size_t i = 0; i < this->num_chars; i++)
                 p_clado_site_mixture[i] = 0.0;
             
             // cladogenetic probs for bifurcations
             if (!has_sampled_ancestor_child)
             {
-                for ( it = eventMapProbs.begin(); it != eventMapProbs.end(); ++it)
+                for (size_t e = 0; e < num_events; ++e)
                 {
-                    // sparse elements from map
-                    const std::vector<unsigned>& idx = it->first;
-                    const size_t c1 = idx[0];
-                    const size_t c2 = idx[1];
-                    const size_t c3 = idx[2];
-                    
-                    const double pl = *(p_site_mixture_left + c2);
-                    const double pr = *(p_site_mixture_right + c3);
-                    const double pcl = it->second;
+                    const double pl = p_site_mixture_left[ events.left[e] ];
+                    const double pr = p_site_mixture_right[ events.right[e] ];
                     
-                    p_clado_site_mixture[c1] += pl * pr * pcl;
+                    p_clado_site_mixture[ events.ancestor[e] ] += pl * pr * events.probability[e];
                 }
             }
             
@@ -472,10 +472,6 @@ void RevBayesCore::PhyloCTMCClado<charType>::computeInternalNodeLikelihood(const
 template<class charType>
 void RevBayesCore::PhyloCTMCClado<charType>::computeMarginalNodeLikelihood( size_t node_index, size_t parentnode_index )
 {
-    // get cladogenic transition probs
-    const TopologyNode& node = this->tau->getValue().getNode(node_index);
-    std::map<std::vector<unsigned>, double> eventMapProbs = ( branchHeterogeneousCladogenesis ? heterogeneousCladogenesisMatrices->getValue()[node_index].getEventMap(node.getAge()) : homogeneousCladogenesisMatrix->getValue().getEventMap(node.getAge()) );
-    
     // compute the transition probability matrix
     this->updateTransitionProbabilities( node_index );
     
@@ -540,13 +536,6 @@ void RevBayesCore::PhyloCTMCClado<charType>::computeMarginalNodeLikelihood( size
                 ++p_site_j; ++p_site_marginal_j;
             }
 
-            // iterate over all (X_L, X_R) states, after cladogenesis
-            std::map< std::vector<unsigned>, double >::iterator it;
-            for (it = eventMapProbs.begin(); it != eventMapProbs.end(); it++)
-            {
-                ;
-            }
-
 
             // increment the pointers to the next site
             p_site_mixture                          += this->siteOffset;
@@ -880,11 +869,11 @@ void RevBayesCore::PhyloCTMCClado<charType>::drawJointConditionalAncestralStates
     }
     
     // get cladogenesis values
-    std::map<std::vector<unsigned>, double> eventMapProbs = ( branchHeterogeneousCladogenesis ? heterogeneousCladogenesisMatrices->getValue()[node_index].getEventMap(root.getAge()) : homogeneousCladogenesisMatrix->getValue().getEventMap(root.getAge()) );
+    const CladogeneticEventTable& events = getCladogeneticEvents( node_index, root.getAge() );
+    const size_t num_events = events.probability.size();
     
-    std::map<std::vector<unsigned>, double> sampleProbs;
-    std::map<std::vector<unsigned>, double>::iterator it_s;
-    std::map<std::vector<unsigned>, double>::iterator it_p;
+    // the probabilities of the events (in the order of the events) and mixture categories
+    std::vector<double> sampleProbs( num_events * this->num_site_rates, 0.0 );
 
     // get the pointers to the partial likelihoods and the marginal likelihoods
     double*         p_node  = this->partialLikelihoods + this->activeLikelihood[node_index]*this->activeLikelihoodOffset + node_index*this->nodeOffset;
@@ -919,27 +908,15 @@ void RevBayesCore::PhyloCTMCClado<charType>::drawJointConditionalAncestralStates
         // iterate over all mixture categories
         for (size_t mixture = 0; mixture < this->num_site_rates; ++mixture)
         {
-            // get pointers to the likelihood for this mixture category
-            const double* p_site_mixture_j       = p_site;
-            const double* p_left_site_mixture_j  = p_left_site;
-            const double* p_right_site_mixture_j = p_right_site;
-
             // iterate over possible end-anagenesis states for each site given start-anagenesis state
-            for (it_p = eventMapProbs.begin(); it_p != eventMapProbs.end(); it_p++)
+            for (size_t e = 0; e < num_events; ++e)
             {
                 // triplet of (A,L,R) states
-                const std::vector<unsigned>& v = it_p->first;
-
-                p_site_mixture_j       = p_site       + v[0];
-                p_left_site_mixture_j  = p_left_site  + v[1];
-                p_right_site_mixture_j = p_right_site + v[2];
+                size_t a = events.ancestor[e];
                 
-                std::vector<unsigned> key = it_p->first;
-                key.push_back((unsigned)mixture);
-                sampleProbs[ key ] = *p_site_mixture_j * *p_left_site_mixture_j * *p_right_site_mixture_j * f[v[0]] * siteProbVector[mixture] * it_p->second;
-                sum += sampleProbs[ key ];
-
-                // increment the pointers to the next state for (site,rate)
+                double &prob = sampleProbs[ e * this->num_site_rates + mixture ];
+                prob = p_site[a] * p_left_site[ events.left[e] ] * p_right_site[ events.right[e] ] * f[a] * siteProbVector[mixture] * events.probability[e];
+                sum += prob;
             }
 
             // increment the pointers to the next mixture category for given site
@@ -957,20 +934,20 @@ void RevBayesCore::PhyloCTMCClado<charType>::drawJointConditionalAncestralStates
         
         double u = rng->uniform01() * sum;
 
-        for (it_s = sampleProbs.begin(); it_s != sampleProbs.end(); it_s++)
+        for (size_t j = 0; j < sampleProbs.size(); j++)
         {
-            u -= it_s->second;
+            u -= sampleProbs[j];
             if (u < 0.0)
             {
-                const std::vector<unsigned>& v = it_s->first;
-                ca += v[0];
-                cl += v[1];
-                cr += v[2];
+                size_t e = j / this->num_site_rates;
+                ca += events.ancestor[e];
+                cl += events.left[e];
+                cr += events.right[e];
                 endStates[node_index][i] = ca;
                 startStates[node_index][i] = ca;
                 startStates[left][i] = cl;
                 startStates[right][i] = cr;
-                sampledSiteRates[i] = v[3];
+                sampledSiteRates[i] = j % this->num_site_rates;
                 stop = true;
                 break;
             }
@@ -995,6 +972,57 @@ void RevBayesCore::PhyloCTMCClado<charType>::drawJointConditionalAncestralStates
     
 }
 
+/**
+ * Get the compiled table of the events in this event map.
+ * We compile each event map only once between parameter changes, because the map is the same for many nodes.
+ */
+template<class charType>
+const typename RevBayesCore::PhyloCTMCClado<charType>::CladogeneticEventTable& RevBayesCore::PhyloCTMCClado<charType>::getCladogeneticEvents(const std::map<std::vector<unsigned>, double> &event_map)
+{
+    
+    typename std::map<const std::map<std::vector<unsigned>, double>*, CladogeneticEventTable>::iterator table_it = cladogenetic_event_tables.find( &event_map );
+    if ( table_it != cladogenetic_event_tables.end() )
+    {
+        return table_it->second;
+    }
+    
+    CladogeneticEventTable &table = cladogenetic_event_tables[ &event_map ];
+    table.ancestor.reserve( event_map.size() );
+    table.left.reserve( event_map.size() );
+    table.right.reserve( event_map.size() );
+    table.probability.reserve( event_map.size() );
+    for (std::map<std::vector<unsigned>, double>::const_iterator it = event_map.begin(); it != event_map.end(); ++it)
+    {
+        const std::vector<unsigned>& idx = it->first;
+        table.ancestor.push_back( idx[0] );
+        table.left.push_back( idx[1] );
+        table.right.push_back( idx[2] );
+        table.probability.push_back( it->second );
+    }
+    
+    return table;
+}
+
+
+/**
+ * Get the compiled table of the cladogenetic events at this node.
+ */
+template<class charType>
+const typename RevBayesCore::PhyloCTMCClado<charType>::CladogeneticEventTable& RevBayesCore::PhyloCTMCClado<charType>::getCladogeneticEvents(size_t node_index, double age)
+{
+    
+    if ( branchHeterogeneousCladogenesis == true )
+    {
+        return getCladogeneticEvents( heterogeneousCladogenesisMatrices->getValue()[node_index].getEventMap(age) );
+    }
+    else
+    {
+        return getCladogeneticEvents( homogeneousCladogenesisMatrix->getValue().getEventMap(age) );
+    }
+    
+}
+
+
 template<class charType>
 void RevBayesCore::PhyloCTMCClado<charType>::recursivelyDrawJointConditionalAncestralStates(const TopologyNode &node, std::vector<std::vector<charType> >& startStates, std::vector<std::vector<charType> >& endStates, const std::vector<size_t>& sampledSiteRates)
 {
@@ -1005,11 +1033,11 @@ void RevBayesCore::PhyloCTMCClado<charType>::recursivelyDrawJointConditionalAnce
     size_t left = node.getChild(0).getIndex();
     size_t right = node.getChild(1).getIndex();
     
-    std::map<std::vector<unsigned>, double> eventMapProbs = ( branchHeterogeneousCladogenesis ? heterogeneousCladogenesisMatrices->getValue()[node_index].getEventMap(node.getAge()) : homogeneousCladogenesisMatrix->getValue().getEventMap(node.getAge()) );
+    const CladogeneticEventTable& events = getCladogeneticEvents( node_index, node.getAge() );
+    const size_t num_events = events.probability.size();
     
-    std::map<std::vector<unsigned>, double> sampleProbs;
-    std::map<std::vector<unsigned>, double>::iterator it_s;
-    std::map<std::vector<unsigned>, double>::iterator it_p;
+    // the probabilities of the events, in the order of the events
+    std::vector<double> sampleProbs( num_events, 0.0 );
 
     // get transition probabilities
     this->updateTransitionProbabilities( node_index );
@@ -1039,21 +1067,15 @@ void RevBayesCore::PhyloCTMCClado<charType>::recursivelyDrawJointConditionalAnce
         const double* p_right_site_mixture = p_right + cat * this->mixtureOffset + pattern * this->siteOffset;
 
         // iterate over possible end-anagenesis states for each site given start-anagenesis state
-        for (it_p = eventMapProbs.begin(); it_p != eventMapProbs.end(); it_p++)
+        for (size_t e = 0; e < num_events; ++e)
         {
-            // triplet of (A,L,R) states
-            const std::vector<unsigned>& v = it_p->first;
-
-            const double* p_left_site_mixture_j  = p_left_site_mixture  + v[1];
-            const double* p_right_site_mixture_j = p_right_site_mixture + v[2];
-
             // anagenesis prob
-            size_t j = v[0];
+            size_t j = events.ancestor[e];
             double tp_kj = this->transition_prob_matrices[cat][k][j];
             
             // anagenesis + cladogenesis prob
-            sampleProbs[ it_p->first ] = it_p->second * tp_kj * *p_left_site_mixture_j * *p_right_site_mixture_j;
-            sum += sampleProbs[ it_p->first ];
+            sampleProbs[e] = events.probability[e] * tp_kj * p_left_site_mixture[ events.left[e] ] * p_right_site_mixture[ events.right[e] ];
+            sum += sampleProbs[e];
 
         }
 
@@ -1062,15 +1084,14 @@ void RevBayesCore::PhyloCTMCClado<charType>::recursivelyDrawJointConditionalAnce
         charType cl = charType( this->template_state );
         charType cr = charType( this->template_state );
         double u = rng->uniform01() * sum;
-        for (it_s = sampleProbs.begin(); it_s != sampleProbs.end(); it_s++)
+        for (size_t e = 0; e < num_events; e++)
         {
-            u -= it_s->second;
+            u -= sampleProbs[e];
             if (u < 0.0)
             {
-                const std::vector<unsigned>& v = it_s->first;
-                ca += v[0];
-                cl += v[1];
-                cr += v[2];
+                ca += events.ancestor[e];
+                cl += events.left[e];
+                cr += events.right[e];
                 endStates[node_index][i] = ca;
                 startStates[left][i] = cl;
                 startStates[right][i] = cr;
@@ -1166,6 +1187,7 @@ void RevBayesCore::PhyloCTMCClado<charType>::setCladogenesisMatrix(const TypedDa
     branchHeterogeneousCladogenesis = false;
     useObservedCladogenesis = true;
     homogeneousCladogenesisMatrix = cm;
+    cladogenetic_event_tables.clear();
 
     // add the new parameter
     this->addParameter( homogeneousCladogenesisMatrix );
@@ -1196,6 +1218,7 @@ void RevBayesCore::PhyloCTMCClado<charType>::setCladogenesisMatrix(const TypedDa
     branchHeterogeneousCladogenesis = true;
     useObservedCladogenesis = true;
     heterogeneousCladogenesisMatrices = cm;
+    cladogenetic_event_tables.clear();
 
     // add the new parameter
     this->addParameter( heterogeneousCladogenesisMatrices );
@@ -1243,7 +1266,7 @@ void RevBayesCore::PhyloCTMCClado<charType>::simulate( const TopologyNode &node,
     }
     
     // get cladogenesis event map (sparse transition probability matrix)
-    std::map<std::vector<unsigned>, double> eventMapProbs = homogeneousCladogenesisMatrix->getValue().getEventMap(node.getAge());
+    const CladogeneticEventTable& events = getCladogeneticEvents( homogeneousCladogenesisMatrix->getValue().getEventMap(node.getAge()) );
     
     // get the character state of this node before cladogenic change
     size_t node_index = node.getIndex();
@@ -1265,19 +1288,15 @@ void RevBayesCore::PhyloCTMCClado<charType>::simulate( const TopologyNode &node,
         cl.setToFirstState();
         cr.setToFirstState();
         double u = rng->uniform01();
-        std::map<std::vector<unsigned>, double>::iterator it;
-        for (it = eventMapProbs.begin(); it != eventMapProbs.end(); it++)
+        for (size_t e = 0; e < events.probability.size(); e++)
         {
-            const std::vector<unsigned>& states = it->first;
-            
-            if ( parentState == states[0] )
+            if ( parentState == events.ancestor[e] )
             {
-                u -= it->second;
+                u -= events.probability[e];
                 if (u < 0.0)
                 {
-//                    std::cout << states[0] << " -> " << states[1] << " | " << states[2] << "\n";
-                    cl += states[1];
-                    cr += states[2];
+                    cl += events.left[e];
+                    cr += events.right[e];
                     left->addCharacter( cl );
                     right->addCharacter( cr );
                     break;
@@ -1567,15 +1586,43 @@ void RevBayesCore::PhyloCTMCClado<charType>::swapParameterInternal(const DagNode
     {
         RevBayesCore::AbstractPhyloCTMCSiteHomogeneous<charType>::swapParameterInternal(oldP, newP);
     }
+    
+    // the compiled event tables belong to the event maps of the old parameters
+    cladogenetic_event_tables.clear();
+}
+
+
+/**
+ * The parameters were restored, so the event maps may have changed.
+ */
+template<class charType>
+void RevBayesCore::PhyloCTMCClado<charType>::restoreSpecialization(const DagNode *restorer)
+{
+    
+    cladogenetic_event_tables.clear();
+    
+    RevBayesCore::AbstractPhyloCTMCSiteHomogeneous<charType>::restoreSpecialization(restorer);
+}
+
+
+/**
+ * A parameter was touched. The event maps may have changed even if the cladogenesis matrices were not
+ * touched directly (e.g., the matrix of an epoch depends on the node age), so we compile them again.
+ */
+template<class charType>
+void RevBayesCore::PhyloCTMCClado<charType>::touchSpecialization(const DagNode *toucher, bool touchAll)
+{
+    
+    cladogenetic_event_tables.clear();
+    
+    RevBayesCore::AbstractPhyloCTMCSiteHomogeneous<charType>::touchSpecialization(toucher, touchAll);
 }
 
 template<class charType>
 void RevBayesCore::PhyloCTMCClado<charType>::updateTransitionProbabilities(size_t node_idx)
 {
 
-    // get cladogenesis event map (sparse transition probability matrix)
     const TopologyNode* node = this->tau->getValue().getNodes()[node_idx];
-    std::map<std::vector<unsigned>, double> eventMapProbs = homogeneousCladogenesisMatrix->getValue().getEventMap(node->getAge());
  
     // first, get the rate matrix for this branch
     RateMatrix_JC jc(this->num_chars);
@@ -1640,6 +1687,9 @@ void RevBayesCore::PhyloCTMCClado<charType>::updateTransitionProbabilities(size_
         }
         else
         {
+            // get cladogenesis event map (sparse transition probability matrix)
+            const CladogeneticEventTable& clado_events = getCladogeneticEvents( homogeneousCladogenesisMatrix->getValue().getEventMap(node->getAge()) );
+            
             // get cladogenetic transition probs (assumes they are constant w/r/t age)
             TransitionProbabilityMatrix cp(this->num_chars);
             for (size_t i = 0; i < this->num_chars; i++)
@@ -1647,14 +1697,9 @@ void RevBayesCore::PhyloCTMCClado<charType>::updateTransitionProbabilities(size_
             cp[0][0] = 1.0;
             
             // first compute clado probs at younger end of branch
-            for (std::map<std::vector<unsigned>, double>::iterator it = eventMapProbs.begin(); it != eventMapProbs.end(); ++it)
+            for (size_t e = 0; e < clado_events.probability.size(); ++e)
             {
-                // sparse elements from map
-                const std::vector<unsigned>& idx = it->first;
-                const size_t i = idx[0];
-                const size_t j = idx[1];
-                double p_clado = it->second;
-                cp[i][j] += p_clado;
+                cp[ clado_events.ancestor[e] ][ clado_events.left[e] ] += clado_events.probability[e];
             }
             
             
@@ -1735,7 +1780,7 @@ void RevBayesCore::PhyloCTMCClado<charType>::redrawValue( void )
             std::vector<bool> taxon_mask = std::vector<bool>(this->num_sites,false);
             
             const std::string &taxon_name = this->tau->getValue().getNode( i ).getName();
-            AbstractDiscreteTaxonData& taxon = this->value->getTaxonData( taxon_name );
+            const AbstractDiscreteTaxonData& taxon = this->value->getTaxonData( taxon_name );
             
             for ( size_t site=0; site<this->num_sites; ++site)
             {
@@ -1868,10 +1913,9 @@ void RevBayesCore::PhyloCTMCClado<charType>::redrawValue( void )
             
             for ( size_t site=0; site<this->num_sites; ++site)
             {
-                DiscreteCharacterState &c = taxon.getCharacter(site);
                 if ( mask[i][site] == true )
                 {
-                    c.setGapState( true );
+                    taxon.setGapState( site, true );
                 }
             }
             
@@ -207,8 +207,8 @@ std::vector<size_t> RevBayesCore::PhyloCTMCSiteHomogeneousConditional<charType>:
         {
             if ( (*it)->isTip() )
             {
-                AbstractDiscreteTaxonData& taxon = this->value->getTaxonData( (*it)->getName() );
-                DiscreteCharacterState &c = taxon.getCharacter(siteIndex);
+                const AbstractDiscreteTaxonData& taxon = this->value->getTaxonData( (*it)->getName() );
+                const DiscreteCharacterState &c = taxon.getCharacter(siteIndex);
 
                 bool gap = c.isGapState();
                 // if we treat unknown characters as gaps and this is an unknown character then we change it
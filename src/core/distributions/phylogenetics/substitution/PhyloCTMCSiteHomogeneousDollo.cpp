@@ -34,6 +34,8 @@ RevBayesCore::PhyloCTMCSiteHomogeneousDollo::PhyloCTMCSiteHomogeneousDollo(const
     massNodeOffset = this->num_site_mixtures*numCorrectionMasks;
     activeMassOffset = this->num_nodes*massNodeOffset;
     perMaskMixtureCorrections = std::vector<double>(2*activeMassOffset, 0.0);
+    perMaskMixtureSubtreeCorrections = std::vector<double>(2*activeMassOffset, 0.0);
+    perNodeSiteLogIntegratedLikelihoods = std::vector<double>(2*this->num_nodes*this->pattern_block_size, 0.0);
 
     death_rate = NULL;
     this->addParameter(death_rate);
@@ -57,6 +59,8 @@ RevBayesCore::PhyloCTMCSiteHomogeneousDollo::PhyloCTMCSiteHomogeneousDollo(const
         integrationFactors(n.integrationFactors),
         maskNodeObservationCounts(n.maskNodeObservationCounts),
         survival(n.survival),
+        perMaskMixtureSubtreeCorrections(n.perMaskMixtureSubtreeCorrections),
+        perNodeSiteLogIntegratedLikelihoods(n.perNodeSiteLogIntegratedLikelihoods),
         activeMassOffset(n.activeMassOffset),
         massNodeOffset(n.massNodeOffset),
         normalize(n.normalize),
@@ -77,6 +81,8 @@ void RevBayesCore::PhyloCTMCSiteHomogeneousDollo::resizeLikelihoodVectors( void
     massNodeOffset = num_site_mixtures*numCorrectionMasks;
     activeMassOffset = num_nodes*massNodeOffset;
     perMaskMixtureCorrections = std::vector<double>(2*activeMassOffset, 0.0);
+    perMaskMixtureSubtreeCorrections = std::vector<double>(2*activeMassOffset, 0.0);
+    perNodeSiteLogIntegratedLikelihoods = std::vector<double>(2*num_nodes*pattern_block_size, 0.0);
 
     maskNodeObservationCounts = std::vector<std::vector<size_t> >(numCorrectionMasks, std::vector<size_t>(num_nodes, 0) );
 
@@ -223,12 +229,6 @@ void RevBayesCore::PhyloCTMCSiteHomogeneousDollo::updateTransitionProbabilities(
             }
         }
     }
-    TransitionProbabilityMatrix m1 = transition_prob_matrices[0];
-    TransitionProbabilityMatrix m2 = transition_prob_matrices[1];
-    TransitionProbabilityMatrix m3 = transition_prob_matrices[2];
-    TransitionProbabilityMatrix m4 = transition_prob_matrices[3];
-
-    return;
 }
 
 
@@ -787,6 +787,8 @@ void RevBayesCore::PhyloCTMCSiteHomogeneousDollo::computeTipCorrection(const Top
             c_mask_mixture[mixture] = computeIntegratedNodeCorrection(partialNodeCorrections, node_index, mask, mixture, branch_heterogeneous_substitution_matrices ? ff[node_index % ff.size()] : ff[mixture % ff.size()]);
         }
     }
+
+    updateSubtreeCorrections(node_index, std::vector<size_t>());
 }
 
 void RevBayesCore::PhyloCTMCSiteHomogeneousDollo::computeInternalNodeCorrection(const TopologyNode &node, size_t node_index, size_t left, size_t right, size_t middle)
@@ -875,6 +877,12 @@ void RevBayesCore::PhyloCTMCSiteHomogeneousDollo::computeInternalNodeCorrection(
             c_mask_mixture[mixture] = computeIntegratedNodeCorrection(partialNodeCorrections, node_index, mask, mixture, branch_heterogeneous_substitution_matrices ? ff[node_index % ff.size()] : ff[mixture % ff.size()]);
         }
     }
+
+    std::vector<size_t> children;
+    children.push_back(left);
+    children.push_back(right);
+    children.push_back(middle);
+    updateSubtreeCorrections(node_index, children);
 }
 
 void RevBayesCore::PhyloCTMCSiteHomogeneousDollo::computeInternalNodeCorrection(const TopologyNode &node, size_t node_index, size_t left, size_t right)
@@ -951,6 +959,11 @@ void RevBayesCore::PhyloCTMCSiteHomogeneousDollo::computeInternalNodeCorrection(
             c_mask_mixture[mixture] = computeIntegratedNodeCorrection(partialNodeCorrections, node_index, mask, mixture, branch_heterogeneous_substitution_matrices ? ff[node_index % ff.size()] : ff[mixture % ff.size()]);
         }
     }
+
+    std::vector<size_t> children;
+    children.push_back(left);
+    children.push_back(right);
+    updateSubtreeCorrections(node_index, children);
 }
 
 void RevBayesCore::PhyloCTMCSiteHomogeneousDollo::computeRootCorrection( size_t root, size_t left, size_t right, size_t middle)
@@ -1035,6 +1048,12 @@ void RevBayesCore::PhyloCTMCSiteHomogeneousDollo::computeRootCorrection( size_t
             c_mask_mixture[mixture] = computeIntegratedNodeCorrection(partialNodeCorrections, root, mask, mixture, f);
         }
     }
+
+    std::vector<size_t> children;
+    children.push_back(left);
+    children.push_back(right);
+    children.push_back(middle);
+    updateSubtreeCorrections(root, children);
 }
 
 void RevBayesCore::PhyloCTMCSiteHomogeneousDollo::computeRootCorrection( size_t root, size_t left, size_t right)
@@ -1108,6 +1127,11 @@ void RevBayesCore::PhyloCTMCSiteHomogeneousDollo::computeRootCorrection( size_t
             c_mask_mixture[mixture] = computeIntegratedNodeCorrection(partialNodeCorrections, root, mask, mixture, f);
         }
     }
+
+    std::vector<size_t> children;
+    children.push_back(left);
+    children.push_back(right);
+    updateSubtreeCorrections(root, children);
 }
 
 
@@ -1199,16 +1223,15 @@ double RevBayesCore::PhyloCTMCSiteHomogeneousDollo::sumRootLikelihood( void )
 
     const double*   p_site_root = p_root;
 
+    // the integrated likelihoods of the root already include the origins in all of its subtrees
+    const double*   p_integrated_root = perNodeSiteLogIntegratedLikelihoods.data() + (this->activeLikelihood[root_index]*num_nodes + root_index)*pattern_block_size;
+
     // iterate over all mixture categories
     for (size_t site = 0; site < pattern_block_size; ++site)
     {
         if ( RbSettings::userSettings().getUseScaling() )
         {
-            std::vector<double> integrated_likelihoods;
-
-            double max = getScaledNodeWeights(root, site, integrated_likelihoods);
-
-            per_mixture_Likelihoods[site] = RbMath::log_sum_exp(integrated_likelihoods, max);
+            per_mixture_Likelihoods[site] = p_integrated_root[site];
         }
         else
         {
@@ -1289,18 +1312,18 @@ double RevBayesCore::PhyloCTMCSiteHomogeneousDollo::sumRootLikelihood( void )
 
     std::vector<double> perMaskCorrections = std::vector<double>(numCorrectionMasks, 0.0);
 
+    // the corrections of the root are already summed over all nodes of the tree
+    std::vector<double>::const_iterator c_root = perMaskMixtureSubtreeCorrections.begin() + this->activeLikelihood[root_index]*activeMassOffset + root_index*massNodeOffset;
+
     // iterate over each correction mask
     for (size_t mask = 0; mask < numCorrectionMasks; mask++)
     {
-        for (size_t node = 0; node < num_nodes; ++node)
-        {
-            std::vector<double>::iterator c_node_mixture   = perMaskMixtureCorrections.begin() + this->activeLikelihood[node]*activeMassOffset + node*massNodeOffset;
+        std::vector<double>::const_iterator c_root_mixture = c_root + num_site_mixtures*mask;
 
-            // iterate over all mixture categories
-            for (size_t mixture = 0; mixture < num_site_mixtures; ++mixture)
-            {
-                perMaskCorrections[mask] += c_node_mixture[mixture];
-            }
+        // iterate over all mixture categories
+        for (size_t mixture = 0; mixture < num_site_mixtures; ++mixture)
+        {
+            perMaskCorrections[mask] += c_root_mixture[mixture];
         }
         
         if (perMaskCorrections[mask] <= 0.0)
@@ -1318,57 +1341,92 @@ double RevBayesCore::PhyloCTMCSiteHomogeneousDollo::sumRootLikelihood( void )
     return sumPartialProbs;
 }
 
-double RevBayesCore::PhyloCTMCSiteHomogeneousDollo::getScaledNodeWeights(const TopologyNode &node, size_t pattern, std::vector<double>& weights)
+/**
+ * Compute the log likelihood of each pattern integrated over all possible origins of the character within the subtree of this node.
+ * The character can originate at this node, or further down on the single path towards the observed taxa if only one child has
+ * observed descendants. This is computed once per node after scaling, so that the root only needs to look up its own value
+ * instead of walking down the tree for every pattern.
+ */
+void RevBayesCore::PhyloCTMCSiteHomogeneousDollo::updateIntegratedLikelihoods(size_t node_index, const std::vector<size_t>& children)
 {
-    //reset the per site likelihood
-    double max = RbConstants::Double::neginf;
+    const double*   p_node          = partialLikelihoods + activeLikelihood[node_index] * activeLikelihoodOffset  + node_index*nodeOffset;
+    const double*   log_scaling     = perNodeSiteLogScalingFactors[activeLikelihood[node_index]][node_index].data();
+    double*         p_integrated    = perNodeSiteLogIntegratedLikelihoods.data() + (activeLikelihood[node_index]*num_nodes + node_index)*pattern_block_size;
 
-    size_t node_index = node.getIndex();
+    for (size_t site = 0; site < pattern_block_size; ++site)
+    {
+        // the origin at this node, summed over the mixture categories which all share the same scaling factor
+        const double* p_site_mixture = p_node + site*siteOffset;
+        double prob = 0.0;
+        for (size_t mixture = 0; mixture < num_site_mixtures; ++mixture)
+        {
+            prob += p_site_mixture[dim + 1];
 
-    const double* p_node  = partialLikelihoods + activeLikelihood[node_index] * activeLikelihoodOffset  + node_index*nodeOffset + pattern*siteOffset;
+            p_site_mixture += mixtureOffset;
+        }
 
-    double logScalingFactor = perNodeSiteLogScalingFactors[activeLikelihood[node_index]][node_index][pattern];
+        double ln_prob = RbConstants::Double::neginf;
+        if ( prob > 0.0 )
+        {
+            ln_prob = log(prob) - log_scaling[site];
+        }
 
-    //otherwise, it is an ancestral node so we add the integrated likelihood
-    for (size_t mixture = 0; mixture < num_site_mixtures; ++mixture)
-    {
-        double prob = log(p_node[dim + 1]) - logScalingFactor;
+        // the origins further down, if exactly one child has observed descendants
+        size_t num_with_descendants = 0;
+        size_t child_with_descendants = 0;
+        for (size_t i = 0; i < children.size(); ++i)
+        {
+            size_t child_index = children[i];
+            const double* p_child = partialLikelihoods + activeLikelihood[child_index] * activeLikelihoodOffset + child_index*nodeOffset + site*siteOffset;
 
-        max = std::max(prob, max);
+            if (p_child[dim] == 0)
+            {
+                child_with_descendants = child_index;
+                num_with_descendants++;
+            }
+        }
 
-        weights.push_back( prob );
+        if (num_with_descendants == 1)
+        {
+            double ln_child_prob = perNodeSiteLogIntegratedLikelihoods[(activeLikelihood[child_with_descendants]*num_nodes + child_with_descendants)*pattern_block_size + site];
 
-        p_node += mixtureOffset;
+            if ( ln_prob == RbConstants::Double::neginf )
+            {
+                ln_prob = ln_child_prob;
+            }
+            else if ( ln_child_prob != RbConstants::Double::neginf )
+            {
+                double max = std::max(ln_prob, ln_child_prob);
+                ln_prob = max + log1p( exp( std::min(ln_prob, ln_child_prob) - max ) );
+            }
+        }
+
+        p_integrated[site] = ln_prob;
     }
+}
 
-    if (node.isTip())
-        return max;
 
-    std::vector<TopologyNode*> children = node.getChildren();
+/**
+ * Sum the ascertainment corrections of this node and of all nodes in its subtree.
+ * Only the nodes on the path of a change need to be updated, and the root holds the correction for the whole tree.
+ */
+void RevBayesCore::PhyloCTMCSiteHomogeneousDollo::updateSubtreeCorrections(size_t node_index, const std::vector<size_t>& children)
+{
+    std::vector<double>::const_iterator c_node      = perMaskMixtureCorrections.begin() + this->activeLikelihood[node_index]*activeMassOffset + node_index*massNodeOffset;
+    std::vector<double>::iterator       c_subtree   = perMaskMixtureSubtreeCorrections.begin() + this->activeLikelihood[node_index]*activeMassOffset + node_index*massNodeOffset;
 
-    TopologyNode* child = NULL;
-    size_t num_with_descendants = 0;
+    std::copy(c_node, c_node + massNodeOffset, c_subtree);
 
-    for (size_t i = 0; i < children.size(); i++)
+    for (size_t i = 0; i < children.size(); ++i)
     {
-        size_t child_index = children[i]->getIndex();
-        const double* p_child  = partialLikelihoods + activeLikelihood[child_index]  * activeLikelihoodOffset + child_index*nodeOffset  + pattern*siteOffset;
+        size_t child_index = children[i];
+        std::vector<double>::const_iterator c_child = perMaskMixtureSubtreeCorrections.begin() + this->activeLikelihood[child_index]*activeMassOffset + child_index*massNodeOffset;
 
-        // does this child have descendants?
-        if (p_child[dim] == 0)
+        for (size_t j = 0; j < massNodeOffset; ++j)
         {
-            child = children[i];
-            num_with_descendants++;
+            c_subtree[j] += c_child[j];
         }
     }
-
-    //if more than one child has observed descendants, then this is the last ancestral node
-    if (num_with_descendants == 1)
-    {
-        max = std::max(max, getScaledNodeWeights(*child, pattern, weights));
-    }
-
-    return max;
 }
 
 void RevBayesCore::PhyloCTMCSiteHomogeneousDollo::scale( size_t node_index)
@@ -1431,6 +1489,11 @@ void RevBayesCore::PhyloCTMCSiteHomogeneousDollo::scale( size_t node_index)
         }
 
     }
+
+    if ( RbSettings::userSettings().getUseScaling() == true )
+    {
+        updateIntegratedLikelihoods(node_index, std::vector<size_t>());
+    }
 }
 
 
@@ -1494,6 +1557,14 @@ void RevBayesCore::PhyloCTMCSiteHomogeneousDollo::scale( size_t node_index, size
         }
 
     }
+
+    if ( RbSettings::userSettings().getUseScaling() == true )
+    {
+        std::vector<size_t> children;
+        children.push_back(left);
+        children.push_back(right);
+        updateIntegratedLikelihoods(node_index, children);
+    }
 }
 
 void RevBayesCore::PhyloCTMCSiteHomogeneousDollo::scale( size_t node_index, size_t left, size_t right, size_t middle )
@@ -1556,6 +1627,15 @@ void RevBayesCore::PhyloCTMCSiteHomogeneousDollo::scale( size_t node_index, size
         }
 
     }
+
+    if ( RbSettings::userSettings().getUseScaling() == true )
+    {
+        std::vector<size_t> children;
+        children.push_back(left);
+        children.push_back(right);
+        children.push_back(middle);
+        updateIntegratedLikelihoods(node_index, children);
+    }
 }
 
 /** Swap a parameter of the distribution */
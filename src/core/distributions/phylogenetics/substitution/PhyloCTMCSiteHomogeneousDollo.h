@@ -68,6 +68,8 @@ template <class valueType> class TypedDagNode;
             std::vector<double>                                 integrationFactors;
             std::vector< std::vector<size_t> >                  maskNodeObservationCounts;
             std::vector<double>                                 survival;
+            std::vector<double>                                 perMaskMixtureSubtreeCorrections;       //!< The corrections summed over each subtree, indexed like perMaskMixtureCorrections
+            std::vector<double>                                 perNodeSiteLogIntegratedLikelihoods;    //!< The log likelihood of each pattern integrated over the origins in each subtree
             size_t                                              activeMassOffset;
             size_t                                              massNodeOffset;
 
@@ -75,7 +77,8 @@ template <class valueType> class TypedDagNode;
             const TypedDagNode< double >*                       death_rate;
 
         private:
-            double                                              getScaledNodeWeights(const TopologyNode &node, size_t pattern, std::vector<double>& weights);
+            void                                                updateIntegratedLikelihoods(size_t node_index, const std::vector<size_t>& children);
+            void                                                updateSubtreeCorrections(size_t node_index, const std::vector<size_t>& children);
             void                                                scale(size_t i);
             void                                                scale(size_t i, size_t l, size_t r);
             void                                                scale(size_t i, size_t l, size_t r, size_t m);
@@ -1,7 +1,10 @@
 #include <stddef.h>
+#include <algorithm>
 #include <cmath>
+#include <functional>
 #include <iostream>
 #include <map>
+#include <queue>
 #include <set>
 #include <string>
 #include <utility>
@@ -13,6 +16,7 @@
 #include "RandomNumberGenerator.h"
 #include "RbConstants.h"
 #include "RbMathCombinatorialFunctions.h"
+#include "StochasticNode.h"
 #include "TopologyNode.h"
 #include "RbException.h"
 #include "Taxon.h"
@@ -153,14 +157,113 @@ double AbstractMultispeciesCoalescent::drawNe( size_t index )
 }
 
 
+/**
+ * Compute the coalescent events of the gene lineages entering the species branch.
+ * We go through the coalescences in the order of their ages until the next one is older than the branch.
+ * The gene tree is incompatible with the species tree if a coalescence in the branch involves a lineage of another branch.
+ */
+void AbstractMultispeciesCoalescent::computeSpeciesBranch( SpeciesBranch &b )
+{
+    
+    b.coalescent_times.clear();
+    b.compatible = true;
+    
+    const std::vector<TopologyNode*> &gene_nodes = value->getNodes();
+    if ( in_branch.size() != gene_nodes.size() )
+    {
+        in_branch = std::vector<bool>( gene_nodes.size(), false );
+        queued    = std::vector<bool>( gene_nodes.size(), false );
+    }
+    
+    // the coalescences we may see next, the youngest first
+    std::priority_queue< std::pair<double, size_t>, std::vector< std::pair<double, size_t> >, std::greater< std::pair<double, size_t> > > coalescences;
+    std::vector<size_t> touched_parents;
+    for (size_t i = 0; i < b.incoming_lineages.size(); ++i)
+    {
+        const TopologyNode *ind = gene_nodes[ b.incoming_lineages[i] ];
+        in_branch[ ind->getIndex() ] = true;
+        if ( ind->isRoot() == false && queued[ ind->getParent().getIndex() ] == false )
+        {
+            const TopologyNode &parent = ind->getParent();
+            queued[ parent.getIndex() ] = true;
+            touched_parents.push_back( parent.getIndex() );
+            coalescences.push( std::make_pair( parent.getAge(), parent.getIndex() ) );
+        }
+    }
+    
+    std::vector<size_t> new_lineages;
+    while ( coalescences.empty() == false && coalescences.top().first < b.parent_age )
+    {
+        const TopologyNode *parent = gene_nodes[ coalescences.top().second ];
+        coalescences.pop();
+        
+        // get the left and right child of the parent
+        size_t left  = parent->getChild( 0 ).getIndex();
+        size_t right = parent->getChild( 1 ).getIndex();
+        if ( in_branch[left] == false || in_branch[right] == false )
+        {
+            // one of the children does not belong to this species tree branch
+            b.compatible = false;
+            break;
+        }
+        
+        // we replace the coalesced lineages by their parent
+        in_branch[left]  = false;
+        in_branch[right] = false;
+        in_branch[ parent->getIndex() ] = true;
+        new_lineages.push_back( parent->getIndex() );
+        if ( parent->isRoot() == false && queued[ parent->getParent().getIndex() ] == false )
+        {
+            const TopologyNode &grand_parent = parent->getParent();
+            queued[ grand_parent.getIndex() ] = true;
+            touched_parents.push_back( grand_parent.getIndex() );
+            coalescences.push( std::make_pair( grand_parent.getAge(), grand_parent.getIndex() ) );
+        }
+        
+        b.coalescent_times.push_back( parent->getAge() );
+    }
+    
+    // collect the lineages that leave the branch and reset the scratch flags
+    b.outgoing_lineages.clear();
+    for (size_t i = 0; i < b.incoming_lineages.size(); ++i)
+    {
+        if ( in_branch[ b.incoming_lineages[i] ] == true )
+        {
+            b.outgoing_lineages.push_back( b.incoming_lineages[i] );
+            in_branch[ b.incoming_lineages[i] ] = false;
+        }
+    }
+    for (size_t i = 0; i < new_lineages.size(); ++i)
+    {
+        if ( in_branch[ new_lineages[i] ] == true )
+        {
+            b.outgoing_lineages.push_back( new_lineages[i] );
+            in_branch[ new_lineages[i] ] = false;
+        }
+    }
+    std::sort( b.outgoing_lineages.begin(), b.outgoing_lineages.end() );
+    for (size_t i = 0; i < touched_parents.size(); ++i)
+    {
+        queued[ touched_parents[i] ] = false;
+    }
+    
+}
+
+
+/**
+ * Compute the probability of the gene lineages in the species branch and, recursively, in all its descendant branches.
+ * We only compute the coalescent events of a branch again if its ages or the lineages entering it have changed;
+ * the probability of the events is cheap to compute and depends on the effective population size, so we always compute it.
+ */
 double AbstractMultispeciesCoalescent::recursivelyComputeLnProbability( const RevBayesCore::TopologyNode &species_node )
 {
 
     double ln_prob_coal = 0;
+    size_t index = species_node.getIndex();
 
     if ( species_node.isTip() == false )
     {
-        individuals_per_branch[ species_node.getIndex() ].clear();
+        individuals_per_branch[ index ].clear();
         
         for (size_t i=0; i<species_node.getNumberOfChildren(); ++i)
         {
@@ -168,96 +271,42 @@ double AbstractMultispeciesCoalescent::recursivelyComputeLnProbability( const Re
         }
     }
     
-//    const TopologyNode *species_parent_node = NULL;
     double species_age = species_node.getAge();
     double parent_species_age = RbConstants::Double::inf;
-    
-    //        double branchLength = RbConstants::Double::inf;
     if ( species_node.isRoot() == false )
     {
         const TopologyNode &species_parent_node = species_node.getParent();
         parent_species_age = species_parent_node.getAge();
     }
     
-    // create a local copy of the individuals per branch
-    const std::set<const TopologyNode*> &initial_individuals = individuals_per_branch[species_node.getIndex()];
-    std::set<const TopologyNode*> remaining_individuals = initial_individuals;
-
     // get all coalescent events among the individuals
-    std::vector<double> coal_times;
-    
-    
-    std::map<double, const TopologyNode *> coal_times_2_nodes;
-    for ( std::set<const TopologyNode*>::iterator it = remaining_individuals.begin(); it != remaining_individuals.end(); ++it)
+    const std::vector<size_t> &initial_individuals = individuals_per_branch[index];
+    SpeciesBranch &b = species_branches[index];
+    if ( b.age != species_age || b.parent_age != parent_species_age || b.incoming_lineages != initial_individuals )
     {
-        const TopologyNode *ind = (*it);
-        if ( ind->isRoot() == false )
-        {
-            const TopologyNode &parent = ind->getParent();
-            double parent_age = parent.getAge();
-            coal_times_2_nodes[ parent_age ] = &parent;
-        }
+        b.age               = species_age;
+        b.parent_age        = parent_species_age;
+        b.incoming_lineages = initial_individuals;
+        computeSpeciesBranch( b );
     }
     
-    double current_time = species_age;
-    while ( current_time < parent_species_age && coal_times_2_nodes.size() > 0 )
+    if ( b.compatible == false )
     {
-        
-        const TopologyNode *parent = coal_times_2_nodes.begin()->second;
-        double parent_age = parent->getAge();
-        current_time = parent_age;
-        
-        if ( parent_age < parent_species_age )
-        { //Coalescence in the species tree branch
-            
-            // get the left and right child of the parent
-            const TopologyNode *left = &parent->getChild( 0 );
-            const TopologyNode *right = &parent->getChild( 1 );
-            if ( remaining_individuals.find( left ) == remaining_individuals.end() || remaining_individuals.find( right ) == remaining_individuals.end() )
-            {
-                // one of the children does not belong to this species tree branch
-                return RbConstants::Double::neginf;
-            }
-            
-            //We remove the coalescent event and the coalesced lineages
-            coal_times_2_nodes.erase( coal_times_2_nodes.begin() );
-            remaining_individuals.erase( remaining_individuals.find( left ) );
-            remaining_individuals.erase( remaining_individuals.find( right ) );
-            
-            //We insert the parent in the vector of lineages in this branch
-            remaining_individuals.insert( parent );
-            if ( parent->isRoot() == false )
-            {
-                const TopologyNode *grand_parent = &parent->getParent();
-                coal_times_2_nodes[ grand_parent->getAge() ] = grand_parent;
-            }
-            
-            coal_times.push_back( parent_age );
-            
-            
-        } //End if coalescence in the species tree branch
-        else
-        { //No more coalescences in this species tree branch
-            
-            // jump out of the while loop
-            //                currentTime = speciesAge;
-            break;
-        }
-        
-        
-    } // end of while loop
+        return RbConstants::Double::neginf;
+    }
     
     if ( initial_individuals.size() > 1 )
     {
-        ln_prob_coal += computeLnCoalescentProbability(initial_individuals.size(), coal_times, species_age, parent_species_age, species_node.getIndex(), species_node.isRoot() == false);
+        ln_prob_coal += computeLnCoalescentProbability(initial_individuals.size(), b.coalescent_times, species_age, parent_species_age, index, species_node.isRoot() == false);
     }
     
-    
     // merge the two sets of individuals that go into the next species
     if ( species_node.isRoot() == false )
     {
-        std::set<const TopologyNode *> &incoming_lineages = individuals_per_branch[ species_node.getParent().getIndex() ];
-        incoming_lineages.insert( remaining_individuals.begin(), remaining_individuals.end());
+        std::vector<size_t> &incoming_lineages = individuals_per_branch[ species_node.getParent().getIndex() ];
+        size_t num_incoming = incoming_lineages.size();
+        incoming_lineages.insert( incoming_lineages.end(), b.outgoing_lineages.begin(), b.outgoing_lineages.end() );
+        std::inplace_merge( incoming_lineages.begin(), incoming_lineages.begin() + num_incoming, incoming_lineages.end() );
     }
 
     return ln_prob_coal;
@@ -268,6 +317,22 @@ void AbstractMultispeciesCoalescent::redrawValue( void )
 {
     
     simulateTree();
+    species_branches.clear();
+    
+}
+
+
+/**
+ * Restore the current value.
+ * If the gene tree was restored, then the coalescent events we kept for the species branches are not valid anymore.
+ */
+void AbstractMultispeciesCoalescent::restoreSpecialization( const DagNode *restorer )
+{
+    
+    if ( restorer == dag_node )
+    {
+        species_branches.clear();
+    }
     
 }
 
@@ -298,7 +363,7 @@ void AbstractMultispeciesCoalescent::resetTipAllocations( void )
     }
     
     // create a map for the individuals to branches
-    individuals_per_branch = std::vector< std::set< const TopologyNode* > >(sp.getNumberOfNodes(), std::set< const TopologyNode* >() );
+    individuals_per_branch = std::vector< std::vector<size_t> >(sp.getNumberOfNodes(), std::vector<size_t>() );
     for (size_t i=0; i<num_taxa; ++i)
     {
 //        const std::string &tip_name = it->getName();
@@ -307,7 +372,25 @@ void AbstractMultispeciesCoalescent::resetTipAllocations( void )
         const std::string &species_name = individual_names_2_species_names[ individual_name ];
         
         TopologyNode *species_node = species_names_2_species_nodes[species_name];
-        individuals_per_branch[ species_node->getIndex() ].insert( &n );
+        individuals_per_branch[ species_node->getIndex() ].push_back( n.getIndex() );
+    }
+    for (size_t i=0; i<individuals_per_branch.size(); ++i)
+    {
+        std::sort( individuals_per_branch[i].begin(), individuals_per_branch[i].end() );
+    }
+    
+    // the species tree may have a different number of nodes now
+    if ( species_branches.size() != sp.getNumberOfNodes() )
+    {
+        species_branches.clear();
+    }
+    if ( species_branches.empty() == true )
+    {
+        SpeciesBranch empty_branch;
+        empty_branch.age        = RbConstants::Double::nan;
+        empty_branch.parent_age = RbConstants::Double::nan;
+        empty_branch.compatible = true;
+        species_branches = std::vector<SpeciesBranch>( sp.getNumberOfNodes(), empty_branch );
     }
 
     
@@ -323,6 +406,7 @@ void AbstractMultispeciesCoalescent::setValue(Tree *v, bool f )
     // delegate to super class
     TypedDistribution<Tree>::setValue(v, f);
     
+    species_branches.clear();
     resetTipAllocations();
     
 }
@@ -481,6 +565,22 @@ void AbstractMultispeciesCoalescent::simulateTree( void )
 }
 
 
+/**
+ * Touch the current value.
+ * If the gene tree has changed, then the coalescent events we kept for the species branches are not valid anymore.
+ * If only the species tree has changed, we find the affected branches when we compute the probability.
+ */
+void AbstractMultispeciesCoalescent::touchSpecialization( const DagNode *toucher, bool touchAll )
+{
+    
+    if ( toucher == dag_node || touchAll == true )
+    {
+        species_branches.clear();
+    }
+    
+}
+
+
 /** Swap a parameter of the distribution */
 void AbstractMultispeciesCoalescent::swapParameterInternal(const DagNode *oldP, const DagNode *newP)
 {
@@ -27,6 +27,8 @@ namespace RevBayesCore {
     protected:
         // Parameter management functions
         void                                                swapParameterInternal(const DagNode *oldP, const DagNode *newP);            //!< Swap a parameter
+        virtual void                                        restoreSpecialization(const DagNode *restorer);
+        virtual void                                        touchSpecialization(const DagNode *toucher, bool touchAll);
         virtual double                                      computeLnCoalescentProbability(size_t k, const std::vector<double> &t, double a, double b, size_t index, bool f) = 0;
         virtual double                                      drawNe(size_t index);
 
@@ -43,7 +45,29 @@ namespace RevBayesCore {
         size_t                                              num_taxa;
         double                                              log_tree_topology_prob;
         
-        std::vector< std::set< const TopologyNode* > >      individuals_per_branch;
+        std::vector< std::vector<size_t> >                  individuals_per_branch;                                                     //!< The indices of the gene tree nodes entering each species branch, sorted
+        
+    private:
+        
+        /**
+         * The coalescent events of the gene tree within one branch of the species tree.
+         * The events only depend on the ages of the branch and on the gene lineages that enter it,
+         * so we keep them until one of these changes, or until the gene tree changes.
+         */
+        struct SpeciesBranch {
+            double                                          age;
+            double                                          parent_age;
+            std::vector<size_t>                             incoming_lineages;                                                          //!< The gene tree nodes entering the branch, sorted
+            std::vector<size_t>                             outgoing_lineages;                                                          //!< The gene tree nodes leaving the branch, sorted
+            std::vector<double>                             coalescent_times;
+            bool                                            compatible;                                                                 //!< Can the gene tree be embedded in this branch?
+        };
+        
+        void                                                computeSpeciesBranch(SpeciesBranch &b);
+        
+        std::vector<SpeciesBranch>                          species_branches;
+        std::vector<bool>                                   in_branch;                                                                  //!< Scratch flags for the gene tree nodes in the current branch
+        std::vector<bool>                                   queued;                                                                     //!< Scratch flags for the gene tree nodes whose coalescence we already queued
 
     };
     
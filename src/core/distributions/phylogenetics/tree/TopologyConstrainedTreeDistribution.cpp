@@ -95,8 +95,15 @@ TopologyConstrainedTreeDistribution::TopologyConstrainedTreeDistribution(const T
     base_distribution( d.base_distribution->clone() ),
     dirty_nodes( d.dirty_nodes ),
     monophyly_constraints( d.monophyly_constraints ),
-    stored_backbone_clades( d.stored_backbone_clades ),
-    stored_clades( d.stored_clades ),
+    constraint_clades( d.constraint_clades ),
+    constraint_is_negative( d.constraint_is_negative ),
+    constraint_offsets( d.constraint_offsets ),
+    constraint_index( d.constraint_index ),
+    constraint_matches( d.constraint_matches ),
+    backbone_index( d.backbone_index ),
+    backbone_matches( d.backbone_matches ),
+    clade_changes( d.clade_changes ),
+    clade_changed( d.clade_changed ),
     num_backbones( d.num_backbones ),
     use_multiple_backbones( d.use_multiple_backbones ),
     starting_tree( (d.starting_tree==NULL ? NULL : d.starting_tree->clone()) ),
@@ -163,8 +170,15 @@ TopologyConstrainedTreeDistribution& TopologyConstrainedTreeDistribution::operat
         base_distribution               = d.base_distribution->clone();
         dirty_nodes                     = d.dirty_nodes;
         monophyly_constraints           = d.monophyly_constraints;
-        stored_backbone_clades          = d.stored_backbone_clades;
-        stored_clades                   = d.stored_clades;
+        constraint_clades               = d.constraint_clades;
+        constraint_is_negative          = d.constraint_is_negative;
+        constraint_offsets              = d.constraint_offsets;
+        constraint_index                = d.constraint_index;
+        constraint_matches              = d.constraint_matches;
+        backbone_index                  = d.backbone_index;
+        backbone_matches                = d.backbone_matches;
+        clade_changes                   = d.clade_changes;
+        clade_changed                   = d.clade_changed;
         num_backbones                   = d.num_backbones;
         use_multiple_backbones          = d.use_multiple_backbones;
         starting_tree                   = (d.starting_tree == NULL ? NULL : d.starting_tree->clone());
@@ -288,6 +302,48 @@ void TopologyConstrainedTreeDistribution::initializeBitSets(void)
         backbone_mask[0] |= recursivelyAddBackboneConstraints( backbone_topology->getValue().getRoot(), 0 );
     }
     
+    // compile the monophyly constraints, with the optional constraints one after the other,
+    // into an index from the clade to the constraints with this clade
+    constraint_clades.clear();
+    constraint_is_negative.clear();
+    constraint_offsets.clear();
+    constraint_index.clear();
+    for (size_t i = 0; i < monophyly_constraints.size(); i++)
+    {
+        constraint_offsets.push_back( constraint_clades.size() );
+        if ( monophyly_constraints[i].isOptionalConstraint() == true )
+        {
+            const std::vector<Clade> &optional_constraints = monophyly_constraints[i].getOptionalConstraints();
+            for (size_t j = 0; j < optional_constraints.size(); j++)
+            {
+                constraint_clades.push_back( optional_constraints[j].getBitRepresentation() );
+                constraint_is_negative.push_back( optional_constraints[j].isNegativeConstraint() );
+            }
+        }
+        else
+        {
+            constraint_clades.push_back( monophyly_constraints[i].getBitRepresentation() );
+            constraint_is_negative.push_back( monophyly_constraints[i].isNegativeConstraint() );
+        }
+    }
+    constraint_offsets.push_back( constraint_clades.size() );
+    for (size_t k = 0; k < constraint_clades.size(); k++)
+    {
+        constraint_index[ constraint_clades[k] ].push_back( k );
+    }
+    
+    // and the same for the clades of the backbones
+    backbone_index = std::vector<std::map<RbBitSet, std::vector<size_t> > >( num_backbones );
+    for (size_t i = 0; i < num_backbones; i++)
+    {
+        for (size_t j = 0; j < backbone_constraints[i].size(); j++)
+        {
+            backbone_index[i][ backbone_constraints[i][j] ].push_back( j );
+        }
+    }
+    
+    recountCladeMatches();
+    
 }
 
 
@@ -338,15 +394,16 @@ bool TopologyConstrainedTreeDistribution::matchesBackbone( void )
         std::vector<bool> negative_constraint_found( backbone_constraints[i].size(), false );
         for (size_t j = 0; j < backbone_constraints[i].size(); j++)
         {
-            std::vector<RbBitSet>::iterator it = std::find(active_backbone_clades[i].begin(), active_backbone_clades[i].end(), backbone_constraints[i][j] );
+            // the number of nodes with this backbone clade is kept up to date when the clades change
+            bool found = ( backbone_matches[i][j] > 0 );
             
             // the search fails if the positive/negative backbone constraint is not satisfied
-            if (it == active_backbone_clades[i].end() && !is_negative_constraint )
+            if ( found == false && !is_negative_constraint )
             {
                 // match fails if positive constraint is not found
                 return false;
             }
-            else if (it != active_backbone_clades[i].end() && is_negative_constraint )
+            else if ( found == true && is_negative_constraint )
             {
                 // match fails if negative constraint is found
                 negative_constraint_found[j] = true;
@@ -383,37 +440,13 @@ bool TopologyConstrainedTreeDistribution::matchesConstraints( void )
     for (size_t i = 0; i < monophyly_constraints.size(); i++)
     {
         
-        std::vector<Clade> constraints;
-        if ( monophyly_constraints[i].isOptionalConstraint() == true )
-        {
-            constraints = monophyly_constraints[i].getOptionalConstraints();
-        }
-        else
-        {
-            constraints.push_back(monophyly_constraints[i]);
-        }
-        
-        std::vector<bool> constraint_satisfied( constraints.size(), false );
-        for (size_t j = 0; j < constraints.size(); j++)
-        {
-            
-            std::vector<RbBitSet>::iterator it = std::find(active_clades.begin(), active_clades.end(), constraints[j].getBitRepresentation() );
-            
-            if (it != active_clades.end() && constraints[j].isNegativeConstraint() == false )
-            {
-                constraint_satisfied[j] = true;
-            }
-            else if (it == active_clades.end() && constraints[j].isNegativeConstraint() )
-            {
-                constraint_satisfied[j] = true;
-            }
-        }
-        
         // match fails if no optional positive or negative constraints satisfied
         bool any_satisfied = false;
-        for (size_t j = 0; j < constraint_satisfied.size(); j++)
+        for (size_t k = constraint_offsets[i]; k < constraint_offsets[i+1]; k++)
         {
-            if ( constraint_satisfied[j] == true )
+            // the number of nodes with this clade is kept up to date when the clades change
+            bool found = ( constraint_matches[k] > 0 );
+            if ( found != constraint_is_negative[k] )
             {
                 any_satisfied = true;
                 break;
@@ -430,6 +463,33 @@ bool TopologyConstrainedTreeDistribution::matchesConstraints( void )
 }
 
 
+/**
+ * Recount the number of nodes matching each (backbone) constraint, e.g., after we compiled new constraints.
+ */
+void TopologyConstrainedTreeDistribution::recountCladeMatches( void )
+{
+    
+    constraint_matches = std::vector<size_t>( constraint_clades.size(), 0 );
+    backbone_matches = std::vector<std::vector<size_t> >( num_backbones );
+    active_backbone_clades.resize( num_backbones );
+    for (size_t i = 0; i < num_backbones; i++)
+    {
+        backbone_matches[i] = std::vector<size_t>( backbone_constraints[i].size(), 0 );
+        active_backbone_clades[i].resize( active_clades.size() );
+    }
+    
+    for (size_t idx = 0; idx < active_clades.size(); idx++)
+    {
+        for (size_t i = 0; i < num_backbones; i++)
+        {
+            active_backbone_clades[i][idx] = ( active_clades[idx].size() == 0 ? RbBitSet() : active_clades[idx] & backbone_mask[i] );
+        }
+        updateCladeMatches( idx, true );
+    }
+    
+}
+
+
 void TopologyConstrainedTreeDistribution::recursivelyFlagNodesDirty(const TopologyNode& n)
 {
     
@@ -513,13 +573,7 @@ RbBitSet TopologyConstrainedTreeDistribution::recursivelyUpdateClades( const Top
             
             // update the clade
             size_t idx = node.getIndex() - value->getNumberOfTips();
-            active_clades[idx] = tmp;
-            
-            for (size_t i = 0; i < num_backbones; i++)
-            {
-                active_backbone_clades[i][idx] = tmp & backbone_mask[i];
-            }
-            
+            setActiveClade( idx, tmp );
             
             dirty_nodes[node.getIndex()] = false;
         }
@@ -529,6 +583,21 @@ RbBitSet TopologyConstrainedTreeDistribution::recursivelyUpdateClades( const Top
 }
 
 
+/**
+ * Forget the previous clades of the nodes that changed, because the current clades were accepted.
+ */
+void TopologyConstrainedTreeDistribution::keepCladeChanges( void )
+{
+    
+    for (size_t i = 0; i < clade_changes.size(); i++)
+    {
+        clade_changed[ clade_changes[i].first ] = false;
+    }
+    clade_changes.clear();
+    
+}
+
+
 /**
  * Redraw the current value. We delegate this to the simulate method.
  */
@@ -575,16 +644,85 @@ void TopologyConstrainedTreeDistribution::redrawValue( void )
     base_distribution->setValue( value );
     
     // recompute the active clades
-    dirty_nodes = std::vector<bool>( value->getNumberOfNodes(), true );
-    active_clades = std::vector<RbBitSet>(value->getNumberOfInteriorNodes(), RbBitSet());
+    resetActiveClades();
+}
+
+
 
+
+/**
+ * Recompute the clades of all nodes of the current value, and the number of nodes matching each constraint.
+ */
+void TopologyConstrainedTreeDistribution::resetActiveClades( void )
+{
+    
+    size_t num_interior_nodes = value->getNumberOfInteriorNodes();
+    
+    dirty_nodes     = std::vector<bool>( value->getNumberOfNodes(), true );
+    active_clades   = std::vector<RbBitSet>( num_interior_nodes, RbBitSet() );
+    clade_changed   = std::vector<bool>( num_interior_nodes, false );
+    clade_changes.clear();
+    recountCladeMatches();
+    
     recursivelyUpdateClades( value->getRoot() );
     
-    stored_clades          = active_clades;
-    stored_backbone_clades = active_backbone_clades;
+    keepCladeChanges();
 }
 
 
+/**
+ * Set the changed nodes back to the clades they had at the last touch or keep, and update the match counts.
+ */
+void TopologyConstrainedTreeDistribution::restoreCladeChanges( void )
+{
+    
+    for (size_t i = 0; i < clade_changes.size(); i++)
+    {
+        size_t idx = clade_changes[i].first;
+        
+        updateCladeMatches( idx, false );
+        active_clades[idx].swap( clade_changes[i].second );
+        for (size_t j = 0; j < num_backbones; j++)
+        {
+            active_backbone_clades[j][idx] = ( active_clades[idx].size() == 0 ? RbBitSet() : active_clades[idx] & backbone_mask[j] );
+        }
+        updateCladeMatches( idx, true );
+        
+        clade_changed[idx] = false;
+    }
+    clade_changes.clear();
+    
+}
+
+
+/**
+ * Set the clade of interior node idx.
+ * We remember the previous clade for a restore, and update the number of nodes matching each constraint.
+ */
+void TopologyConstrainedTreeDistribution::setActiveClade( size_t idx, const RbBitSet &c )
+{
+    
+    if ( active_clades[idx] == c )
+    {
+        return;
+    }
+    
+    // we only need the clade at the last touch or keep
+    if ( clade_changed[idx] == false )
+    {
+        clade_changed[idx] = true;
+        clade_changes.push_back( std::make_pair( idx, active_clades[idx] ) );
+    }
+    
+    updateCladeMatches( idx, false );
+    active_clades[idx] = c;
+    for (size_t i = 0; i < num_backbones; i++)
+    {
+        active_backbone_clades[i][idx] = c & backbone_mask[i];
+    }
+    updateCladeMatches( idx, true );
+    
+}
 
 
 void TopologyConstrainedTreeDistribution::setBackbone(const TypedDagNode<Tree> *backbone_one, const TypedDagNode<RbVector<Tree> > *backbone_many)
@@ -1200,12 +1338,7 @@ void TopologyConstrainedTreeDistribution::setValue(Tree *v, bool f )
     initializeBitSets();
     
     // recompute the active clades
-    dirty_nodes = std::vector<bool>( value->getNumberOfNodes(), true );
-    
-    recursivelyUpdateClades( value->getRoot() );
-    
-    stored_clades          = active_clades;
-    stored_backbone_clades = active_backbone_clades;
+    resetActiveClades();
 }
 
 
@@ -1241,8 +1374,7 @@ void TopologyConstrainedTreeDistribution::swapParameterInternal( const DagNode *
  */
 void TopologyConstrainedTreeDistribution::touchSpecialization(const DagNode *affecter, bool touchAll)
 {
-    stored_clades = active_clades;
-    stored_backbone_clades = active_backbone_clades;
+    keepCladeChanges();
     
     // if the root age wasn't the affecter, we'll set it in the base distribution here
     base_distribution->touch(affecter, touchAll);
@@ -1250,17 +1382,54 @@ void TopologyConstrainedTreeDistribution::touchSpecialization(const DagNode *aff
 
 void TopologyConstrainedTreeDistribution::keepSpecialization(const DagNode *affecter)
 {
-    stored_clades = active_clades;
-    stored_backbone_clades = active_backbone_clades;
+    keepCladeChanges();
     
     base_distribution->keep(affecter);
 }
 
 void TopologyConstrainedTreeDistribution::restoreSpecialization(const DagNode *restorer)
 {
-    active_clades = stored_clades;
-    active_backbone_clades = stored_backbone_clades;
+    restoreCladeChanges();
     
     base_distribution->restore(restorer);
     
 }
+
+
+/**
+ * Add the clade of interior node idx to (or remove it from) the number of nodes matching each constraint.
+ * We find the constraints with this clade in the compiled index, so this does not depend on the number of constraints.
+ */
+void TopologyConstrainedTreeDistribution::updateCladeMatches( size_t idx, bool add )
+{
+    
+    // the clade was not computed yet
+    if ( active_clades[idx].size() == 0 )
+    {
+        return;
+    }
+    
+    std::map<RbBitSet, std::vector<size_t> >::const_iterator it = constraint_index.find( active_clades[idx] );
+    if ( it != constraint_index.end() )
+    {
+        for (size_t k = 0; k < it->second.size(); k++)
+        {
+            size_t &matches = constraint_matches[ it->second[k] ];
+            matches = ( add == true ? matches + 1 : matches - 1 );
+        }
+    }
+    
+    for (size_t i = 0; i < num_backbones; i++)
+    {
+        it = backbone_index[i].find( active_backbone_clades[i][idx] );
+        if ( it != backbone_index[i].end() )
+        {
+            for (size_t j = 0; j < it->second.size(); j++)
+            {
+                size_t &matches = backbone_matches[i][ it->second[j] ];
+                matches = ( add == true ? matches + 1 : matches - 1 );
+            }
+        }
+    }
+    
+}
@@ -1,6 +1,10 @@
 #ifndef TopologyConstrainedTreeDistribution_H
 #define TopologyConstrainedTreeDistribution_H
 
+#include <map>
+#include <utility>
+#include <vector>
+
 #include "Clade.h"
 #include "RbVector.h"
 #include "Tree.h"
@@ -58,11 +62,17 @@ namespace RevBayesCore {
         
         
         // helper functions
+        void                                                keepCladeChanges(void);                                             //!< Forget the previous clades of the changed nodes
         bool                                                matchesBackbone(void);
         bool                                                matchesConstraints(void);
+        void                                                recountCladeMatches(void);                                          //!< Recount the matches of all constraints, e.g., after new constraints
         RbBitSet                                            recursivelyAddBackboneConstraints(const TopologyNode& node, size_t backbone_idx);
         void                                                recursivelyFlagNodesDirty(const TopologyNode& n);
         RbBitSet                                            recursivelyUpdateClades(const TopologyNode& node);
+        void                                                resetActiveClades(void);                                            //!< Recompute the clades of all nodes of the current value
+        void                                                restoreCladeChanges(void);                                          //!< Set the changed nodes back to their previous clades
+        void                                                setActiveClade(size_t idx, const RbBitSet &c);
+        void                                                updateCladeMatches(size_t idx, bool add);                           //!< Add or remove the clade of interior node idx from the match counts
         Tree*                                               simulateRootedTree(void);
         Tree*                                               simulateUnrootedTree(void);
 
@@ -79,8 +89,19 @@ namespace RevBayesCore {
         TypedDistribution<Tree>*                            base_distribution;
         std::vector<bool>                                   dirty_nodes;
         std::vector<Clade>                                  monophyly_constraints;
-        std::vector<std::vector<RbBitSet> >                 stored_backbone_clades;
-        std::vector<RbBitSet>                               stored_clades;
+
+        // the constraints compiled into an index from the clade to the constraints, and the number of nodes matching each constraint
+        std::vector<RbBitSet>                               constraint_clades;                                                  //!< The clades of all (optional) monophyly constraints
+        std::vector<bool>                                   constraint_is_negative;
+        std::vector<size_t>                                 constraint_offsets;                                                 //!< The first compiled clade of each monophyly constraint (plus the end)
+        std::map<RbBitSet, std::vector<size_t> >            constraint_index;
+        std::vector<size_t>                                 constraint_matches;
+        std::vector<std::map<RbBitSet, std::vector<size_t> > >  backbone_index;
+        std::vector<std::vector<size_t> >                   backbone_matches;
+
+        // the previous clades of the nodes that changed since the last touch or keep
+        std::vector<std::pair<size_t, RbBitSet> >           clade_changes;
+        std::vector<bool>                                   clade_changed;
         size_t                                              num_backbones;
         bool                                                use_multiple_backbones;
         Tree*                                               starting_tree;
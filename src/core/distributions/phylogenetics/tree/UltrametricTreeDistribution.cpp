@@ -56,7 +56,7 @@ UltrametricTreeDistribution::UltrametricTreeDistribution( TypedDistribution<Tree
     long n_samples = tree_trace.size();
     for (int i=burnin; i<n_samples; ++i)
     {
-        trees.push_back( tree_trace.objectAt( i ) );
+        trees.push_back( *tree_trace.treeAt( i ) );
     }
 
     if ( trees.size() > 0 )
@@ -21,6 +21,7 @@
 #include "RbSettings.h"
 #include "RbVector.h"
 #include "StartingTreeSimulator.h"
+#include "StochasticNode.h"
 #include "TopologyNode.h"
 #include "Tree.h"
 #include "TypedDagNode.h"
@@ -29,6 +30,21 @@ namespace RevBayesCore { class Taxon; }
 
 using namespace RevBayesCore;
 
+
+namespace {
+
+    /** Reorder the first ordering.size() elements of the parameter so that par[i] = old_par[ordering[i]]. */
+    void applyOrdering(std::vector<double> &par, const std::vector<size_t> &ordering)
+    {
+        std::vector<double> old_par = par;
+        for (size_t i=0; i<ordering.size(); ++i)
+        {
+            par[i] = old_par[ordering[i]];
+        }
+    }
+
+}
+
 /**
  * Constructor.
  * We delegate most parameters to the base class and initialize the members.
@@ -71,6 +87,7 @@ BirthDeathSamplingTreatmentProcess::BirthDeathSamplingTreatmentProcess(const Typ
     interval_times_event_speciation(event_sampling_timeline),
     interval_times_event_extinction(event_extinction_timeline),
     interval_times_event_sampling(event_sampling_timeline),
+    timeline_dirty( true ),
     offset( 0.0 )
 {
     // initialize all the pointers to NULL
@@ -238,8 +255,20 @@ void BirthDeathSamplingTreatmentProcess::checkVectorSizes(const TypedDagNode<RbV
 double BirthDeathSamplingTreatmentProcess::computeLnProbabilityDivergenceTimes( void ) const
 {
     
-    // update parameter vectors
-    prepareTimeline();
+    // the parameter vectors and A_i, B_i, C_i, E_i(t_i) only depend on the parameters and the age of the youngest tip,
+    // so we only need to recompute them if one of those has changed since the last time
+    double previous_offset = offset;
+    getOffset();
+    if ( timeline_dirty == true || offset != previous_offset )
+    {
+        // update parameter vectors
+        prepareTimeline();
+
+        // precompute A_i, B_i, C_i, E_i(t_i)
+        prepareProbComputation();
+
+        timeline_dirty = false;
+    }
 
     // Assign nodes to sets
     if ( countAllNodes() )
@@ -252,9 +281,6 @@ double BirthDeathSamplingTreatmentProcess::computeLnProbabilityDivergenceTimes(
         throw RbException("Event sampling fraction at the present is non-zero but there are no tips at the present.");
     }
 
-    // precompute A_i, B_i, C_i, E_i(t_i)
-    prepareProbComputation();
-
     // variable declarations and initialization
     double lnProbTimes = computeLnProbabilityTimes();
     
@@ -630,6 +656,10 @@ bool BirthDeathSamplingTreatmentProcess::countAllNodes(void) const
       }
   }
 
+  // survivors() counts the serial events before a time by binary search
+  std::sort(serial_bifurcation_times.begin(), serial_bifurcation_times.end());
+  std::sort(serial_tip_ages.begin(), serial_tip_ages.end());
+
   return false;
 }
 
@@ -693,8 +723,6 @@ double BirthDeathSamplingTreatmentProcess::E(size_t i, double t, bool computeSur
  */
 size_t BirthDeathSamplingTreatmentProcess::findIndex(double t) const
 {
-    // @TODO @efficiency: this would be much faster if we can get std::lower_bound to work consistently
-    // Linear search for interval because std::lower_bound is not cooperating
     if (global_timeline.size() == 1)
     {
         // If global_timeline.size() is 1, we have 0 break points and are in constant-rate version
@@ -706,15 +734,12 @@ size_t BirthDeathSamplingTreatmentProcess::findIndex(double t) const
     }
     else
     {
-        for (size_t i=0; i < global_timeline.size()-1; ++i)
-        {
-            if (t >= (global_timeline[i]-1E-5) && t < (global_timeline[i+1]-1E-5))
-            {
-                return i;
-            }
-        }
+        // binary search for the number of times s_i with s_i - 1E-5 <= t
+        std::vector<double>::const_iterator it = std::upper_bound(global_timeline.begin(), global_timeline.end(), t, [](double x, double s) { return x < s - 1E-5; });
+        size_t num_before = size_t(it - global_timeline.begin());
 
-        return global_timeline.size() - 1;
+        // times before s_0 are not in any interval and we return the last interval, as the linear search did before
+        return (num_before == 0 ? global_timeline.size() - 1 : num_before - 1);
     }
 }
 
@@ -725,7 +750,6 @@ size_t BirthDeathSamplingTreatmentProcess::findIndex(double t) const
 size_t BirthDeathSamplingTreatmentProcess::findIndex(double t, const std::vector<double> &timeline) const
 {
 
-    // Linear search for interval because std::lower_bound is not cooperating
     if (timeline.size() == 1)
     {
         return 0;
@@ -736,15 +760,11 @@ size_t BirthDeathSamplingTreatmentProcess::findIndex(double t, const std::vector
     }
     else
     {
-        for (size_t i=0; i < timeline.size()-1; ++i)
-        {
-            if (t >= timeline[i] && t < timeline[i+1])
-            {
-                return i;
-            }
-        }
+        // binary search for the number of times x_i <= t
+        size_t num_before = size_t(std::upper_bound(timeline.begin(), timeline.end(), t) - timeline.begin());
 
-        return timeline.size() - 1;
+        // times before x_0 are not in any interval and we return the last interval, as the linear search did before
+        return (num_before == 0 ? timeline.size() - 1 : num_before - 1);
     }
 }
 
@@ -1615,19 +1635,9 @@ int BirthDeathSamplingTreatmentProcess::survivors(double t) const
         survivors = 2;
     }
 
-    for (size_t i=0; i<serial_bifurcation_times.size(); ++i) {
-        if (t < serial_bifurcation_times[i])
-        {
-            survivors++;
-        }
-    }
-
-    for (size_t i=0; i<serial_tip_ages.size(); ++i) {
-        if (t < serial_tip_ages[i])
-        {
-            survivors--;
-        }
-    }
+    // the serial times are sorted by countAllNodes(), so we only need to find the first one older than t
+    survivors += int( serial_bifurcation_times.end() - std::upper_bound(serial_bifurcation_times.begin(), serial_bifurcation_times.end(), t) );
+    survivors -= int( serial_tip_ages.end() - std::upper_bound(serial_tip_ages.begin(), serial_tip_ages.end(), t) );
 
     for (size_t i=0; i<global_timeline.size(); ++i)
     {   
@@ -1705,18 +1715,13 @@ void BirthDeathSamplingTreatmentProcess::sortGlobalTimesAndVectorParameter() con
         else
         {
             // Find ordering of times vector
-            std::vector<size_t> ordering;
+            std::vector<size_t> ordering(global_timeline.size());
             for (size_t i=0; i<global_timeline.size(); ++i)
             {
-                for (size_t j=0; j<global_timeline.size(); ++j)
-                {
-                    if ( times_sorted_ascending[i] == global_timeline[j] )
-                    {
-                        ordering.push_back(j);
-                        break;
-                    }
-                }
+                ordering[i] = i;
             }
+            const std::vector<double> &times = global_timeline;
+            std::stable_sort(ordering.begin(), ordering.end(), [&times](size_t a, size_t b) { return times[a] < times[b]; });
 
             // Replace times with sorted times
             global_timeline = times_sorted_ascending;
@@ -1724,67 +1729,35 @@ void BirthDeathSamplingTreatmentProcess::sortGlobalTimesAndVectorParameter() con
             // Sort all vector parameters
             if (heterogeneous_lambda != NULL)
             {
-                std::vector<double> old_lambda = lambda;
-                for (size_t i=0; i<global_timeline.size(); ++i)
-                {
-                    lambda[i] = old_lambda[ordering[i]];
-                }
+                applyOrdering(lambda, ordering);
             }
             if (heterogeneous_mu != NULL)
             {
-                std::vector<double> old_mu = mu;
-                for (size_t i=0; i<global_timeline.size(); ++i)
-                {
-                    mu[i] = old_mu[ordering[i]];
-                }
+                applyOrdering(mu, ordering);
             }
             if (heterogeneous_phi != NULL)
             {
-                std::vector<double> old_phi = phi;
-                for (size_t i=0; i<global_timeline.size(); ++i)
-                {
-                    phi[i] = old_phi[ordering[i]];
-                }
+                applyOrdering(phi, ordering);
             }
             if (heterogeneous_r != NULL)
             {
-                std::vector<double> old_r = r;
-                for (size_t i=0; i<global_timeline.size(); ++i)
-                {
-                    r[i] = old_r[ordering[i]];
-                }
+                applyOrdering(r, ordering);
             }
             if (heterogeneous_Lambda != NULL)
             {
-                std::vector<double> old_lambda_event = lambda_event;
-                for (size_t i=0; i<global_timeline.size(); ++i)
-                {
-                    lambda_event[i] = old_lambda_event[ordering[i]];
-                }
+                applyOrdering(lambda_event, ordering);
             }
             if (heterogeneous_Mu != NULL)
             {
-                std::vector<double> old_mu_event = mu_event;
-                for (size_t i=0; i<global_timeline.size(); ++i)
-                {
-                    mu_event[i] = old_mu_event[ordering[i]];
-                }
+                applyOrdering(mu_event, ordering);
             }
             if (heterogeneous_Phi != NULL)
             {
-                std::vector<double> old_phi_event = phi_event;
-                for (size_t i=0; i<global_timeline.size(); ++i)
-                {
-                    phi_event[i] = old_phi_event[ordering[i]];
-                }
+                applyOrdering(phi_event, ordering);
             }
             if (heterogeneous_R != NULL)
             {
-                std::vector<double> old_r_event = r_event;
-                for (size_t i=0; i<global_timeline.size(); ++i)
-                {
-                    r_event[i] = old_r_event[ordering[i]];
-                }
+                applyOrdering(r_event, ordering);
             }
 
         }
@@ -1839,6 +1812,39 @@ void BirthDeathSamplingTreatmentProcess::sortNonGlobalTimesAndVectorParameter(st
 
 }
 
+/**
+ * Restore the current value of the distribution.
+ * If a parameter was restored, then the timeline and A_i, B_i, C_i need to be recomputed.
+ */
+void BirthDeathSamplingTreatmentProcess::restoreSpecialization(const DagNode *affecter)
+{
+
+    if ( affecter != dag_node )
+    {
+        timeline_dirty = true;
+    }
+
+    AbstractBirthDeathProcess::restoreSpecialization( affecter );
+}
+
+
+/**
+ * Touch the current value of the distribution.
+ * If only node ages changed, then we can keep the timeline and A_i, B_i, C_i,
+ * but if a parameter changed then we need to recompute them.
+ */
+void BirthDeathSamplingTreatmentProcess::touchSpecialization(const DagNode *affecter, bool touchAll)
+{
+
+    if ( affecter != dag_node || touchAll == true )
+    {
+        timeline_dirty = true;
+    }
+
+    AbstractBirthDeathProcess::touchSpecialization( affecter, touchAll );
+}
+
+
 /**
  * For a time t, determine which if any interval (event) time it corresponds to
  *
@@ -1872,6 +1878,8 @@ int BirthDeathSamplingTreatmentProcess::whichIntervalTime(double t) const
  */
 void BirthDeathSamplingTreatmentProcess::swapParameterInternal(const DagNode *oldP, const DagNode *newP)
 {
+    timeline_dirty = true;
+
     // Rate parameters
     if (oldP == heterogeneous_lambda)
     {
@@ -64,6 +64,8 @@ namespace RevBayesCore {
         double                                          computeLnProbabilityDivergenceTimes(void) const;                        //!< Compute the log-transformed probability of the current value.
         // Parameter management functions
         void                                            swapParameterInternal(const DagNode *oldP, const DagNode *newP);        //!< Swap a parameter
+        void                                            restoreSpecialization(const DagNode *restorer);
+        void                                            touchSpecialization(const DagNode *toucher, bool touchAll);
 
         // helper functions
         void                                            addTimesToGlobalTimeline(std::set<double> &event_times, const TypedDagNode<RbVector<double> > *par_times) const;        //!< Adds timeline for parameter to set that we will use for global timeline
@@ -132,6 +134,7 @@ namespace RevBayesCore {
         mutable std::vector<double>                     serial_bifurcation_times;                              //!< The ages of all bifurcation events in the tree NOT at a burst event
         mutable std::vector<std::vector<double> >       event_bifurcation_times;                               //!< The ages of all bifurcation events in the tree at burst events
 
+        mutable bool                                    timeline_dirty;                                        //!< Do we need to recompute the parameter vectors and A_i, B_i, C_i because a parameter changed?
         mutable double                                  offset;                                                //!< In the case there the most recent tip is at time y, we internally adjust by this time and treat y as the present; this does not affect the boundary times of the rate shifts
         int                                             num_extant_taxa;
 
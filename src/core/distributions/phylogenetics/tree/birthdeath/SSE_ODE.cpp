@@ -1,4 +1,5 @@
 #include <stddef.h>
+#include <algorithm>
 #include <map>
 #include <utility>
 #include <vector>
@@ -10,16 +11,186 @@
 using namespace RevBayesCore;
 
 
+SSE_ODE::EventTensor::EventTensor( void ) :
+    ancestor_offsets( 1, 0 ),
+    daughter_offsets( 1, 0 )
+{
+    
+}
+
+
+/**
+ * Compile the event map into flat arrays.
+ * We sort the events by their ancestor state and by their daughter states with a counting sort,
+ * so that the events of each state keep the order of the event map.
+ */
+SSE_ODE::EventTensor::EventTensor( const std::map<std::vector<unsigned>, double> &e, size_t n ) :
+    ancestor_offsets( n+1, 0 ),
+    ancestor_daughter_1( e.size() ),
+    ancestor_daughter_2( e.size() ),
+    ancestor_rates( e.size() ),
+    speciation_rates( n, 0.0 ),
+    daughter_offsets( n+1, 0 ),
+    daughter_ancestor( 2 * e.size() ),
+    daughter_sister( 2 * e.size() ),
+    daughter_rates( 2 * e.size() )
+{
+    
+    std::map<std::vector<unsigned>, double>::const_iterator it;
+    
+    // count the events of each state
+    for (it = e.begin(); it != e.end(); ++it)
+    {
+        const std::vector<unsigned>& states = it->first;
+        ++ancestor_offsets[ states[0]+1 ];
+        ++daughter_offsets[ states[1]+1 ];
+        ++daughter_offsets[ states[2]+1 ];
+    }
+    for (size_t i = 0; i < n; ++i)
+    {
+        ancestor_offsets[i+1] += ancestor_offsets[i];
+        daughter_offsets[i+1] += daughter_offsets[i];
+    }
+    
+    // fill in the events
+    std::vector<size_t> next_ancestor( ancestor_offsets.begin(), ancestor_offsets.end()-1 );
+    std::vector<size_t> next_daughter( daughter_offsets.begin(), daughter_offsets.end()-1 );
+    for (it = e.begin(); it != e.end(); ++it)
+    {
+        const std::vector<unsigned>& states = it->first;
+        double curr_lambda = it->second;
+        
+        size_t j = next_ancestor[ states[0] ]++;
+        ancestor_daughter_1[j] = states[1];
+        ancestor_daughter_2[j] = states[2];
+        ancestor_rates[j]      = curr_lambda;
+        speciation_rates[ states[0] ] += curr_lambda;
+        
+        j = next_daughter[ states[1] ]++;
+        daughter_ancestor[j]   = states[0];
+        daughter_sister[j]     = states[2];
+        daughter_rates[j]      = curr_lambda;
+        
+        j = next_daughter[ states[2] ]++;
+        daughter_ancestor[j]   = states[0];
+        daughter_sister[j]     = states[1];
+        daughter_rates[j]      = curr_lambda;
+    }
+    
+}
+
+
+SSE_ODE::ExtinctionCurve::ExtinctionCurve( void ) :
+    num_states( 0 )
+{
+    
+}
+
+
+/**
+ * Add the solution at the next age. The ages must be added in increasing order.
+ */
+void SSE_ODE::ExtinctionCurve::addPoint( double a, const std::vector<double> &e, const std::vector<double> &dedt )
+{
+    
+    ages.push_back( a );
+    probabilities.insert( probabilities.end(), e.begin(), e.begin() + num_states );
+    derivatives.insert( derivatives.end(), dedt.begin(), dedt.begin() + num_states );
+}
+
+
+void SSE_ODE::ExtinctionCurve::clear( void )
+{
+    
+    ages.clear();
+    probabilities.clear();
+    derivatives.clear();
+}
+
+
+bool SSE_ODE::ExtinctionCurve::empty( void ) const
+{
+    
+    return ages.empty();
+}
+
+
+double SSE_ODE::ExtinctionCurve::getMaximumAge( void ) const
+{
+    
+    return ( ages.empty() ? 0.0 : ages.back() );
+}
+
+
+/**
+ * Get the extinction probabilities at age a by cubic Hermite interpolation between the two closest points.
+ * Ages outside of the curve get the probabilities at the closest end.
+ */
+void SSE_ODE::ExtinctionCurve::getProbabilities( double a, double *e ) const
+{
+    
+    size_t k = std::upper_bound( ages.begin(), ages.end(), a ) - ages.begin();
+    if ( k == 0 || k == ages.size() )
+    {
+        const double *p = &probabilities[ ( k == 0 ? 0 : ages.size()-1 ) * num_states ];
+        std::copy( p, p + num_states, e );
+        return;
+    }
+    
+    double h   = ages[k] - ages[k-1];
+    double s   = ( a - ages[k-1] ) / h;
+    double s2  = s * s;
+    double s3  = s2 * s;
+    double h00 = 2.0 * s3 - 3.0 * s2 + 1.0;
+    double h10 = ( s3 - 2.0 * s2 + s ) * h;
+    double h01 = -2.0 * s3 + 3.0 * s2;
+    double h11 = ( s3 - s2 ) * h;
+    
+    const double *p0 = &probabilities[ (k-1) * num_states ];
+    const double *p1 = &probabilities[ k * num_states ];
+    const double *m0 = &derivatives[ (k-1) * num_states ];
+    const double *m1 = &derivatives[ k * num_states ];
+    for (size_t i = 0; i < num_states; ++i)
+    {
+        e[i] = h00 * p0[i] + h10 * m0[i] + h01 * p1[i] + h11 * m1[i];
+    }
+    
+}
+
+
 SSE_ODE::SSE_ODE( const std::vector<double> &m, const RateGenerator* q, double r, bool backward_time, bool extinction_only, bool allow_shifts_extinct ) :
     mu( m ),
     num_states( q->getNumberOfStates() ),
-    Q( q ),
+    anagenetic_rates( num_states * num_states, 0.0 ),
+    total_anagenetic_rates( num_states, 0.0 ),
+    safe_x( 2 * num_states, 0.0 ),
+    events( NULL ),
+    extinction_curve( NULL ),
     rate( r ),
     extinction_only( extinction_only ),
+    use_speciation_from_event_map( false ),
     backward_time( backward_time ),
     allow_rate_shifts_extinction( allow_shifts_extinct )
 {
     
+    // the rate matrix does not change while we integrate, so we look up the rates only once
+    double age = 0.0;
+    for (size_t i = 0; i < num_states; ++i)
+    {
+        for (size_t j = 0; j < num_states; ++j)
+        {
+            if ( i != j )
+            {
+                double r_ij = q->getRate(i, j, age, rate);
+                anagenetic_rates[i * num_states + j] = r_ij;
+                if ( allow_rate_shifts_extinction == true )
+                {
+                    total_anagenetic_rates[i] += r_ij;
+                }
+            }
+        }
+    }
+    
 }
 
 
@@ -29,93 +200,73 @@ void SSE_ODE::operator()(const std::vector< double > &x, std::vector< double > &
     
     // catch negative extinction probabilities that can result from
     // rounding errors in the ODE stepper
-    std::vector< double > safe_x = x;
     for (size_t i = 0; i < num_states * 2; ++i)
     {
         safe_x[i] = ( x[i] < 0.0 ? 0.0 : x[i] );
     }
     
-    double age = 0.0;
+    // the extinction probabilities may be given, then t is the age
+    if ( extinction_curve != NULL )
+    {
+        extinction_curve->getProbabilities( t, &safe_x[0] );
+    }
+    const double* e = &safe_x[0];
+    const double* d = &safe_x[num_states];
+    
     for (size_t i = 0; i < num_states; ++i)
     {
         
         // calculate sum of speciation rates
         // lambda_ijk for all possible values of j and k
-        double lambda_sum = 0.0;
-        
-        if ( use_speciation_from_event_map == true )
-        {
-            std::map<std::vector<unsigned>, double>::iterator it;
-            for (it = event_map.begin(); it != event_map.end(); it++)
-            {
-                const std::vector<unsigned>& states = it->first;
-                double curr_lambda = it->second;
-            
-                if (i == states[0])
-                {
-                    lambda_sum += curr_lambda;
-                }
-            }
-        }
-        else
-        {
-            lambda_sum = lambda[i];
-        }
+        double lambda_sum = ( use_speciation_from_event_map == true ? events->speciation_rates[i] : lambda[i] );
         
         /**** Extinction ****/
         /**** equation A2 ***/
         
-        // extinction event
-        dxdt[i] = mu[i];
-        
         // no event
-        double no_event_rate = mu[i] + lambda_sum;
-        for (size_t j = 0; j < num_states; ++j)
-        {
-            if ( i != j && allow_rate_shifts_extinction == true )
-            {
-                no_event_rate += Q->getRate(i, j, age, rate);
-            }
-        }
-        
+        double no_event_rate = mu[i] + lambda_sum + total_anagenetic_rates[i];
         if (psi.empty() == false)
         {
             no_event_rate += psi[i];
         }
-
-        dxdt[i] -= no_event_rate * safe_x[i];
         
-        // speciation event
-        if ( use_speciation_from_event_map == true )
+        if ( extinction_curve == NULL )
         {
-            std::map<std::vector<unsigned>, double>::iterator it;
-            for (it = event_map.begin(); it != event_map.end(); it++)
+            // extinction event
+            double dx_i = mu[i] - no_event_rate * e[i];
+            
+            // speciation event
+            if ( use_speciation_from_event_map == true )
             {
-                const std::vector<unsigned>& states = it->first;
-                double curr_lambda = it->second;
-                if (i == states[0])
+                const unsigned* daughter_1 = &events->ancestor_daughter_1[0];
+                const unsigned* daughter_2 = &events->ancestor_daughter_2[0];
+                const double* rates = &events->ancestor_rates[0];
+                for (size_t j = events->ancestor_offsets[i]; j < events->ancestor_offsets[i+1]; ++j)
                 {
-                    dxdt[i] += curr_lambda * safe_x[states[1]] * safe_x[states[2]];
+                    dx_i += rates[j] * e[ daughter_1[j] ] * e[ daughter_2[j] ];
                 }
             }
-        }
-        else
-        {
-            dxdt[i] += lambda[i] * safe_x[i] * safe_x[i];
-        }
-        
-        // anagenetic state change
-        for (size_t j = 0; j < num_states; ++j)
-        {
-            if ( i != j && allow_rate_shifts_extinction == true )
+            else
             {
-                dxdt[i] += Q->getRate(i, j, age, rate) * safe_x[j];
+                dx_i += lambda[i] * e[i] * e[i];
             }
+            
+            // anagenetic state change
+            if ( allow_rate_shifts_extinction == true )
+            {
+                const double* q_i = &anagenetic_rates[i * num_states];
+                for (size_t j = 0; j < num_states; ++j)
+                {
+                    dx_i += q_i[j] * e[j];
+                }
+            }
+            
+            dxdt[i] = ( backward_time == true ? dx_i : -dx_i );
         }
-
-        if ( backward_time == false )
+        else
         {
-            dxdt[i] = -dxdt[i];
+            // the extinction probabilities are given
+            dxdt[i] = 0.0;
         }
         
         if ( extinction_only == false )
@@ -124,60 +275,57 @@ void SSE_ODE::operator()(const std::vector< double > &x, std::vector< double > &
             /**** equation A1 ****/
         
             // no event
-            dxdt[i + num_states] = -no_event_rate * safe_x[i + num_states];
+            double dd_i = -no_event_rate * d[i];
             
             // speciation event
             if ( use_speciation_from_event_map == true )
             {
-                std::map<std::vector<unsigned>, double>::iterator it;
-                for (it = event_map.begin(); it != event_map.end(); it++)
+                if ( backward_time == true )
                 {
-                    const std::vector<unsigned>& states = it->first;
-                    double lambda = it->second;
-                    if ( backward_time == true )
+                    const unsigned* daughter_1 = &events->ancestor_daughter_1[0];
+                    const unsigned* daughter_2 = &events->ancestor_daughter_2[0];
+                    const double* rates = &events->ancestor_rates[0];
+                    for (size_t j = events->ancestor_offsets[i]; j < events->ancestor_offsets[i+1]; ++j)
                     {
-                        if (i == states[0])
-                        {
-                            double term1 = safe_x[states[1] + num_states] * safe_x[states[2]];
-                            double term2 = safe_x[states[2] + num_states] * safe_x[states[1]];
-                            dxdt[i + num_states] += lambda * (term1 + term2 );
-                        }
+                        dd_i += rates[j] * ( d[ daughter_1[j] ] * e[ daughter_2[j] ] + d[ daughter_2[j] ] * e[ daughter_1[j] ] );
                     }
-                    else
+                }
+                else
+                {
+                    const unsigned* ancestor = &events->daughter_ancestor[0];
+                    const unsigned* sister = &events->daughter_sister[0];
+                    const double* rates = &events->daughter_rates[0];
+                    for (size_t j = events->daughter_offsets[i]; j < events->daughter_offsets[i+1]; ++j)
                     {
-                        if (i == states[1])
-                        {
-                            dxdt[i + num_states] += lambda * safe_x[states[0] + num_states] * safe_x[states[2]];
-                        }
-                        if (i == states[2])
-                        {
-                            dxdt[i + num_states] += lambda * safe_x[states[0] + num_states] * safe_x[states[1]];
-                        }
+                        dd_i += rates[j] * d[ ancestor[j] ] * e[ sister[j] ];
                     }
                 }
             }
             else
             {
-                dxdt[i + num_states] += 2 * lambda[i] * safe_x[i] * safe_x[i + num_states];
+                dd_i += 2 * lambda[i] * e[i] * d[i];
             }
         
             // anagenetic state change
-            for (size_t j = 0; j < num_states; ++j)
+            if ( backward_time == true )
             {
-                if ( i != j )
+                const double* q_i = &anagenetic_rates[i * num_states];
+                for (size_t j = 0; j < num_states; ++j)
                 {
-                    if ( backward_time == true )
-                    {
-                        dxdt[i + num_states] += Q->getRate(i, j, age, rate) * safe_x[j + num_states];
-                    }
-                    else
-                    {
-                        dxdt[i + num_states] += Q->getRate(j, i, age, rate) * safe_x[j + num_states];
-                    }
+                    dd_i += q_i[j] * d[j];
+                }
+            }
+            else
+            {
+                const double* q_i = &anagenetic_rates[i];
+                for (size_t j = 0; j < num_states; ++j)
+                {
+                    dd_i += q_i[j * num_states] * d[j];
                 }
-                
             }
             
+            dxdt[i + num_states] = dd_i;
+            
         } // end if extinction_only
         
     } // end for num_states
@@ -185,11 +333,27 @@ void SSE_ODE::operator()(const std::vector< double > &x, std::vector< double > &
 }
 
 
-void SSE_ODE::setEventMap( const std::map<std::vector<unsigned>, double> &e )
+/**
+ * Use the cladogenetic events for the speciation rates.
+ * We only keep a pointer to the events, so the caller must keep them alive while we integrate.
+ */
+void SSE_ODE::setEventTensor( const EventTensor &e )
 {
     
     use_speciation_from_event_map = true;
-    event_map = e;
+    events = &e;
+}
+
+
+/**
+ * Use the given extinction probabilities instead of integrating them.
+ * This is only possible backward in time.
+ * We only keep a pointer to the extinction probabilities, so the caller must keep them alive while we integrate.
+ */
+void SSE_ODE::setExtinctionCurve( const ExtinctionCurve &e )
+{
+    
+    extinction_curve = &e;
 }
 
 
@@ -207,4 +371,3 @@ void SSE_ODE::setSerialSamplingRate( const std::vector<double> &s )
     psi = s;
 
 }
-
@@ -4,6 +4,7 @@
 #include "AbstractBirthDeathProcess.h"
 #include "RateMatrix.h"
 
+#include <map>
 #include <vector>
 
 namespace RevBayesCore {
@@ -16,16 +17,73 @@ namespace RevBayesCore {
      * cladogenetic multi-rate birth-death process (ClaSSE: Goldberg and Igic, 2012)
      * Will Freyman 6/22/16
      *
+     * The right-hand side is evaluated many times per branch by the ODE stepper.
+     * Therefore, we look up the anagenetic rates only once when we create the ODE,
+     * and we use the cladogenetic events compiled into flat arrays (see EventTensor)
+     * instead of walking the event map.
+     * If we are given the extinction probabilities (see ExtinctionCurve), then we only integrate
+     * the observation probabilities backward in time and keep the extinction probabilities fixed.
+     *
      */
     class SSE_ODE {
         
     public:
         
+        /**
+         * @brief The cladogenetic events in compressed sparse form.
+         *
+         * The event map has one entry per [ancestor_state, daughter_1_state, daughter_2_state].
+         * Here we store the events grouped by the ancestor state (for the equations backward in time)
+         * and grouped by the daughter states (for the equations forward in time), both in the order of the event map.
+         * The events of state i are at the positions offsets[i] to offsets[i+1] of the arrays.
+         * The tensor only changes when the cladogenetic event map changes, so the processes compile it once per parameter change.
+         */
+        struct EventTensor {
+            
+            EventTensor(void);
+            EventTensor(const std::map<std::vector<unsigned>, double> &e, size_t n);
+            
+            std::vector<size_t>                     ancestor_offsets;                   //!< the first event of each ancestor state (plus the end)
+            std::vector<unsigned>                   ancestor_daughter_1;                //!< the state of the first daughter
+            std::vector<unsigned>                   ancestor_daughter_2;                //!< the state of the second daughter
+            std::vector<double>                     ancestor_rates;                     //!< the speciation rate of the event
+            std::vector<double>                     speciation_rates;                   //!< the total speciation rate of each ancestor state
+            
+            std::vector<size_t>                     daughter_offsets;                   //!< the first event of each daughter state (plus the end); events appear once for each daughter
+            std::vector<unsigned>                   daughter_ancestor;                  //!< the state of the ancestor
+            std::vector<unsigned>                   daughter_sister;                    //!< the state of the other daughter
+            std::vector<double>                     daughter_rates;                     //!< the speciation rate of the event
+        };
+        
+        /**
+         * @brief The extinction probabilities E(t) of all states as a function of the age.
+         *
+         * The extinction probabilities do not depend on the branch, only on the age.
+         * We store the solution of the ODE at the steps of the integrator together with its derivative,
+         * and interpolate between the steps with cubic Hermite polynomials.
+         */
+        struct ExtinctionCurve {
+            
+            ExtinctionCurve(void);
+            
+            void                                    addPoint(double a, const std::vector<double> &e, const std::vector<double> &dedt);
+            void                                    clear(void);
+            bool                                    empty(void) const;
+            double                                  getMaximumAge(void) const;
+            void                                    getProbabilities(double a, double *e) const;
+            
+            size_t                                  num_states;
+            std::vector<double>                     ages;                               //!< the ages of the points, in increasing order
+            std::vector<double>                     probabilities;                      //!< the extinction probabilities of all states at each age
+            std::vector<double>                     derivatives;                        //!< the derivatives of the extinction probabilities at each age
+        };
+        
         SSE_ODE( const std::vector<double> &m, const RateGenerator* q, double r, bool backward_time, bool extinction_only, bool allow_shifts_extint=true );
         
         void operator() ( const std::vector< double > &x, std::vector< double > &dxdt , const double t );
         
-        void            setEventMap( const std::map<std::vector<unsigned>, double> &e );
+        void            setEventTensor( const EventTensor &e );
+        void            setExtinctionCurve( const ExtinctionCurve &e );
         void            setSpeciationRate( const std::vector<double> &s );
         void            setSerialSamplingRate( const std::vector<double> &s );
         
@@ -35,8 +93,11 @@ namespace RevBayesCore {
         std::vector<double>                         lambda;                             //!< vector of speciation rates, one rate for each character state
         std::vector<double>                         psi;                                //!< vector of fossilization rates, one rate for each character state
         size_t                                      num_states;                         //!< the number of character states = q->getNumberOfStates()
-        const RateGenerator*                        Q;                                  //!< anagenetic rate matrix
-        std::map<std::vector<unsigned>, double>     event_map;                          //!< cladogenetic event map, with the structure pair< [ancestor_state, daughter_1_state, daughter_2_state], speciation_rate >
+        std::vector<double>                         anagenetic_rates;                   //!< the rates of the anagenetic rate matrix, row by row, with zeros on the diagonal
+        std::vector<double>                         total_anagenetic_rates;             //!< the total rate of leaving each state (zero if we do not allow rate shifts in extinct lineages)
+        std::vector<double>                         safe_x;                             //!< the state of the ODE without negative values
+        const EventTensor*                          events;                             //!< cladogenetic events, owned by the process
+        const ExtinctionCurve*                      extinction_curve;                   //!< the extinction probabilities if we only integrate the observation probabilities, owned by the process
         double                                      rate;                               //!< clock rate for anagenetic change
         
         // flags to modify behabior
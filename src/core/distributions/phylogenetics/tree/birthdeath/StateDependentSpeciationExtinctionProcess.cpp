@@ -3,6 +3,7 @@
 #include <cmath>
 #include <cstddef>
 #include <map>
+#include <memory>
 #include <ostream>
 #include <string>
 #include <utility>
@@ -47,6 +48,11 @@
 #include "TypedDistribution.h"
 #include "boost/numeric/odeint.hpp" // IWYU pragma: keep
 
+#include <condition_variable>
+#include <exception>
+#include <mutex>
+#include <thread>
+
 namespace RevBayesCore { class DagNode; }
 namespace RevBayesCore { template <class valueType> class RbOrderedSet; }
 
@@ -85,6 +91,8 @@ StateDependentSpeciationExtinctionProcess::StateDependentSpeciationExtinctionPro
     num_states( ext->getValue().size() ),
     scaling_factors( std::vector<std::vector<double> >(5, std::vector<double>(2,0.0) ) ),
     use_cladogenetic_events( false ),
+    cladogenetic_events_dirty( true ),
+    extinction_curve_dirty( true ),
     use_origin( uo ),
     sample_character_history( false ),
     average_speciation( std::vector<double>(5, 0.0) ),
@@ -316,7 +324,7 @@ double StateDependentSpeciationExtinctionProcess::computeLnProbability( void )
 }
 
 
-void StateDependentSpeciationExtinctionProcess::computeNodeProbability(const RevBayesCore::TopologyNode &node, size_t node_index) const
+void StateDependentSpeciationExtinctionProcess::computeNodeProbability(const RevBayesCore::TopologyNode &node, size_t node_index, BranchValues &values) const
 {
     
     // check for recomputation
@@ -325,220 +333,331 @@ void StateDependentSpeciationExtinctionProcess::computeNodeProbability(const Rev
         // mark as computed
         dirty_nodes[node_index] = false;
         
-        std::vector<double> &node_likelihood  = node_partial_likelihoods[node_index][active_likelihood[node_index]];
+        if ( node.isTip() == false )
+        {
+            computeNodeProbability( node.getChild(0), node.getChild(0).getIndex(), values );
+            computeNodeProbability( node.getChild(1), node.getChild(1).getIndex(), values );
+        }
+        
+        computeBranchProbability( node, node_index, values );
+    }
+    
+}
+
 
-        if ( node.isTip() == true )
+/**
+ * Compute the probabilities at the node from the probabilities of its children (which must be computed already),
+ * and integrate them along the branch to the parent.
+ * Unless we sample the character history, this may run on several threads at once for different branches,
+ * so we must not change any shared members here, and we take all parameter values from the given values.
+ */
+void StateDependentSpeciationExtinctionProcess::computeBranchProbability(const RevBayesCore::TopologyNode &node, size_t node_index, BranchValues &values) const
+{
+    
+    std::vector<double> &node_likelihood  = node_partial_likelihoods[node_index][active_likelihood[node_index]];
+
+    if ( node.isTip() == true )
+    {
+        // this is a tip node
+        const TreeDiscreteCharacterData* tree = static_cast<const TreeDiscreteCharacterData*>( this->value );
+
+        std::vector<double> sampling = values.sampling;
+        std::vector<double> extinction = std::vector<double>(num_states, 1.0);
+        for (size_t i=0; i<num_states; ++i)
         {
-            // this is a tip node
-            TreeDiscreteCharacterData* tree = static_cast<TreeDiscreteCharacterData*>( this->value );
+            extinction[i] = 1.0 - sampling[i];
+        }
 
-            std::vector<double> sampling;
-            std::vector<double> extinction;
-            if ( rho != NULL && rho_per_state == NULL )
+        if ( node.isFossil() )
+        {
+            if ( phi == NULL )
             {
-                sampling   = std::vector<double>(num_states, rho->getValue());
-                extinction = std::vector<double>(num_states, 1.0 - rho->getValue());
+                throw(RbException("Tree has serially sampled tips, but no serial sampling rate was provided."));
             }
-            else if ( rho == NULL && rho_per_state != NULL )
+            sampling = values.serial_sampling;
+            if ( sample_character_history == false )
             {
-                sampling   = rho_per_state->getValue();
-                extinction = std::vector<double>(num_states, 1.0);
-                for (size_t i=0; i<num_states; ++i)
-                {
-                    extinction[i] = 1.0 - sampling[i];
-                }
+                extinction_curve.getProbabilities( node.getAge(), &extinction[0] );
             }
             else
             {
-                throw RbException("Either a global sampling fraction or state-specific sampling fraction needs to be set.");
-            }
-
-            if ( node.isFossil() )
-            {
-                if ( phi == NULL )
-                {
-                    throw(RbException("Tree has serially sampled tips, but no serial sampling rate was provided."));
-                }
-                sampling = phi->getValue();
                 extinction = pExtinction(0.0, node.getAge());
             }
-            
-            RbBitSet obs_state(num_states, true);
-            bool gap = true;
-
-            if ( tree->hasCharacterData() == true )
-            {
-                const DiscreteCharacterState &state = tree->getCharacterData().getTaxonData( node.getTaxon().getName() )[0];
-                obs_state = state.getState();
-                gap = (state.isMissingState() == true || state.isGapState() == true);
-            }
+        }
+        
+        RbBitSet obs_state(num_states, true);
+        bool gap = true;
 
-            for (size_t j = 0; j < num_states; ++j)
-            {
-                
-                node_likelihood[j] = extinction[j];
-                
-                if ( obs_state.test( j ) == true || gap == true )
-                {
-                	if ( node.isFossil() )
-                	{
-                		node_likelihood[num_states+j] = sampling[j] * extinction[j];
-                	}
-                	else
-                	{
-                		node_likelihood[num_states+j] = sampling[j];
-                	}
-                }
-                else
-                {
-                    node_likelihood[num_states+j] = 0.0;
-                }
-            }
-            
+        if ( tree->hasCharacterData() == true )
+        {
+            const DiscreteCharacterState &state = tree->getCharacterData().getTaxonData( node.getTaxon().getName() )[0];
+            obs_state = state.getState();
+            gap = (state.isMissingState() == true || state.isGapState() == true);
         }
-        else
+
+        for (size_t j = 0; j < num_states; ++j)
         {
             
-            // this is an internal node
-            const TopologyNode          &left           = node.getChild(0);
-            size_t                      left_index      = left.getIndex();
-            computeNodeProbability( left, left_index );
-            const TopologyNode          &right          = node.getChild(1);
-            size_t                      right_index     = right.getIndex();
-            computeNodeProbability( right, right_index );
+            node_likelihood[j] = extinction[j];
             
-            // get the likelihoods of descendant nodes
-            const std::vector<double> &left_likelihoods  = node_partial_likelihoods[left_index][active_likelihood[left_index]];
-            const std::vector<double> &right_likelihoods = node_partial_likelihoods[right_index][active_likelihood[right_index]];
-
-            std::map<std::vector<unsigned>, double> eventMap;
-            std::vector<double> speciation_rates;
-            if ( use_cladogenetic_events == true )
+            if ( obs_state.test( j ) == true || gap == true )
             {
-                // get cladogenesis event map (sparse speciation rate matrix)
-                eventMap = cladogenesis_matrix->getValue().getEventMap();
+            	if ( node.isFossil() )
+            	{
+            		node_likelihood[num_states+j] = sampling[j] * extinction[j];
+            	}
+            	else
+            	{
+            		node_likelihood[num_states+j] = sampling[j];
+            	}
             }
             else
             {
-                speciation_rates = lambda->getValue();
+                node_likelihood[num_states+j] = 0.0;
             }
+        }
+        
+    }
+    else
+    {
+        
+        // this is an internal node
+        const TopologyNode          &left           = node.getChild(0);
+        size_t                      left_index      = left.getIndex();
+        const TopologyNode          &right          = node.getChild(1);
+        size_t                      right_index     = right.getIndex();
+        
+        // get the likelihoods of descendant nodes
+        const std::vector<double> &left_likelihoods  = node_partial_likelihoods[left_index][active_likelihood[left_index]];
+        const std::vector<double> &right_likelihoods = node_partial_likelihoods[right_index][active_likelihood[right_index]];
+        
+        bool speciation_node = true;
+        if ( left.isSampledAncestor() || right.isSampledAncestor() )
+        {
+            speciation_node = (phi == NULL);
+        }
+
+        // merge descendant likelihoods
+        mergeDescendantLikelihoods( left_likelihoods, right_likelihoods, node_likelihood, speciation_node, values );
+        
+    }
+    
+    double begin_age = node.getAge();
+    double end_age = node.getParent().getAge();
+    
+    if ( node.isSampledAncestor() == false )
+    {
+        // calculate likelihoods for this branch
+        if ( sample_character_history == false )
+        {
+            // numerically integrate over the entire branch length
+            numericallyIntegrateBranch(node_likelihood, begin_age, end_age, values.ode);
+        }
+        else
+        {
+            // calculate the conditional likelihoods for each time slice moving
+            // along this branch backwards in time from the tip towards the root
+
+            std::vector<std::vector<double> > branch_likelihoods;
+            size_t current_dt = 0;
             
-            bool speciation_node = true;
-            if ( left.isSampledAncestor() || right.isSampledAncestor() )
+            // calculate partial likelihoods for each time slice and store them in branch_likelihoods
+            while ( (current_dt * dt) + begin_age < end_age )
             {
-                speciation_node = (phi == NULL);
-            }
 
-            // merge descendant likelihoods
-            for (size_t i=0; i<num_states; ++i)
-            {
-                node_likelihood[i] = left_likelihoods[i];
+                std::vector<double> dt_likelihood;
 
-                if ( use_cladogenetic_events == true && speciation_node == true )
-                {
-                    
-                    double like_sum = 0.0;
-                    std::map<std::vector<unsigned>, double>::iterator it;
-                    for (it = eventMap.begin(); it != eventMap.end(); it++)
-                    {
-                        const std::vector<unsigned>& states = it->first;
-                        double speciation_rate = it->second;
-                        if (i == states[0])
-                        {
-                            double likelihoods = left_likelihoods[num_states + states[1]] * right_likelihoods[num_states + states[2]];
-                            like_sum += speciation_rate * likelihoods;
-                        }
-                    }
-                    node_likelihood[num_states + i] = like_sum;
-                    
-                }
-                else
+                double current_dt_start = (current_dt * dt) + begin_age;
+                double current_dt_end = ((current_dt + 1) * dt) + begin_age;
+                if (current_dt_end > end_age)
                 {
-                    node_likelihood[num_states + i] = left_likelihoods[num_states + i] * right_likelihoods[num_states + i];
-                    node_likelihood[num_states + i] *= speciation_node ? speciation_rates[i] : 1.0;
+                    current_dt_end = end_age;
                 }
+                numericallyIntegrateProcess(node_likelihood, current_dt_start, current_dt_end, true, false);
+
+                std::vector<double>::const_iterator first = node_likelihood.begin() + num_states;
+                std::vector<double>::const_iterator last = node_likelihood.begin() + (num_states * 2);
+                dt_likelihood = std::vector<double>(first, last);
+
+                branch_likelihoods.push_back(dt_likelihood);
+                current_dt++;
+
             }
             
+            // save the branch conditional likelihoods
+            branch_partial_likelihoods[node_index] = branch_likelihoods;
         }
-        
-        double begin_age = node.getAge();
-        double end_age = node.getParent().getAge();
-        
-        if ( node.isSampledAncestor() == false )
+    }
+    
+    if ( RbSettings::userSettings().getUseScaling() == true ) //&& node_index % RbSettings::userSettings().getScalingDensity() == 0 )
+    {
+        // rescale the conditional likelihoods at the "end" of the branch
+        double max = 0.0;
+        for (size_t i=0; i<num_states; ++i)
         {
-            // calculate likelihoods for this branch
-            if ( sample_character_history == false )
+            if ( node_likelihood[num_states+i] > max )
             {
-                // numerically integrate over the entire branch length
-                numericallyIntegrateProcess(node_likelihood, begin_age, end_age, true, false);
+                max = node_likelihood[num_states+i];
             }
-            else
-            {
-                // calculate the conditional likelihoods for each time slice moving
-                // along this branch backwards in time from the tip towards the root
-
-                std::vector<std::vector<double> > branch_likelihoods;
-                size_t current_dt = 0;
-                
-                // calculate partial likelihoods for each time slice and store them in branch_likelihoods
-                while ( (current_dt * dt) + begin_age < end_age )
-                {
-
-                    std::vector<double> dt_likelihood;
+        }
+//            max *= num_states;
+        
+        for (size_t i=0; i<num_states; ++i)
+        {
+            node_likelihood[num_states+i] /= max;
+        }
 
-                    double current_dt_start = (current_dt * dt) + begin_age;
-                    double current_dt_end = ((current_dt + 1) * dt) + begin_age;
-                    if (current_dt_end > end_age)
-                    {
-                        current_dt_end = end_age;
-                    }
-                    numericallyIntegrateProcess(node_likelihood, current_dt_start, current_dt_end, true, false);
+        scaling_factors[node_index][active_likelihood[node_index]] = log(max);
 
-                    std::vector<double>::const_iterator first = node_likelihood.begin() + num_states;
-                    std::vector<double>::const_iterator last = node_likelihood.begin() + (num_states * 2);
-                    dt_likelihood = std::vector<double>(first, last);
+        if ( node.isTip() == false )
+        {
+            const TopologyNode          &left           = node.getChild(0);
+            size_t                      left_index      = left.getIndex();
+            const TopologyNode          &right          = node.getChild(1);
+            size_t                      right_index     = right.getIndex();
+            scaling_factors[node_index][active_likelihood[node_index]] += scaling_factors[left_index][active_likelihood[left_index]] + scaling_factors[right_index][active_likelihood[right_index]];
+        }
+        
+    }
+    
+}
 
-                    branch_likelihoods.push_back(dt_likelihood);
-                    current_dt++;
 
-                }
-                
-                // save the branch conditional likelihoods
-                branch_partial_likelihoods[node_index] = branch_likelihoods;
+/**
+ * Compute the probabilities of all dirty nodes below the root on several threads.
+ * A node can be computed as soon as both of its children are computed, so independent subtrees
+ * are integrated at the same time. We only do this if the user allows more than one thread (option numThreads)
+ * and if there are enough dirty nodes; after a tree move typically only the path to the root is dirty and we compute it serially.
+ * The threads only read the given parameter values and the extinction probabilities, which must be up to date
+ * before we start the threads, and never the DAG nodes.
+ */
+void StateDependentSpeciationExtinctionProcess::computeNodeProbabilitiesInParallel( const BranchValues &values ) const
+{
+    
+    size_t num_threads = RbSettings::userSettings().getNumberOfThreads();
+    if ( num_threads <= 1 )
+    {
+        return;
+    }
+    
+    // collect the dirty nodes in pre-order, in the same way as the recursion in computeNodeProbability would visit them
+    const TopologyNode &root = value->getRoot();
+    std::vector<const TopologyNode*> nodes;
+    std::vector<size_t> parents;
+    std::vector<const TopologyNode*> stack;
+    std::vector<size_t> stack_parents;
+    for (size_t i = 0; i < root.getNumberOfChildren(); ++i)
+    {
+        stack.push_back( &root.getChild(i) );
+        stack_parents.push_back( RbConstants::Size_t::max );
+    }
+    while ( stack.empty() == false )
+    {
+        const TopologyNode *node = stack.back();
+        size_t parent = stack_parents.back();
+        stack.pop_back();
+        stack_parents.pop_back();
+        
+        if ( dirty_nodes[node->getIndex()] == true )
+        {
+            nodes.push_back( node );
+            parents.push_back( parent );
+            for (size_t i = 0; i < node->getNumberOfChildren(); ++i)
+            {
+                stack.push_back( &node->getChild(i) );
+                stack_parents.push_back( nodes.size() - 1 );
             }
         }
+    }
+    
+    if ( nodes.size() < 32 * num_threads )
+    {
+        return;
+    }
+    
+    // the number of dirty children each node waits for
+    std::vector<size_t> num_waiting( nodes.size(), 0 );
+    for (size_t i = 0; i < nodes.size(); ++i)
+    {
+        if ( parents[i] != RbConstants::Size_t::max )
+        {
+            ++num_waiting[ parents[i] ];
+        }
+    }
+    std::vector<size_t> ready;
+    for (size_t i = 0; i < nodes.size(); ++i)
+    {
+        if ( num_waiting[i] == 0 )
+        {
+            ready.push_back( i );
+        }
+    }
+    
+    std::mutex mutex;
+    std::condition_variable has_ready;
+    size_t num_done = 0;
+    std::exception_ptr error;
+    
+    auto work = [&]()
+    {
+        // every thread integrates with its own copy of the ODE
+        BranchValues thread_values = values;
         
-        if ( RbSettings::userSettings().getUseScaling() == true ) //&& node_index % RbSettings::userSettings().getScalingDensity() == 0 )
+        std::unique_lock<std::mutex> lock( mutex );
+        while ( true )
         {
-            // rescale the conditional likelihoods at the "end" of the branch
-            double max = 0.0;
-            for (size_t i=0; i<num_states; ++i)
+            has_ready.wait( lock, [&]() { return ready.empty() == false || num_done == nodes.size() || error != NULL; } );
+            if ( num_done == nodes.size() || error != NULL )
             {
-                if ( node_likelihood[num_states+i] > max )
-                {
-                    max = node_likelihood[num_states+i];
-                }
+                return;
             }
-//            max *= num_states;
             
-            for (size_t i=0; i<num_states; ++i)
+            size_t i = ready.back();
+            ready.pop_back();
+            lock.unlock();
+            
+            try
             {
-                node_likelihood[num_states+i] /= max;
+                computeBranchProbability( *nodes[i], nodes[i]->getIndex(), thread_values );
             }
-
-            scaling_factors[node_index][active_likelihood[node_index]] = log(max);
-
-            if ( node.isTip() == false )
+            catch (...)
             {
-                const TopologyNode          &left           = node.getChild(0);
-                size_t                      left_index      = left.getIndex();
-                const TopologyNode          &right          = node.getChild(1);
-                size_t                      right_index     = right.getIndex();
-                scaling_factors[node_index][active_likelihood[node_index]] += scaling_factors[left_index][active_likelihood[left_index]] + scaling_factors[right_index][active_likelihood[right_index]];
+                lock.lock();
+                error = std::current_exception();
+                has_ready.notify_all();
+                return;
             }
             
+            lock.lock();
+            ++num_done;
+            if ( parents[i] != RbConstants::Size_t::max && --num_waiting[ parents[i] ] == 0 )
+            {
+                ready.push_back( parents[i] );
+            }
+            has_ready.notify_all();
         }
-        
+    };
+    
+    std::vector<std::thread> threads;
+    for (size_t t = 1; t < num_threads; ++t)
+    {
+        threads.push_back( std::thread( work ) );
+    }
+    work();
+    for (size_t t = 0; t < threads.size(); ++t)
+    {
+        threads[t].join();
+    }
+    
+    if ( error != NULL )
+    {
+        std::rethrow_exception( error );
+    }
+    
+    // mark as computed
+    for (size_t i = 0; i < nodes.size(); ++i)
+    {
+        dirty_nodes[ nodes[i]->getIndex() ] = false;
     }
     
 }
@@ -551,10 +670,23 @@ double StateDependentSpeciationExtinctionProcess::computeRootLikelihood( void )
     size_t                  node_index      = root.getIndex();
     const TopologyNode     &left            = root.getChild(0);
     size_t                  left_index      = left.getIndex();
-    computeNodeProbability( left, left_index );
     const TopologyNode     &right           = root.getChild(1);
     size_t                  right_index     = right.getIndex();
-    computeNodeProbability( right, right_index );
+    
+    if ( sample_character_history == false )
+    {
+        // the extinction probabilities are the same for all branches, so we compute them once for the whole tree
+        getExtinctionCurve( std::max( getOriginAge(), root.getAge() ) );
+    }
+    
+    BranchValues values = getBranchValues();
+    
+    if ( sample_character_history == false )
+    {
+        computeNodeProbabilitiesInParallel( values );
+    }
+    computeNodeProbability( left, left_index, values );
+    computeNodeProbability( right, right_index, values );
 
     // get the likelihoods of descendant nodes
     const std::vector<double> &left_likelihoods  = node_partial_likelihoods[left_index][active_likelihood[left_index]];
@@ -562,18 +694,6 @@ double StateDependentSpeciationExtinctionProcess::computeRootLikelihood( void )
 
     std::vector<double> &node_likelihood  = node_partial_likelihoods[node_index][active_likelihood[node_index]];
 
-    std::map<std::vector<unsigned>, double> eventMap;
-    std::vector<double> speciation_rates;
-    if ( use_cladogenetic_events == true )
-    {
-        // get cladogenesis event map (sparse speciation rate matrix)
-        eventMap = cladogenesis_matrix->getValue().getEventMap();
-    }
-    else
-    {
-        speciation_rates = lambda->getValue();
-    }
-
     bool speciation_node = true;
     if ( left.isSampledAncestor() || right.isSampledAncestor() )
     {
@@ -581,34 +701,7 @@ double StateDependentSpeciationExtinctionProcess::computeRootLikelihood( void )
     }
 
     // merge descendant likelihoods
-    for (size_t i=0; i<num_states; ++i)
-    {
-        node_likelihood[i] = left_likelihoods[i];
-
-        if ( use_cladogenetic_events == true && speciation_node == true )
-        {
-
-            double like_sum = 0.0;
-            std::map<std::vector<unsigned>, double>::iterator it;
-            for (it = eventMap.begin(); it != eventMap.end(); it++)
-            {
-                const std::vector<unsigned>& states = it->first;
-                double speciation_rate = it->second;
-                if (i == states[0])
-                {
-                    double likelihoods = left_likelihoods[num_states + states[1]] * right_likelihoods[num_states + states[2]];
-                    like_sum += speciation_rate * likelihoods;
-                }
-            }
-            node_likelihood[num_states + i] = like_sum;
-
-        }
-        else
-        {
-            node_likelihood[num_states + i] = left_likelihoods[num_states + i] * right_likelihoods[num_states + i];
-            node_likelihood[num_states + i] *= (speciation_node ? speciation_rates[i] : 1.0);
-        }
-    }
+    mergeDescendantLikelihoods( left_likelihoods, right_likelihoods, node_likelihood, speciation_node, values );
     
     // calculate likelihoods for the root branch
     if ( use_origin == true )
@@ -619,7 +712,7 @@ double StateDependentSpeciationExtinctionProcess::computeRootLikelihood( void )
         if ( sample_character_history == false )
         {
             // numerically integrate over the entire branch length
-            numericallyIntegrateProcess(node_likelihood, begin_age, end_age, true, false);
+            numericallyIntegrateBranch(node_likelihood, begin_age, end_age, values.ode);
         }
         else
         {
@@ -1264,7 +1357,7 @@ bool StateDependentSpeciationExtinctionProcess::recursivelyDrawStochasticCharact
         AbstractHomologousDiscreteCharacterData& data = static_cast<TreeDiscreteCharacterData*>(this->value)->getCharacterData();
         AbstractDiscreteTaxonData& taxon_data = data.getTaxonData( node.getName() );
         
-        DiscreteCharacterState &char_state = taxon_data.getCharacter(0);
+        const DiscreteCharacterState &char_state = static_cast<const AbstractDiscreteTaxonData&>( taxon_data ).getCharacter(0);
         size_t new_state = current_state;
         
         if ( char_state.isAmbiguous() == false )
@@ -1277,8 +1370,10 @@ bool StateDependentSpeciationExtinctionProcess::recursivelyDrawStochasticCharact
             if (set_amb_char_data == true)
             {
                 // overwrite the character data 
-                char_state.setMissingState(false);
-                char_state.setStateByIndex(new_state);
+                std::unique_ptr<DiscreteCharacterState> simulated_state( char_state.clone() );
+                simulated_state->setMissingState(false);
+                simulated_state->setStateByIndex(new_state);
+                taxon_data.setCharacter( 0, *simulated_state );
             }
         }
         
@@ -1590,6 +1685,115 @@ void StateDependentSpeciationExtinctionProcess::getAffected(RbOrderedSet<DagNode
 }
 
 
+/**
+ * Get the parameter values for computing the probabilities of the branches.
+ * This compiles the cladogenetic events if needed, so that the branches only read them.
+ */
+StateDependentSpeciationExtinctionProcess::BranchValues StateDependentSpeciationExtinctionProcess::getBranchValues( void ) const
+{
+    
+    BranchValues values = BranchValues( createODE( true, false ) );
+    values.ode.setExtinctionCurve( extinction_curve );
+    
+    if ( rho != NULL && rho_per_state == NULL )
+    {
+        values.sampling = std::vector<double>(num_states, rho->getValue());
+    }
+    else if ( rho == NULL && rho_per_state != NULL )
+    {
+        values.sampling = rho_per_state->getValue();
+    }
+    else
+    {
+        throw RbException("Either a global sampling fraction or state-specific sampling fraction needs to be set.");
+    }
+    
+    if ( phi != NULL )
+    {
+        values.serial_sampling = phi->getValue();
+    }
+    
+    values.speciation_rates = lambda->getValue();
+    
+    return values;
+}
+
+
+/**
+ * Get the cladogenetic events compiled for the ODE.
+ * We compile the event map only when the parameters have changed, and not for every branch we integrate.
+ */
+const SSE_ODE::EventTensor& StateDependentSpeciationExtinctionProcess::getCladogeneticEvents( void ) const
+{
+    
+    if ( cladogenetic_events_dirty == true )
+    {
+        // we must call getValue() to update the speciation and extinction rates in the event map
+        const std::map<std::vector<unsigned>, double> &event_map = cladogenesis_matrix->getValue().getEventMap();
+        cladogenetic_events = SSE_ODE::EventTensor( event_map, num_states );
+        cladogenetic_events_dirty = false;
+    }
+    
+    return cladogenetic_events;
+}
+
+
+/**
+ * Get the extinction probabilities E(t) from the present up to at least the given age.
+ * The extinction probabilities only depend on the age and not on the branch, so we integrate them
+ * once per parameter change and share them between all branches.
+ * If we need older ages than we have, we continue the integration from the oldest age we have.
+ * Note that the curve is integrated with error control (absolute and relative tolerance 1E-10), whereas
+ * the branches used to integrate E(t) with fixed steps of size dt. Hence, the likelihoods differ
+ * from those of earlier versions in about the eighth significant digit.
+ */
+const SSE_ODE::ExtinctionCurve& StateDependentSpeciationExtinctionProcess::getExtinctionCurve( double max_age ) const
+{
+    
+    if ( extinction_curve_dirty == true )
+    {
+        extinction_curve.clear();
+        extinction_curve.num_states = num_states;
+        extinction_curve_dirty = false;
+    }
+    
+    if ( extinction_curve.empty() == true || extinction_curve.getMaximumAge() < max_age )
+    {
+        SSE_ODE ode = createODE( true, true );
+        
+        std::vector<double> state = std::vector<double>(2*num_states, 0.0);
+        std::vector<double> derivative = std::vector<double>(2*num_states, 0.0);
+        double begin_age = extinction_curve.getMaximumAge();
+        if ( extinction_curve.empty() == true )
+        {
+            std::vector<double> initial_state = pExtinction(0.0, 0.0);
+            std::copy( initial_state.begin(), initial_state.begin() + num_states, state.begin() );
+            ode( state, derivative, begin_age );
+            extinction_curve.addPoint( begin_age, state, derivative );
+        }
+        else
+        {
+            extinction_curve.getProbabilities( begin_age, &state[0] );
+        }
+        
+        // we store the solution at every step of the integrator, and the derivative for the interpolation
+        auto observer = [&](const std::vector<double> &x, double age)
+        {
+            if ( age > extinction_curve.getMaximumAge() )
+            {
+                ode( x, derivative, age );
+                extinction_curve.addPoint( age, x, derivative );
+            }
+        };
+        
+        typedef boost::numeric::odeint::runge_kutta_dopri5< std::vector< double > > stepper_type;
+        boost::numeric::odeint::integrate_adaptive( boost::numeric::odeint::make_dense_output( 1E-10, 1E-10, stepper_type() ), ode, state, begin_age, max_age, dt, observer );
+    }
+    
+    return extinction_curve;
+}
+
+
 /**
  * Get the event rate
  */
@@ -1723,6 +1927,44 @@ void StateDependentSpeciationExtinctionProcess::keepSpecialization(const DagNode
 }
 
 
+/**
+ * Compute the probabilities at a node from the probabilities of its two children.
+ * The extinction probabilities are taken from the left child.
+ */
+void StateDependentSpeciationExtinctionProcess::mergeDescendantLikelihoods(const std::vector<double> &left_likelihoods, const std::vector<double> &right_likelihoods, std::vector<double> &node_likelihood, bool speciation_node, const BranchValues &values) const
+{
+    
+    for (size_t i=0; i<num_states; ++i)
+    {
+        node_likelihood[i] = left_likelihoods[i];
+    }
+    
+    if ( use_cladogenetic_events == true && speciation_node == true )
+    {
+        const SSE_ODE::EventTensor &events = getCladogeneticEvents();
+        for (size_t i=0; i<num_states; ++i)
+        {
+            double like_sum = 0.0;
+            for (size_t j = events.ancestor_offsets[i]; j < events.ancestor_offsets[i+1]; ++j)
+            {
+                double likelihoods = left_likelihoods[num_states + events.ancestor_daughter_1[j]] * right_likelihoods[num_states + events.ancestor_daughter_2[j]];
+                like_sum += events.ancestor_rates[j] * likelihoods;
+            }
+            node_likelihood[num_states + i] = like_sum;
+        }
+    }
+    else
+    {
+        for (size_t i=0; i<num_states; ++i)
+        {
+            node_likelihood[num_states + i] = left_likelihoods[num_states + i] * right_likelihoods[num_states + i];
+            node_likelihood[num_states + i] *= ( speciation_node ? values.speciation_rates[i] : 1.0 );
+        }
+    }
+    
+}
+
+
 double StateDependentSpeciationExtinctionProcess::lnProbTreeShape(void) const
 {
     // the birth death divergence times density is derived for a (ranked) unlabeled oriented tree
@@ -1882,6 +2124,13 @@ void StateDependentSpeciationExtinctionProcess::restoreSpecialization(const DagN
         }
     }
     
+    // the restored parameters may change the cladogenetic events and the extinction probabilities back
+    if ( affecter != this->dag_node )
+    {
+        cladogenetic_events_dirty = true;
+        extinction_curve_dirty = true;
+    }
+    
     // reset the flags
     for (std::vector<bool>::iterator it = dirty_nodes.begin(); it != dirty_nodes.end(); ++it)
     {
@@ -1917,6 +2166,8 @@ void StateDependentSpeciationExtinctionProcess::setCladogenesisMatrix(const Type
     
     // should we use the event map for the speciation rates?
     use_cladogenetic_events = true;
+    cladogenetic_events_dirty = true;
+    extinction_curve_dirty = true;
     
     // add the new parameter
     this->addParameter( cladogenesis_matrix );
@@ -1940,6 +2191,7 @@ void StateDependentSpeciationExtinctionProcess::setSerialSamplingRates(const Typ
 
     // add the new parameter
     this->addParameter( phi );
+    extinction_curve_dirty = true;
 
     // redraw the current value
     if ( this->dag_node == NULL || this->dag_node->isClamped() == false )
@@ -1969,6 +2221,7 @@ void StateDependentSpeciationExtinctionProcess::setSamplingFraction(const TypedD
     
     // add the new parameter
     this->addParameter( rho );
+    extinction_curve_dirty = true;
     
     // redraw the current value
     if ( this->dag_node == NULL || this->dag_node->isClamped() == false )
@@ -1992,6 +2245,7 @@ void StateDependentSpeciationExtinctionProcess::setSamplingFraction(const TypedD
     
     // add the new parameter
     this->addParameter( rho_per_state );
+    extinction_curve_dirty = true;
     
     // redraw the current value
     if ( this->dag_node == NULL || this->dag_node->isClamped() == false )
@@ -2015,6 +2269,7 @@ void StateDependentSpeciationExtinctionProcess::setSpeciationRates(const TypedDa
     
     // add the new parameter
     this->addParameter( lambda );
+    extinction_curve_dirty = true;
     
     // redraw the current value
     if ( this->dag_node == NULL || this->dag_node->isClamped() == false )
@@ -3143,6 +3398,8 @@ void StateDependentSpeciationExtinctionProcess::swapParameterInternal(const DagN
     if ( oldP == cladogenesis_matrix )
     {
         cladogenesis_matrix = static_cast<const TypedDagNode<CladogeneticSpeciationRateMatrix>* >( newP );
+        cladogenetic_events_dirty = true;
+        extinction_curve_dirty = true;
     }
     
 }
@@ -3172,6 +3429,10 @@ void StateDependentSpeciationExtinctionProcess::touchSpecialization(const DagNod
     if ( affecter != this->dag_node )
     {
         
+        // the parameters of the cladogenetic events and of the extinction probabilities may have changed
+        cladogenetic_events_dirty = true;
+        extinction_curve_dirty = true;
+        
         for (std::vector<bool>::iterator it = dirty_nodes.begin(); it != dirty_nodes.end(); ++it)
         {
             (*it) = true;
@@ -3192,20 +3453,16 @@ void StateDependentSpeciationExtinctionProcess::touchSpecialization(const DagNod
 
 
 /**
- * Wrapper function for the ODE time stepper function.
+ * Create the ODE for the current parameter values.
  */
-void StateDependentSpeciationExtinctionProcess::numericallyIntegrateProcess(std::vector< double > &likelihoods, double begin_age, double end_age, bool backward_time, bool extinction_only) const
+SSE_ODE StateDependentSpeciationExtinctionProcess::createODE(bool backward_time, bool extinction_only) const
 {
+    
     const std::vector<double> &extinction_rates = mu->getValue();
     SSE_ODE ode = SSE_ODE(extinction_rates, &getEventRateMatrix(), getEventRate(), backward_time, extinction_only, allow_rate_shifts_on_extinct_lineages);
     if ( use_cladogenetic_events == true )
     {
-        cladogenesis_matrix->getValue(); // we must call getValue() to update the speciation and extinction rates in the event map
-        
-        // get cladogenesis event map (sparse speciation rate matrix)
-        std::map<std::vector<unsigned>, double> event_map = cladogenesis_matrix->getValue().getEventMap();
-        
-        ode.setEventMap( event_map );
+        ode.setEventTensor( getCladogeneticEvents() );
     }
     else
     {
@@ -3219,6 +3476,50 @@ void StateDependentSpeciationExtinctionProcess::numericallyIntegrateProcess(std:
         ode.setSerialSamplingRate( serial_sampling_rates );
     }
     
+    return ode;
+}
+
+
+/**
+ * Integrate the observation probabilities along a branch backward in time.
+ * We take the extinction probabilities from the extinction curve, which must reach the end age already.
+ * This may run on several threads at once, so we must not change any shared members here.
+ */
+void StateDependentSpeciationExtinctionProcess::numericallyIntegrateBranch(std::vector< double > &likelihoods, double begin_age, double end_age, SSE_ODE &ode) const
+{
+    
+    typedef boost::numeric::odeint::runge_kutta_dopri5< std::vector< double > > stepper_type;
+    boost::numeric::odeint::integrate_adaptive( stepper_type(), ode , likelihoods , begin_age , end_age , dt );
+    
+    extinction_curve.getProbabilities( end_age, &likelihoods[0] );
+    
+    // catch negative probabilities that can result from
+    // rounding errors in the ODE stepper
+    bool rounding_error = false;
+    for (size_t i = 0; i < 2 * num_states; ++i)
+    {
+        likelihoods[i] = ( likelihoods[i] < 0.0 ? 0.0 : likelihoods[i] );
+        rounding_error |= ( i < num_states && likelihoods[i] > 1.0 );
+    }
+    
+    // for safety we set all likelihoods to nan if rounding errors happened
+    if ( rounding_error == true )
+    {
+        for (size_t i = 0; i < (2*num_states); ++i)
+        {
+            likelihoods[i] = RbConstants::Double::nan;
+        }
+    }
+    
+}
+
+
+/**
+ * Wrapper function for the ODE time stepper function.
+ */
+void StateDependentSpeciationExtinctionProcess::numericallyIntegrateProcess(std::vector< double > &likelihoods, double begin_age, double end_age, bool backward_time, bool extinction_only) const
+{
+    SSE_ODE ode = createODE( backward_time, extinction_only );
    
     typedef boost::numeric::odeint::runge_kutta_dopri5< std::vector< double > > stepper_type;
 
@@ -83,6 +83,21 @@ namespace RevBayesCore {
         
     protected:
         
+        /**
+         * The parameter values needed to compute the probabilities of the branches.
+         * We read them from the DAG nodes before we compute any branch, because the branches may be computed
+         * on several threads and reading the value of a DAG node may update it.
+         */
+        struct BranchValues {
+            
+            BranchValues(const SSE_ODE &o) : ode( o ) {}
+            
+            SSE_ODE                                                     ode;                                                                                                //!< the ODE of the observation probabilities; each thread needs its own copy
+            std::vector<double>                                         sampling;                                                                                           //!< the sampling probability of extant tips in each state
+            std::vector<double>                                         serial_sampling;                                                                                    //!< the serial sampling rate in each state (empty without serial sampling)
+            std::vector<double>                                         speciation_rates;                                                                                   //!< the speciation rate in each state
+        };
+        
         double                                                          getEventRate(void) const;
         const RateGenerator&                                            getEventRateMatrix(void) const;
         std::vector<double>                                             getRootFrequencies(void) const;
@@ -111,8 +126,16 @@ namespace RevBayesCore {
         bool                                                            simulateTreeConditionedOnTips(size_t attempts = 0);
         std::vector<double>                                             calculateTotalAnageneticRatePerState(void) const;
         std::vector<double>                                             calculateTotalSpeciationRatePerState(void) const;
-        void                                                            computeNodeProbability(const TopologyNode &n, size_t nIdx) const;
+        void                                                            computeBranchProbability(const TopologyNode &n, size_t nIdx, BranchValues &values) const;
+        void                                                            computeNodeProbability(const TopologyNode &n, size_t nIdx, BranchValues &values) const;
+        void                                                            computeNodeProbabilitiesInParallel(const BranchValues &values) const;
         double                                                          computeRootLikelihood() const;
+        SSE_ODE                                                         createODE(bool backward_time, bool extinction_only) const;
+        BranchValues                                                    getBranchValues(void) const;
+        const SSE_ODE::EventTensor&                                     getCladogeneticEvents(void) const;
+        const SSE_ODE::ExtinctionCurve&                                 getExtinctionCurve(double max_age) const;
+        void                                                            mergeDescendantLikelihoods(const std::vector<double> &left, const std::vector<double> &right, std::vector<double> &node, bool speciation_node, const BranchValues &values) const;
+        void                                                            numericallyIntegrateBranch(std::vector< double > &likelihoods, double begin_age, double end_age, SSE_ODE &ode) const;
         
         // members
         std::string                                                     condition;                                                                                          //!< The condition of the process (none/survival/#taxa).
@@ -126,6 +149,10 @@ namespace RevBayesCore {
         size_t                                                          num_states;
         mutable std::vector<std::vector<double> >                       scaling_factors;
         bool                                                            use_cladogenetic_events;                                                                            //!< do we use the speciation rates from the cladogenetic event map?
+        mutable SSE_ODE::EventTensor                                    cladogenetic_events;                                                                                //!< the cladogenetic event map compiled for the ODE
+        mutable bool                                                    cladogenetic_events_dirty;                                                                          //!< do we need to compile the cladogenetic events again?
+        mutable SSE_ODE::ExtinctionCurve                                extinction_curve;                                                                                   //!< the extinction probabilities shared by all branches
+        mutable bool                                                    extinction_curve_dirty;                                                                             //!< do we need to integrate the extinction probabilities again?
         bool                                                            use_origin;
         bool                                                            sample_character_history;                                                                           //!< are we sampling the character history along branches?
         std::vector<double>                                             average_speciation;
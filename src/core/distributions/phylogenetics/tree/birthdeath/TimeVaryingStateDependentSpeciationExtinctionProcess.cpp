@@ -81,6 +81,7 @@ TimeVaryingStateDependentSpeciationExtinctionProcess::TimeVaryingStateDependentS
     num_states( p->getValue().size() ),
     scaling_factors( std::vector<std::vector<double> >(5, std::vector<double>(2,0.0) ) ),
     use_cladogenetic_events( false ),
+    cladogenetic_events_dirty( true ),
     use_origin( uo ),
     sample_character_history( false ),
     average_speciation( std::vector<double>(5, 0.0) ),
@@ -1612,6 +1613,25 @@ void TimeVaryingStateDependentSpeciationExtinctionProcess::getAffected(RbOrdered
 }
 
 
+/**
+ * Get the cladogenetic events compiled for the ODE.
+ * We compile the event map only when the parameters have changed, and not for every branch we integrate.
+ */
+const SSE_ODE::EventTensor& TimeVaryingStateDependentSpeciationExtinctionProcess::getCladogeneticEvents( void ) const
+{
+    
+    if ( cladogenetic_events_dirty == true )
+    {
+        // we must call getValue() to update the speciation and extinction rates in the event map
+        const std::map<std::vector<unsigned>, double> &event_map = cladogenesis_matrix->getValue().getEventMap();
+        cladogenetic_events = SSE_ODE::EventTensor( event_map, num_states );
+        cladogenetic_events_dirty = false;
+    }
+    
+    return cladogenetic_events;
+}
+
+
 /**
  * Get the event rate
  */
@@ -1818,6 +1838,12 @@ void TimeVaryingStateDependentSpeciationExtinctionProcess::restoreSpecialization
         }
     }
     
+    // the restored parameters may change the cladogenetic events back
+    if ( affecter != this->dag_node )
+    {
+        cladogenetic_events_dirty = true;
+    }
+    
     // reset the flags
     for (std::vector<bool>::iterator it = dirty_nodes.begin(); it != dirty_nodes.end(); ++it)
     {
@@ -1853,6 +1879,7 @@ void TimeVaryingStateDependentSpeciationExtinctionProcess::setCladogenesisMatrix
     
     // should we use the event map for the speciation rates?
     use_cladogenetic_events = true;
+    cladogenetic_events_dirty = true;
     
     // add the new parameter
     this->addParameter( cladogenesis_matrix );
@@ -2526,6 +2553,7 @@ void TimeVaryingStateDependentSpeciationExtinctionProcess::swapParameterInternal
     if ( oldP == cladogenesis_matrix )
     {
         cladogenesis_matrix = static_cast<const TypedDagNode<CladogeneticSpeciationRateMatrix>* >( newP );
+        cladogenetic_events_dirty = true;
     }
     
 }
@@ -2555,6 +2583,9 @@ void TimeVaryingStateDependentSpeciationExtinctionProcess::touchSpecialization(c
     if ( affecter != this->dag_node )
     {
         
+        // the parameters of the cladogenetic events may have changed
+        cladogenetic_events_dirty = true;
+        
         for (std::vector<bool>::iterator it = dirty_nodes.begin(); it != dirty_nodes.end(); ++it)
         {
             (*it) = true;
@@ -2604,12 +2635,7 @@ void TimeVaryingStateDependentSpeciationExtinctionProcess::numericallyIntegrateP
         SSE_ODE ode = SSE_ODE(extinction_rates, &rg, getEventRate(), backward_time, extinction_only);
         if ( use_cladogenetic_events == true )
         {
-            cladogenesis_matrix->getValue(); // we must call getValue() to update the speciation and extinction rates in the event map
-        
-            // get cladogenesis event map (sparse speciation rate matrix)
-            std::map<std::vector<unsigned>, double> event_map = cladogenesis_matrix->getValue().getEventMap();
-        
-            ode.setEventMap( event_map );
+            ode.setEventTensor( getCladogeneticEvents() );
         }
         else
         {
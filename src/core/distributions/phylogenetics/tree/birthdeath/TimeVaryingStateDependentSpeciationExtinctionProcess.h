@@ -101,6 +101,7 @@ namespace RevBayesCore {
         double                                                          computeEpochEnd(size_t i) const;
         void                                                            computeNodeProbability(const TopologyNode &n, size_t nIdx) const;
         double                                                          computeRootLikelihood() const;
+        const SSE_ODE::EventTensor&                                     getCladogeneticEvents(void) const;
         std::vector<double>                                             pExtinction(double start, double end) const;                                                        //!< Compute the probability of extinction of the process (without incomplete taxon sampling).
         virtual double                                                  pSurvival(double start, double end) const;                                                          //!< Compute the probability of survival of the process (without incomplete taxon sampling).
         void                                                            recursivelyFlagNodeDirty(const TopologyNode& n);
@@ -118,6 +119,8 @@ namespace RevBayesCore {
         size_t                                                          num_states;
         mutable std::vector<std::vector<double> >                       scaling_factors;
         bool                                                            use_cladogenetic_events;                                                                            //!< do we use the speciation rates from the cladogenetic event map?
+        mutable SSE_ODE::EventTensor                                    cladogenetic_events;                                                                                //!< the cladogenetic event map compiled for the ODE
+        mutable bool                                                    cladogenetic_events_dirty;                                                                          //!< do we need to compile the cladogenetic events again?
         bool                                                            use_origin;
         bool                                                            sample_character_history;                                                                           //!< are we sampling the character history along branches?
         std::vector<double>                                             average_speciation;
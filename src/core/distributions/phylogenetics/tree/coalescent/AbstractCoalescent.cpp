@@ -1,5 +1,6 @@
 #include "AbstractCoalescent.h"
 
+#include <algorithm>
 #include <cmath>
 #include <iosfwd>
 
@@ -8,6 +9,7 @@
 #include "RandomNumberGenerator.h"
 #include "RbConstants.h"
 #include "RbException.h"
+#include "StochasticNode.h"
 #include "Taxon.h"
 #include "TopologyNode.h"
 #include "TimeInterval.h"
@@ -27,7 +29,9 @@ using namespace RevBayesCore;
 AbstractCoalescent::AbstractCoalescent(const std::vector<Taxon> &tn, const std::vector<Clade> &c) : TypedDistribution<Tree>( new Tree() ),
     constraints( c ),
     num_taxa( tn.size() ),
-    taxa( tn )
+    taxa( tn ),
+    all_ages_dirty( true ),
+    events_dirty( true )
 {
     
     // the combinatorial factor for the probability of a labelled history is
@@ -37,6 +41,52 @@ AbstractCoalescent::AbstractCoalescent(const std::vector<Taxon> &tn, const std::
     
     logTreeTopologyProb = 0.0;
 
+    value->getTreeChangeEventHandler().addListener( this );
+}
+
+
+AbstractCoalescent::AbstractCoalescent(const AbstractCoalescent &c) : TypedDistribution<Tree>( c ),
+    constraints( c.constraints ),
+    num_taxa( c.num_taxa ),
+    taxa( c.taxa ),
+    logTreeTopologyProb( c.logTreeTopologyProb ),
+    all_ages_dirty( true ),
+    events_dirty( true )
+{
+    
+    // the copy has its own tree, so we start with a clean slate
+    value->getTreeChangeEventHandler().addListener( this );
+}
+
+
+AbstractCoalescent::~AbstractCoalescent( void )
+{
+    
+    // the tree will be deleted automatically by the base class
+    value->getTreeChangeEventHandler().removeListener( this );
+}
+
+
+AbstractCoalescent& AbstractCoalescent::operator=(const AbstractCoalescent &c)
+{
+    
+    if ( this != &c )
+    {
+        // the base class replaces our tree
+        value->getTreeChangeEventHandler().removeListener( this );
+        
+        TypedDistribution<Tree>::operator=( c );
+        
+        constraints         = c.constraints;
+        num_taxa            = c.num_taxa;
+        taxa                = c.taxa;
+        logTreeTopologyProb = c.logTreeTopologyProb;
+        
+        value->getTreeChangeEventHandler().addListener( this );
+        resetEventAges();
+    }
+    
+    return *this;
 }
 
 
@@ -270,6 +320,155 @@ double AbstractCoalescent::computeLnProbability( void )
 
 
 
+/**
+ * Compute the log-probability of the waiting time since window_start until the event and of the event itself.
+ * Coalescent processes that use computeLnProbabilityEvents() need to override this function.
+ */
+double AbstractCoalescent::computeLnProbabilityEvent(const CoalescentEvent &e, double window_start) const
+{
+    
+    throw RbException("The coalescent process does not compute the probability of single events.");
+}
+
+
+/**
+ * Compute the log-probability of the coalescent and serial sampling ages of the tree.
+ * We merge the sorted ages with the change times of the intervals into the list of events,
+ * until the last coalescent event (the root).
+ * The log-probability of an event only depends on its time, type, number of lineages and interval,
+ * and on the time of the previous event. If all of these are the same as in the last computation
+ * and no parameter has changed, then we keep the log-probability of the event.
+ * Thus, if only a few node ages changed, then we only recompute the events next to them.
+ *
+ * \param[in]    change_times       The sorted times when a new interval starts.
+ * \param[in]    serial_sampling    Do tips older than the present add lineages, or do all lineages start at the present?
+ *
+ * \return    The log-probability of all events.
+ */
+double AbstractCoalescent::computeLnProbabilityEvents(const std::vector<double> &change_times, bool serial_sampling) const
+{
+    
+    updateEventAges();
+    
+    const std::vector<double> no_serial_sampling_ages;
+    const std::vector<double> &serial_ages = ( serial_sampling == true ? serial_sampling_ages : no_serial_sampling_ages );
+    
+    size_t num_lineages = ( serial_sampling == true ? value->getNumberOfTips() - serial_ages.size() : num_taxa );
+    size_t interval = 0;
+    
+    // create master list of event times and types
+    proposed_events.clear();
+    size_t index_coalescent = 0;
+    size_t index_serial = 0;
+    size_t index_change = 0;
+    while ( index_coalescent < coalescent_ages.size() )
+    {
+        CoalescentEvent e;
+        e.time              = coalescent_ages[index_coalescent];
+        e.type              = COALESCENT;
+        e.num_lineages      = num_lineages;
+        e.interval          = interval;
+        e.ln_probability    = 0.0;
+        
+        if ( index_serial < serial_ages.size() && ( serial_ages[index_serial] < e.time || ( serial_ages[index_serial] == e.time && getEventOrder( SERIAL_SAMPLE ) < getEventOrder( e.type ) ) ) )
+        {
+            e.time = serial_ages[index_serial];
+            e.type = SERIAL_SAMPLE;
+        }
+        if ( index_change < change_times.size() && ( change_times[index_change] < e.time || ( change_times[index_change] == e.time && getEventOrder( INTERVAL_CHANGE ) < getEventOrder( e.type ) ) ) )
+        {
+            e.time = change_times[index_change];
+            e.type = INTERVAL_CHANGE;
+        }
+        
+        if ( e.type == COALESCENT )
+        {
+            ++index_coalescent;
+            --num_lineages;
+        }
+        else if ( e.type == SERIAL_SAMPLE )
+        {
+            ++index_serial;
+            ++num_lineages;
+        }
+        else
+        {
+            ++index_change;
+            ++interval;
+        }
+        
+        proposed_events.push_back( e );
+    }
+    
+    // compute the events that changed
+    double ln_prob_times = 0.0;
+    for (size_t i = 0; i < proposed_events.size(); ++i)
+    {
+        CoalescentEvent &e = proposed_events[i];
+        double window_start = ( i > 0 ? proposed_events[i-1].time : 0.0 );
+        
+        bool unchanged = events_dirty == false && i < events.size();
+        if ( unchanged == true )
+        {
+            const CoalescentEvent &old_e = events[i];
+            double old_window_start = ( i > 0 ? events[i-1].time : 0.0 );
+            unchanged = old_e.time == e.time && old_e.type == e.type && old_e.num_lineages == e.num_lineages && old_e.interval == e.interval && old_window_start == window_start;
+        }
+        
+        e.ln_probability = ( unchanged == true ? events[i].ln_probability : computeLnProbabilityEvent( e, window_start ) );
+        ln_prob_times += e.ln_probability;
+    }
+    
+    events.swap( proposed_events );
+    events_dirty = false;
+    
+    return ln_prob_times;
+}
+
+
+/**
+ * A node of the tree has changed. We only remember the node here and move its age when we need the sorted ages.
+ */
+void AbstractCoalescent::fireTreeChangeEvent(const TopologyNode &n, const unsigned& m)
+{
+    
+    size_t index = n.getIndex();
+    if ( all_ages_dirty == true || index >= dirty_nodes.size() )
+    {
+        all_ages_dirty = true;
+    }
+    else if ( dirty_nodes[index] == false )
+    {
+        dirty_nodes[index] = true;
+        dirty_node_indices.push_back( index );
+    }
+    
+}
+
+
+/**
+ * Get the ages of the interior nodes in ascending order.
+ */
+const std::vector<double>& AbstractCoalescent::getCoalescentAges( void ) const
+{
+    
+    updateEventAges();
+    
+    return coalescent_ages;
+}
+
+
+/**
+ * Get the order of events at exactly the same time, with the lowest order coming first.
+ * By default, coalescent events come before serial samples, and these before the start of a new interval.
+ */
+size_t AbstractCoalescent::getEventOrder(EVENT_TYPE t) const
+{
+    
+    return size_t( t );
+}
+
+
 /**
  * We check here if all the constraints are satisfied.
  * These are hard constraints, that is, the clades must be monophyletic.
@@ -293,6 +492,34 @@ bool AbstractCoalescent::matchesConstraints( void )
 }
 
 
+/**
+ * Our tree has been replaced, so we need to collect all ages again.
+ */
+void AbstractCoalescent::resetEventAges( void )
+{
+    
+    all_ages_dirty = true;
+    events_dirty = true;
+    
+}
+
+
+/**
+ * Restore the current value and reset some internal flags.
+ * If a parameter was restored, then we need to recompute all events.
+ * If the tree was restored, then the tree change events already told us which nodes changed.
+ */
+void AbstractCoalescent::restoreSpecialization(const DagNode *affecter)
+{
+    
+    if ( affecter != dag_node )
+    {
+        events_dirty = true;
+    }
+    
+}
+
+
 /**
  * Redraw the current value. We delegate this to the simulate method.
  */
@@ -405,6 +632,9 @@ void AbstractCoalescent::simulateTree( void )
     delete value;
     value = psi;
     
+    value->getTreeChangeEventHandler().addListener( this );
+    resetEventAges();
+    
 }
 
 /**
@@ -452,4 +682,124 @@ void AbstractCoalescent::simulateHeterochronousTree( void )
     delete value;
     value = psi;
     
+    value->getTreeChangeEventHandler().addListener( this );
+    resetEventAges();
+    
+}
+
+
+/**
+ * Set the current value, e.g., attach an observation.
+ * We listen to the changes of the new tree instead of the old one.
+ */
+void AbstractCoalescent::setValue(Tree *v, bool force)
+{
+    
+    value->getTreeChangeEventHandler().removeListener( this );
+    
+    // delegate to super class
+    TypedDistribution<Tree>::setValue( v, force );
+    
+    value->getTreeChangeEventHandler().addListener( this );
+    resetEventAges();
+    
+}
+
+
+/**
+ * Touch the current value and reset some internal flags.
+ * If a parameter changed, then we need to recompute all events.
+ * If everything was touched, then the tree may have changed without telling us which nodes, so we collect all ages again.
+ */
+void AbstractCoalescent::touchSpecialization(const DagNode *affecter, bool touchAll)
+{
+    
+    if ( affecter != dag_node || touchAll == true )
+    {
+        events_dirty = true;
+    }
+    
+    if ( touchAll == true )
+    {
+        all_ages_dirty = true;
+    }
+    
+}
+
+
+/**
+ * Bring the sorted coalescent and serial sampling ages up to date.
+ * For every node that changed since the last update, we remove its previous age and insert its current age.
+ */
+void AbstractCoalescent::updateEventAges( void ) const
+{
+    
+    if ( all_ages_dirty == false )
+    {
+        for (size_t i = 0; i < dirty_node_indices.size(); ++i)
+        {
+            size_t index = dirty_node_indices[i];
+            dirty_nodes[index] = false;
+            
+            const TopologyNode &n = value->getNode( index );
+            double old_age = node_ages[index];
+            double new_age = n.getAge();
+            if ( old_age == new_age )
+            {
+                continue;
+            }
+            
+            // the tips at the present are not events
+            std::vector<double> &ages = ( n.isTip() == true ? serial_sampling_ages : coalescent_ages );
+            if ( n.isTip() == false || old_age > 0.0 )
+            {
+                std::vector<double>::iterator it = std::lower_bound( ages.begin(), ages.end(), old_age );
+                if ( it == ages.end() || *it != old_age )
+                {
+                    // we lost track of this age, so we simply collect all ages again
+                    all_ages_dirty = true;
+                    break;
+                }
+                ages.erase( it );
+            }
+            if ( n.isTip() == false || new_age > 0.0 )
+            {
+                ages.insert( std::upper_bound( ages.begin(), ages.end(), new_age ), new_age );
+            }
+            node_ages[index] = new_age;
+        }
+        dirty_node_indices.clear();
+    }
+    
+    if ( all_ages_dirty == true )
+    {
+        size_t num_nodes = value->getNumberOfNodes();
+        
+        coalescent_ages.clear();
+        serial_sampling_ages.clear();
+        node_ages.resize( num_nodes );
+        for (size_t i = 0; i < num_nodes; ++i)
+        {
+            const TopologyNode &n = value->getNode( i );
+            double a = n.getAge();
+            node_ages[i] = a;
+            if ( n.isTip() == false )
+            {
+                coalescent_ages.push_back( a );
+            }
+            else if ( a > 0.0 )
+            {
+                serial_sampling_ages.push_back( a );
+            }
+        }
+        
+        // sort the vectors of times in ascending order
+        std::sort( coalescent_ages.begin(), coalescent_ages.end() );
+        std::sort( serial_sampling_ages.begin(), serial_sampling_ages.end() );
+        
+        dirty_nodes = std::vector<bool>( num_nodes, false );
+        dirty_node_indices.clear();
+        all_ages_dirty = false;
+    }
+    
 }
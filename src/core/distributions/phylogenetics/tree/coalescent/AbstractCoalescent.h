@@ -6,6 +6,7 @@
 
 #include "Taxon.h"
 #include "Tree.h"
+#include "TreeChangeEventListener.h"
 #include "TypedDistribution.h"
 #include "Clade.h"
 
@@ -17,11 +18,20 @@ namespace RevBayesCore {
      * @brief Declaration of the abstract coalescent process class.
      *
      *This file contains the declaration of the random variable class for any coalescent process.
+     *
+     * The coalescent process listens to changes of the tree. We keep the sorted coalescent and serial sampling ages
+     * and only move the ages of the nodes that changed. Coalescent processes with intervals can use computeLnProbabilityEvents(),
+     * which merges these ages with the interval change times into a list of events and keeps the log-probability of each event,
+     * so that only the events with a different waiting time, number of lineages or interval are recomputed.
      */
-    class AbstractCoalescent : public TypedDistribution<Tree> {
+    class AbstractCoalescent : public TypedDistribution<Tree>, public TreeChangeEventListener {
         
     public:
         AbstractCoalescent(const std::vector<Taxon> &tn, const std::vector<Clade> &c);
+        AbstractCoalescent(const AbstractCoalescent &c);
+        virtual                                            ~AbstractCoalescent(void);
+        
+        AbstractCoalescent&                                 operator=(const AbstractCoalescent &c);
         
         // pure virtual member functions
         virtual AbstractCoalescent*                         clone(void) const = 0;                                                                              //!< Create an independent clone
@@ -29,20 +39,43 @@ namespace RevBayesCore {
         
         // public member functions you may want to override
         double                                              computeLnProbability(void);                                                                         //!< Compute the log-transformed probability of the current value.
+        void                                                fireTreeChangeEvent(const TopologyNode &n, const unsigned& m=0);                                    //!< The tree has changed and we want to know which part.
         virtual void                                        redrawValue(void);                                                                                  //!< Draw a new random value from the distribution
+        virtual void                                        setValue(Tree *v, bool f=false);                                                                    //!< Set the current value, e.g. attach an observation (clamp)
         
         
     protected:
         
+        enum EVENT_TYPE { COALESCENT, SERIAL_SAMPLE, INTERVAL_CHANGE };
+        
+        /** An event of the coalescent process, together with the log-probability of the waiting time until the event and of the event itself */
+        struct CoalescentEvent {
+            double                                          time;
+            EVENT_TYPE                                      type;
+            size_t                                          num_lineages;                                                                                       //!< The number of lineages before the event
+            size_t                                          interval;                                                                                           //!< The interval before the event
+            double                                          ln_probability;
+        };
+        
+        // Parameter management functions
+        virtual void                                        restoreSpecialization(const DagNode *restorer);
+        virtual void                                        touchSpecialization(const DagNode *toucher, bool touchAll);
+        
         // pure virtual helper functions
         virtual double                                      computeLnProbabilityTimes(void) const = 0;                                                          //!< Compute the log-transformed probability of the current value.
         virtual std::vector<double>                         simulateCoalescentAges(size_t n) const = 0;                                                         //!< Simulate n coalescent events.
         
+        // helper functions you may want to override
+        virtual double                                      computeLnProbabilityEvent(const CoalescentEvent &e, double window_start) const;                     //!< Compute the log-probability of the waiting time since window_start and of the event.
+        virtual size_t                                      getEventOrder(EVENT_TYPE t) const;                                                                  //!< The order of events at the same time.
+        
         // helper functions
         void                                                attachAges(Tree *psi, std::vector<TopologyNode *> &tips, size_t index,
                                                                         const std::vector<double> &a);
         void                                                buildRandomBinaryTree(std::vector<TopologyNode *> &tips);
         void                                                buildHeterochronousRandomBinaryTree(Tree *psi, std::vector<TopologyNode*> &active, const std::vector<double> &ages);
+        double                                              computeLnProbabilityEvents(const std::vector<double> &change_times, bool serial_sampling) const;   //!< Sum up the log-probabilities of all events, recomputing only the events that changed.
+        const std::vector<double>&                          getCoalescentAges(void) const;                                                                      //!< The sorted ages of the interior nodes.
         bool                                                matchesConstraints(void);
         void                                                simulateTree(void);
         void                                                simulateHeterochronousTree(void);                                                                   //!< Simulates a heterochronus coalescent tree.
@@ -53,6 +86,22 @@ namespace RevBayesCore {
         std::vector<Taxon>                                  taxa;                                                                                               //!< Taxon names that will be attached to new simulated trees.
         double                                              logTreeTopologyProb;                                                                                //!< Log-transformed tree topology probability (combinatorial constant).
         
+    private:
+        
+        void                                                resetEventAges(void);
+        void                                                updateEventAges(void) const;
+        
+        mutable std::vector<double>                         coalescent_ages;                                                                                    //!< The sorted ages of the interior nodes
+        mutable std::vector<double>                         serial_sampling_ages;                                                                               //!< The sorted ages of the tips that are older than the present
+        mutable std::vector<double>                         node_ages;                                                                                          //!< The age of each node when we last updated the sorted ages
+        mutable std::vector<bool>                           dirty_nodes;
+        mutable std::vector<size_t>                         dirty_node_indices;
+        mutable bool                                        all_ages_dirty;
+        
+        mutable std::vector<CoalescentEvent>                events;                                                                                             //!< The events of the last computation
+        mutable std::vector<CoalescentEvent>                proposed_events;
+        mutable bool                                        events_dirty;                                                                                       //!< Did a parameter change, so that we need to recompute all events?
+        
     };
     
 }
@@ -81,152 +81,65 @@ HeterochronousCoalescent* HeterochronousCoalescent::clone( void ) const
 double HeterochronousCoalescent::computeLnProbabilityTimes( void ) const
 {
     
-    // variable declarations and initialization
-    double ln_prob_times = 0;
-    
-    // retrieve the coalescence times
-    std::vector<double> ages;
-    for (size_t i = 0; i < value->getNumberOfInteriorNodes()+1; ++i)
-    {
-        const TopologyNode& n = value->getInteriorNode( i );
-        double a = n.getAge();
-        ages.push_back(a);
-    }
-    // sort the vector of coalescence times in ascending order
-    std::sort(ages.begin(), ages.end());
+    // events are either a sample (lineage size up), coalescence (lineage size down), or change of the demographic function (lineage size constant)
+    return computeLnProbabilityEvents( intervals->getValue(), true );
+}
+
+
+/**
+ * Compute the log-probability of the waiting time until the event and of the event itself
+ * under the demographic function of the interval.
+ *
+ * \param[in]    e                  The event.
+ * \param[in]    window_start       The time of the previous event.
+ *
+ * \return    The log-probability density of the event.
+ */
+double HeterochronousCoalescent::computeLnProbabilityEvent(const CoalescentEvent &e, double window_start) const
+{
     
-    // retrieve the times of any serially sampled tips
-    std::vector<double> serial_times;
-    size_t num_taxa_at_present = value->getNumberOfTips();
-    for (size_t i = 0; i < value->getNumberOfTips(); ++i)
+    if ( e.interval >= demographies.size() )
     {
-        double a = value->getTipNode(i).getAge();
-        if ( a > 0.0 )
-        {
-            serial_times.push_back(a);
-            --num_taxa_at_present;
-        }
+        throw RbException("Problem occurred in coalescent process with demographic functions: We tried to access a demographic function outside the vector.");
     }
+    const DemographicFunction &current_demographic_function = demographies[e.interval];
     
-    // retrieve change times
-    const RbVector<double> &change_times = intervals->getValue();
-    
-    std::vector<double> combined_event_times;
-    std::vector<EVENT_TYPE> combined_event_types;
+    size_t j = e.num_lineages;
+    double n_pairs = j * (j-1) / 2.0;
+    double interval_area = current_demographic_function.getIntegral(window_start, e.time);
     
-    bool heterochronous = num_taxa_at_present < num_taxa;
+    // log probability that nothing happens until the next event
+    double ln_prob = - n_pairs * interval_area;
     
-    if ( heterochronous == true )
+    if ( e.type == COALESCENT )
     {
-        // sort the vector of serial sampling times in ascending order
-        std::sort(serial_times.begin(), serial_times.end());
+        double theta_at_coal_time = current_demographic_function.getDemographic(e.time);
+        ln_prob -= log( theta_at_coal_time );
     }
+    
+    return ln_prob;
+}
 
-    size_t index_age = 0;
-    size_t index_serial_time = 0;
-    size_t index_demographic_function_change_point = 0;
-    double next_age = ages[index_age];
-    double next_serial_time = RbConstants::Double::nan;
-    if ( heterochronous == true )
-    {
-        next_serial_time = serial_times[index_serial_time];
-    }
-    double next_df_change_time = RbConstants::Double::inf;
-    if ( index_demographic_function_change_point < change_times.size() )
+
+/**
+ * Serial samples come first, then changes of the demographic function, and then coalescent events.
+ */
+size_t HeterochronousCoalescent::getEventOrder(EVENT_TYPE t) const
+{
+    
+    if ( t == SERIAL_SAMPLE )
     {
-        next_df_change_time = change_times[index_demographic_function_change_point];
+        return 0;
     }
-    // create master list of event times and types
-    // events are either a sample (lineage size up), coalescence (lineage size down), or theta changepoint (lineage size constant)
-    do
-    {
-        next_age = ages[index_age];
-        if ( heterochronous == true && next_serial_time <= next_age && next_serial_time <= next_df_change_time )
-        {
-            // serial sample
-            combined_event_times.push_back(next_serial_time);
-            combined_event_types.push_back( SERIAL_SAMPLE );
-            ++index_serial_time;
-            if (index_serial_time < serial_times.size())
-            {
-                next_serial_time = serial_times[index_serial_time];
-            }
-            else
-            {
-                next_serial_time = RbConstants::Double::inf;
-            }
-        }
-        else if ( next_df_change_time <= next_age )
-        {
-            // change of demographic function
-            combined_event_times.push_back(next_df_change_time);
-            combined_event_types.push_back( DEMOGRAPHIC_MODEL_CHANGE );
-            ++index_demographic_function_change_point;
-            if ( index_demographic_function_change_point < change_times.size() )
-            {
-                next_df_change_time = change_times[index_demographic_function_change_point];
-            }
-            else
-            {
-                next_df_change_time = RbConstants::Double::inf;
-            }
-        }
-        else
-        {
-            // coalescence
-            combined_event_times.push_back(next_age);
-            combined_event_types.push_back(COALESCENT);
-            ++index_age;
-        }
-    } while (index_age < ages.size());
-        
-    
-    
-    size_t j = num_taxa_at_present;
-    double window_start = 0.0;
-    size_t index_demographic_function = 0;
-    const DemographicFunction *current_demographic_function = &demographies[index_demographic_function];
-    
-    
-    for (size_t i = 0; i < combined_event_times.size(); ++i)
+    else if ( t == INTERVAL_CHANGE )
     {
-        double n_pairs = j * (j-1) / 2.0;
-        double interval_area = current_demographic_function->getIntegral(window_start, combined_event_times[i]);
-        
-        // add log probability that nothing happens until the next event
-        ln_prob_times -= n_pairs * interval_area;
-        
-        // handle events accordingly
-        if (combined_event_types[i] == SERIAL_SAMPLE )
-        {
-            // sampled ancestor
-            ++j;
-        }
-        else if ( combined_event_types[i] == DEMOGRAPHIC_MODEL_CHANGE )
-        {
-            // change of the demographic function
-            ++index_demographic_function;
-            if ( index_demographic_function > demographies.size() )
-            {
-                throw RbException("Problem occurred in coalescent process with demographic functions: We tried to access a demographic function outside the vector.");
-            }
-            current_demographic_function = &demographies[index_demographic_function];
-        }
-        else
-        {
-            // coalescence
-            double theta_at_coal_time = current_demographic_function->getDemographic(combined_event_times[i]);
-            ln_prob_times -= log( theta_at_coal_time );
-            --j;
-        }
-        
-        window_start = combined_event_times[i];
+        return 1;
     }
     
-    return ln_prob_times;
-    
+    return 2;
 }
 
+
 /**
  * Simulate new coalescent times.
  *
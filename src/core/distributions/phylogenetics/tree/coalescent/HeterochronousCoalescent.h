@@ -35,14 +35,14 @@ namespace RevBayesCore {
         void                                                swapParameterInternal(const DagNode *oldP, const DagNode *newP);                                //!< Swap a parameter
         
         // derived helper functions
+        double                                              computeLnProbabilityEvent(const CoalescentEvent &e, double window_start) const;                 //!< Compute the log-probability of the waiting time since window_start and of the event.
         double                                              computeLnProbabilityTimes(void) const;                                                          //!< Compute the log-transformed probability of the current value.
+        size_t                                              getEventOrder(EVENT_TYPE t) const;                                                              //!< The order of events at the same time.
         std::vector<double>                                 simulateCoalescentAges(size_t n) const;                                                         //!< Simulate n coalescent events.
         
         
     private:
         
-        enum EVENT_TYPE { COALESCENT, SERIAL_SAMPLE, DEMOGRAPHIC_MODEL_CHANGE };
-        
         // members
         const TypedDagNode< RbVector<double> >*             intervals; //!<The start times for intervals
         RbVector< DemographicFunction >                     demographies; //!< a vector of functions that model how the demogrpahy changes over the course of that interval
@@ -87,64 +87,36 @@ PiecewiseConstantCoalescent* PiecewiseConstantCoalescent::clone( void ) const
 double PiecewiseConstantCoalescent::computeLnProbabilityTimes( void ) const
 {
     
-    // variable declarations and initialization
-    double lnProbTimes = 0;
-    
     const_cast< PiecewiseConstantCoalescent* >( this )->updateIntervals();
     
-    // retrieved the speciation times
-    std::vector<double> ages;
-    for (size_t i = 0; i < value->getNumberOfInteriorNodes()+1; ++i)
-    {
-        const TopologyNode& n = value->getInteriorNode( i );
-        double a = n.getAge();
-        ages.push_back(a);
-    }
-    // sort the vector of times in ascending order
-    std::sort(ages.begin(), ages.end());
+    // all lineages start at the present, so we ignore the ages of the tips
+    return computeLnProbabilityEvents( interval_starts, false );
+}
+
+
+/**
+ * Compute the log-probability of the waiting time until the event and of the event itself.
+ * The population size is constant within the interval.
+ *
+ * \param[in]    e                  The event.
+ * \param[in]    window_start       The time of the previous event.
+ *
+ * \return    The log-probability density of the event.
+ */
+double PiecewiseConstantCoalescent::computeLnProbabilityEvent(const CoalescentEvent &e, double window_start) const
+{
     
-    size_t currentInterval = 0;
+    size_t j = e.num_lineages;
+    double theta = pop_sizes[e.interval];
+    double nPairs = j * (j-1) / 2.0;
+    double deltaAge = e.time - window_start;
     
-    for (size_t i = 0; i < ages.size(); ++i)
+    if ( e.type == COALESCENT )
     {
-        size_t j = num_taxa - i;
-        double theta = 0.0;
-        double nPairs = j * (j-1) / 2.0;
-        
-        double prevCoalescentTime = 0.0;
-        if ( i > 0 )
-        {
-            prevCoalescentTime = ages[i-1];
-        }
-        
-        double deltaAge = ages[i];
-        bool valid = false;
-        do
-        {
-            theta = pop_sizes[currentInterval];
-            double age = ages[i];
-            double max = age;
-            if ( currentInterval < interval_starts.size() )
-            {
-                max = (age > interval_starts[currentInterval]) ? interval_starts[currentInterval] : age;
-            }
-            
-            deltaAge = max - prevCoalescentTime;
-            valid = currentInterval >= interval_starts.size() || age <= interval_starts[currentInterval];
-            if ( !valid )
-            {
-                ++currentInterval;
-                prevCoalescentTime = max;
-                
-                lnProbTimes -= nPairs * deltaAge / theta ;
-            }
-            
-        } while ( !valid );
-        
-        lnProbTimes += log( 1.0 / theta ) - nPairs * deltaAge / theta;
+        return log( 1.0 / theta ) - nPairs * deltaAge / theta;
     }
     
-    return lnProbTimes;
+    return - nPairs * deltaAge / theta;
 }
 
 
@@ -187,6 +159,8 @@ void PiecewiseConstantCoalescent::keepSpecialization(const DagNode *affecter)
 void PiecewiseConstantCoalescent::restoreSpecialization(const DagNode *affecter)
 {
     
+    AbstractCoalescent::restoreSpecialization( affecter );
+    
     // just re-update the start times of the intervals
     updateIntervals();
     
@@ -308,6 +282,8 @@ void PiecewiseConstantCoalescent::swapParameterInternal(const DagNode *oldP, con
 void PiecewiseConstantCoalescent::touchSpecialization(const DagNode *affecter, bool touchAll)
 {
     
+    AbstractCoalescent::touchSpecialization( affecter, touchAll );
+    
     // just update the start times of the intervals
     updateIntervals();
     
@@ -391,16 +367,8 @@ void PiecewiseConstantCoalescent::updateIntervals( void )
         
         if ( this->value != NULL )
         {            
-            // retrieved the speciation times
-            std::vector<double> ages;
-            for (size_t i = 0; i < value->getNumberOfInteriorNodes()+1; ++i)
-            {
-                const TopologyNode& n = value->getInteriorNode( i );
-                double a = n.getAge();
-                ages.push_back(a);
-            }
-            // sort the vector of times in ascending order
-            std::sort(ages.begin(), ages.end());
+            // retrieved the speciation times in ascending order
+            const std::vector<double> &ages = getCoalescentAges();
             
             size_t num_events_per_interval = size_t( ceil( double(num_taxa-1.0)/Nes->getValue().size()) );
             size_t current_interval = 0;
@@ -47,6 +47,7 @@ namespace RevBayesCore {
         virtual void                                        touchSpecialization(const DagNode *toucher, bool touchAll);
 
         // derived helper functions
+        double                                              computeLnProbabilityEvent(const CoalescentEvent &e, double window_start) const;                 //!< Compute the log-probability of the waiting time since window_start and of the event.
         double                                              computeLnProbabilityTimes(void) const;                                                          //!< Compute the log-transformed probability of the current value.
         std::vector<double>                                 simulateCoalescentAges(size_t n) const;
         
@@ -75,147 +75,37 @@ PiecewiseConstantHeterochronousCoalescent* PiecewiseConstantHeterochronousCoales
 double PiecewiseConstantHeterochronousCoalescent::computeLnProbabilityTimes( void ) const
 {
 
-    // variable declarations and initialization
-    double lnProbTimes = 0;
-
-    const RbVector<double> &popSizes  = Nes->getValue();
-    const RbVector<double> &intervals = intervalStarts->getValue();
-
-    // retrieve the coalescence times
-    std::vector<double> ages;
-    for (size_t i = 0; i < value->getNumberOfInteriorNodes()+1; ++i)
-    {
-        const TopologyNode& n = value->getInteriorNode( i );
-        double a = n.getAge();
-        ages.push_back(a);
-    }
-    // sort the vector of coalescence times in ascending order
-    std::sort(ages.begin(), ages.end());
-
-    // retrieve the times of any serially sampled tips
-    std::vector<double> serialTimes;
-    size_t num_taxaAtPresent = value->getNumberOfTips();
-    for (size_t i = 0; i < value->getNumberOfTips(); ++i)
-    {
-        const TopologyNode& n = value->getTipNode( i );
-        double a = n.getAge();
-        if ( a > 0.0 ) {
-            serialTimes.push_back(a);
-            --num_taxaAtPresent;
-        }
-    }
-
-    std::vector<double> combinedEventTimes;
-    std::vector<int> combinedEventTypes;
-    if (num_taxaAtPresent < num_taxa) {
-
-        // sort the vector of serial sampling times in ascending order
-        std::sort(serialTimes.begin(), serialTimes.end());
-
-        size_t atAge = 0;
-        size_t atSerialTime = 0;
-        size_t atIntervalStart = 0;
-        double nextAge = ages[atAge];
-        double nextSerialTime = serialTimes[atSerialTime];
-        double nextIntervalStart = intervals[atIntervalStart];
-
-        // create master list of event times and types
-        // events are either a sample (lineage size up), coalescence (lineage size down), or theta changepoint (lineage size constant)
-        do
-        {
-            nextAge = ages[atAge];
-            if (nextAge <= nextSerialTime && nextAge <= nextIntervalStart) {
-                // coalescence
-                combinedEventTimes.push_back(nextAge);
-                combinedEventTypes.push_back(-1);
-                ++atAge;
-            } else if (nextSerialTime <= nextAge && nextSerialTime <= nextIntervalStart) {
-                // serial sample
-                combinedEventTimes.push_back(nextSerialTime);
-                combinedEventTypes.push_back(1);
-                ++atSerialTime;
-                if (atSerialTime < serialTimes.size()) {
-                    nextSerialTime = serialTimes[atSerialTime];
-                } else {
-                    nextSerialTime = RbConstants::Double::inf;
-                }
-            } else {
-                // theta change
-                combinedEventTimes.push_back(nextIntervalStart);
-                combinedEventTypes.push_back(0);
-                ++atIntervalStart;
-                if (atIntervalStart < intervals.size()) {
-                    nextIntervalStart = intervals[atIntervalStart];
-                } else {
-                    nextIntervalStart = RbConstants::Double::inf;
-                }
-            }
-        } while (atAge < ages.size());
-
-    } else {
-        size_t atAge = 0;
-        size_t atIntervalStart = 0;
-        double nextAge = ages[atAge];
-        double nextIntervalStart = intervals[atIntervalStart];
+    // events are either a sample (lineage size up), coalescence (lineage size down), or theta changepoint (lineage size constant)
+    return computeLnProbabilityEvents( intervalStarts->getValue(), true );
+}
 
-        // create master list of event times and types
-        // events are either a sample (lineage size up), coalescence (lineage size down), or theta changepoint (lineage size constant)
-        do
-        {
-            nextAge = ages[atAge];
-            if (nextIntervalStart <= nextAge) {
-                // theta change
-                combinedEventTimes.push_back(nextIntervalStart);
-                combinedEventTypes.push_back(0);
-                ++atIntervalStart;
-                if (atIntervalStart < intervals.size()) {
-                    nextIntervalStart = intervals[atIntervalStart];
-                } else {
-                    nextIntervalStart = RbConstants::Double::inf;
-                }
-            } else {
-                // coalescence
-                combinedEventTimes.push_back(nextAge);
-                combinedEventTypes.push_back(-1);
-                ++atAge;
-            }
-        } while (atAge < ages.size());
-    }
 
+/**
+ * Compute the log-probability of the waiting time until the event and of the event itself.
+ * The population size is constant within the interval.
+ *
+ * \param[in]    e                  The event.
+ * \param[in]    window_start       The time of the previous event.
+ *
+ * \return    The log-probability density of the event.
+ */
+double PiecewiseConstantHeterochronousCoalescent::computeLnProbabilityEvent(const CoalescentEvent &e, double window_start) const
+{
 
-    size_t currentInterval = 0;
-    size_t j = num_taxaAtPresent;
-    double windowStart = 0.0;
+    size_t j = e.num_lineages;
+    double theta = Nes->getValue()[e.interval];
+    double nPairs = j * (j-1) / 2.0;
+    double deltaAge = e.time - window_start;
 
-    for (size_t i = 0; i < combinedEventTimes.size(); ++i)
+    if ( e.type == COALESCENT )
     {
-        
-        double theta = popSizes[currentInterval];
-        double nPairs = j * (j-1) / 2.0;
-        
-        double deltaAge = combinedEventTimes[i] - windowStart;
-
-        if (combinedEventTypes[i] == -1) {
-            // coalescence
-            lnProbTimes += log( 1.0 / theta ) - nPairs * deltaAge / theta;
-            --j;
-        } else if (combinedEventTypes[i] == 1) {
-            // sampled ancestor
-            lnProbTimes -= nPairs * deltaAge / theta ;
-            ++j;
-        } else {
-            // theta change
-            lnProbTimes -= nPairs * deltaAge / theta ;
-            ++currentInterval;
-        }
-
-        windowStart = combinedEventTimes[i];
+        return log( 1.0 / theta ) - nPairs * deltaAge / theta;
     }
 
-    return lnProbTimes;
-
+    return - nPairs * deltaAge / theta;
 }
 
+
 /**
  * Simulate new coalescent times.
  *
@@ -36,6 +36,7 @@ namespace RevBayesCore {
         void                                                swapParameterInternal(const DagNode *oldP, const DagNode *newP);            //!< Swap a parameter
         
         // derived helper functions
+        double                                              computeLnProbabilityEvent(const CoalescentEvent &e, double window_start) const;                 //!< Compute the log-probability of the waiting time since window_start and of the event.
         double                                              computeLnProbabilityTimes(void) const;                                                          //!< Compute the log-transformed probability of the current value.
         std::vector<double>                                 simulateCoalescentAges(size_t n) const;                                                         //!< Simulate n coalescent events.
         
@@ -1,5 +1,3 @@
-//#define DEBUG_DEC
-
 #include "DECCladogeneticStateFunction.h"
 
 #include <algorithm>
@@ -60,9 +58,18 @@ DECCladogeneticStateFunction::DECCladogeneticStateFunction(const TypedDagNode< S
     
     if (numCharacters <= MAX_NUM_AREAS)
     {
-        buildBits();
-        buildRanges(beforeRanges, connectivityGraph, false);
-        buildRanges(afterRanges, vicarianceGraph, false);
+        buildMasks();
+        buildRanges(beforeRangeMasks, connectivityGraph, false);
+        buildRanges(afterRangeMasks, vicarianceGraph, false);
+        
+        // the states of the supported ranges, in increasing order
+        for (size_t i = 1; i < statesToMasks.size(); i++)
+        {
+            if (beforeRangeMasks[ statesToMasks[i] ] == true)
+            {
+                beforeRanges.push_back( (unsigned)i );
+            }
+        }
         
         numRanges = (unsigned)beforeRanges.size();
         numRanges++; // add one for the null range
@@ -83,67 +90,7 @@ DECCladogeneticStateFunction::~DECCladogeneticStateFunction( void ) {
     // We don't delete the parameters, because they might be used somewhere else too. The model needs to do that!
 }
 
-std::vector<unsigned> DECCladogeneticStateFunction::bitAllopatryComplement( const std::vector<unsigned>& mask, const std::vector<unsigned>& base )
-{
-    std::vector<unsigned> ret = mask;
-    for (size_t i = 0; i < base.size(); i++)
-    {
-        if (base[i] == 1)
-            ret[i] = 0;
-    }
-    return ret;
-}
-
-void DECCladogeneticStateFunction::bitCombinations(std::vector<std::vector<unsigned> >& comb, std::vector<unsigned> array, int i, std::vector<unsigned> accum)
-{
-    if (i == array.size()) // end recursion
-    {
-        unsigned n = sumBits(accum);
-
-        if ( n == 0 || n == sumBits(array) )
-            ;  // ignore all-0, all-1 vectors
-        else
-            comb.push_back(accum);
-    }
-    else
-    {
-        unsigned b = array[i];
-        std::vector<unsigned> tmp0(accum);
-        std::vector<unsigned> tmp1(accum);
-        tmp0.push_back(0);
-        bitCombinations(comb,array,i+1,tmp0);
-        if (b == 1)
-        {
-            tmp1.push_back(1);
-            bitCombinations(comb,array,i+1,tmp1);
-        }
-    }
-}
-
-unsigned DECCladogeneticStateFunction::sumBits(const std::vector<unsigned>& b)
-{
-    unsigned n = 0;
-    for (int i = 0; i < b.size(); i++)
-        n += b[i];
-    return n;
-}
-
-unsigned DECCladogeneticStateFunction::bitsToState( const std::vector<unsigned>& b )
-{
-    return bitsToStatesByNumOn[b];
-}
-
-std::string DECCladogeneticStateFunction::bitsToString( const std::vector<unsigned>& b )
-{
-    std::stringstream ss;
-    for (size_t i = 0; i < b.size(); i++)
-    {
-        ss << b[i];
-    }
-    return ss.str();
-}
-
-void DECCladogeneticStateFunction::buildBits( void )
+void DECCladogeneticStateFunction::buildMasks( void )
 {
     
     for (size_t i = 0; i < eventTypes.size(); i++) {
@@ -157,426 +104,227 @@ void DECCladogeneticStateFunction::buildBits( void )
             eventStringToStateMap[ eventTypes[i] ] = BiogeographicCladoEvent::SYMPATRY_WIDESPREAD;
     }
     
-    bitsByNumOn.resize(numCharacters+1);
-    statesToBitsByNumOn.resize(numIntStates);
-    bits = std::vector<std::vector<unsigned> >(numIntStates, std::vector<unsigned>(numCharacters, 0));
-    bitsByNumOn[0].push_back(bits[0]);
-    for (size_t i = 1; i < numIntStates; i++)
+    // count the areas in each range
+    maskSizes = std::vector<unsigned>(numIntStates, 0);
+    for (size_t m = 1; m < numIntStates; m++)
     {
-        size_t m = i;
-        for (size_t j = 0; j < numCharacters; j++)
-        {
-            bits[i][j] = m % 2;
-            m /= 2;
-            if (m == 0)
-                break;
-        }
-        size_t j = sumBits(bits[i]);
-        bitsByNumOn[j].push_back(bits[i]);
-        
-    }
-    for (size_t i = 0; i < numIntStates; i++)
-    {
-        inverseBits[ bits[i] ] = (unsigned)i;
+        maskSizes[m] = maskSizes[m >> 1] + (m & 1);
     }
     
-    // assign state to each bit vector, sorted by numOn
-    size_t k = 0;
-    for (size_t i = 0; i < bitsByNumOn.size(); i++)
+    // assign a state to each range, sorted by the number of areas and then by the bitmask
+    statesToMasks.clear();
+    statesToMasks.reserve(numIntStates);
+    for (unsigned n = 0; n <= numCharacters; n++)
     {
-        for (size_t j = 0; j < bitsByNumOn[i].size(); j++)
+        for (unsigned m = 0; m < numIntStates; m++)
         {
-            statesToBitsByNumOn[k++] = bitsByNumOn[i][j];
+            if (maskSizes[m] == n)
+            {
+                statesToMasks.push_back(m);
+            }
         }
     }
     
-    for (size_t i = 0; i < statesToBitsByNumOn.size(); i++)
+    masksToStates = std::vector<unsigned>(numIntStates, 0);
+    for (size_t i = 0; i < statesToMasks.size(); i++)
     {
-        bitsToStatesByNumOn[ statesToBitsByNumOn[i] ] = (unsigned)i;
+        masksToStates[ statesToMasks[i] ] = (unsigned)i;
     }
 
 }
 
+
+/**
+ * Add the event (ancestor, left, right) of this type to the events of the ancestral range.
+ */
+void DECCladogeneticStateFunction::addEvent(std::map<std::vector<unsigned>, unsigned>& event_types, size_t range_index, unsigned ancestor, unsigned left, unsigned right, unsigned type)
+{
+    
+    std::vector<unsigned> idx(3);
+    idx[0] = ancestor;
+    idx[1] = left;
+    idx[2] = right;
+    
+    event_types[ idx ] = type;
+    eventMapCounts[ range_index ][ type ] += 1;
+    
+}
+
+
 void DECCladogeneticStateFunction::buildEventMap( void ) {
     
-//    eventMapCounts.resize(numRanges, std::vector<unsigned>(numEventTypes, 0));
-    eventMapCounts.clear();
-    std::map<std::vector<unsigned>, double> eventMapProbs;
+    eventMapCounts = std::vector<std::vector<unsigned> >( beforeRanges.size(), std::vector<unsigned>(BiogeographicCladoEvent::NUM_STATES, 0) );
+    std::map<std::vector<unsigned>, unsigned> event_types;
     
-//    statesToBitsByNumOn = bits;
-//    bitsToStatesByNumOn = inverseBits;
+    bool use_sympatry_subset      = eventStringToStateMap.find("s") != eventStringToStateMap.end();
+    bool use_sympatry_widespread  = eventStringToStateMap.find("f") != eventStringToStateMap.end();
+    bool use_allopatry            = eventStringToStateMap.find("a") != eventStringToStateMap.end();
+    bool use_jump_dispersal       = eventStringToStateMap.find("j") != eventStringToStateMap.end();
+    unsigned all_areas = numIntStates - 1;
     
     // get L,R states per A state
-    std::vector<unsigned> idx(3);
-//    for (unsigned i = 0; i < numRanges; i++) {
-    for (std::set<unsigned>::iterator its = beforeRanges.begin(); its != beforeRanges.end(); its++)
+    for (size_t r = 0; r < beforeRanges.size(); r++)
     {
-        unsigned i = *its;
-        idx[0] = i;
-        eventMapCounts[i] = std::vector<unsigned>(BiogeographicCladoEvent::NUM_STATES, 0);
-        
-        // only include supported ranges
-//        if (beforeRanges.find(i) == beforeRanges.end())
-//            continue;
-   
-#ifdef DEBUG_DEC
-        std::cout << "State " << i << "\n";
-        std::cout << "Bits  " << bitsToString(statesToBitsByNumOn[i]) << "\n";
-#endif
-        
-        // get on bits for A
-        const std::vector<unsigned>& ba = statesToBitsByNumOn[i];
-        std::vector<unsigned> on;
-        std::vector<unsigned> off;
-        for (unsigned j = 0; j < ba.size(); j++)
-        {
-            if (ba[j] == 1)
-                on.push_back(j);
-            else
-                off.push_back(j);
-        }
-        
-        std::vector<unsigned> bl(numCharacters, 0);
-        std::vector<unsigned> br(numCharacters, 0);
+        unsigned i  = beforeRanges[r];
+        unsigned ba = statesToMasks[i];
         
         // narrow sympatry
-        if (sumBits(ba) == 1)
+        if (maskSizes[ba] == 1)
         {
-            idx[1] = i;
-            idx[2] = i;
-            if (beforeRanges.find(i) == beforeRanges.end())
-            {
-                continue;
-            }
-            
-//            eventMapTypes[ idx ] = BiogeographicCladoEvent::SYMPATRY_NARROW;
-//            eventMapCounts[ i ][  BiogeographicCladoEvent::SYMPATRY_NARROW ] += 1;
-            eventMapTypes[ idx ] = BiogeographicCladoEvent::SYMPATRY_SUBSET;
-            eventMapCounts[ i ][  BiogeographicCladoEvent::SYMPATRY_SUBSET ] += 1;
-            eventMapProbs[ idx ] = 0.0;
- 
-#ifdef DEBUG_DEC
-            std::cout << "Narrow sympatry\n";
-            std::cout << "A " << bitsToState(statesToBitsByNumOn[i]) << " " << bitsToString(statesToBitsByNumOn[i]) << "\n";
-            std::cout << "L " << bitsToState(statesToBitsByNumOn[i]) << " " << bitsToString(statesToBitsByNumOn[i]) << "\n";
-            std::cout << "R " << bitsToState(statesToBitsByNumOn[i]) << " " << bitsToString(statesToBitsByNumOn[i]) << "\n\n";
-#endif
-
+            addEvent(event_types, r, i, i, i, BiogeographicCladoEvent::SYMPATRY_SUBSET);
         }
         
         // subset/widespread sympatry
-        else if (sumBits(ba) > 1)
+        else if (maskSizes[ba] > 1)
         {
-            idx[1] = i;
-            idx[2] = i;
-            if (beforeRanges.find(i) == beforeRanges.end())
+            
+            if (use_sympatry_widespread == true)
             {
-                continue;
+                addEvent(event_types, r, i, i, i, BiogeographicCladoEvent::SYMPATRY_WIDESPREAD);
             }
             
-            
-            if (eventStringToStateMap.find("f") != eventStringToStateMap.end()) {
-                eventMapTypes[ idx ] = BiogeographicCladoEvent::SYMPATRY_WIDESPREAD;
-                eventMapCounts[ i ][  BiogeographicCladoEvent::SYMPATRY_WIDESPREAD ] += 1;
-                eventMapProbs[ idx ] = 0.0;
-            
-#ifdef DEBUG_DEC
-                std::cout << "Widespread sympatry\n";
-                std::cout << "A " << bitsToState(statesToBitsByNumOn[i]) << " " << bitsToString(statesToBitsByNumOn[i]) << "\n";
-                std::cout << "L " << bitsToState(statesToBitsByNumOn[i]) << " " << bitsToString(statesToBitsByNumOn[i]) << "\n";
-                std::cout << "R " << bitsToState(statesToBitsByNumOn[i]) << " " << bitsToString(statesToBitsByNumOn[i]) << "\n\n";
-#endif
-            }
-            if (eventStringToStateMap.find("s") != eventStringToStateMap.end()) {
-                
-#ifdef DEBUG_DEC
-                std::cout << "Subset sympatry (L-trunk, R-bud)\n";
-#endif
-                
-                // get set of possible sympatric events for L-trunk, R-bud
-                for (size_t j = 0; j < on.size(); j++)
+            if (use_sympatry_subset == true)
+            {
+                // the bud inherits a single area of the ancestral range, either for the right (L-trunk) or the left (R-trunk) daughter
+                for (unsigned rest = ba; rest != 0; rest &= rest - 1)
                 {
-                    br = std::vector<unsigned>(numCharacters, 0);
-                    br[ on[j] ] = 1;
-    //                unsigned sr = bitsToState(br);
-                    unsigned sr = bitsToStatesByNumOn[br];
-                    idx[1] = i;
-                    idx[2] = sr;
-                    
-                    if (beforeRanges.find(sr) == beforeRanges.end())
+                    unsigned bud = rest & (~rest + 1);
+                    if (beforeRangeMasks[bud] == true)
                     {
-                        br[ on[j] ] = 0;
-                        continue;
+                        addEvent(event_types, r, i, i, masksToStates[bud], BiogeographicCladoEvent::SYMPATRY_SUBSET);
                     }
-                    
-                    
-                    eventMapTypes[ idx ] = BiogeographicCladoEvent::SYMPATRY_SUBSET;
-                    eventMapCounts[ i ][  BiogeographicCladoEvent::SYMPATRY_SUBSET ] += 1;
-                    eventMapProbs[ idx ] = 0.0;
-                
-#ifdef DEBUG_DEC
-                    std::cout << "A " << bitsToState(statesToBitsByNumOn[i]) << " " << bitsToString(statesToBitsByNumOn[i]) << "\n";
-                    std::cout << "L " << bitsToState(statesToBitsByNumOn[i]) << " " << bitsToString(statesToBitsByNumOn[i]) << "\n";
-                    std::cout << "R " << bitsToState(br) << " " << bitsToString(br) << "\n\n";
-#endif
-                
-                    br[ on[j] ] = 0;
                 }
-
-        
-#ifdef DEBUG_DEC
-                std::cout << "Subset sympatry (L-bud, R-trunk)\n";
-#endif
-            
-                // get set of possible sympatric events for R-trunk, L-bud
-                for (size_t j = 0; j < on.size(); j++)
+                for (unsigned rest = ba; rest != 0; rest &= rest - 1)
                 {
-                    bl = std::vector<unsigned>(numCharacters, 0);
-        
-                    bl[ on[j] ] = 1;
-    //                unsigned sl = bitsToState(bl);
-                    unsigned sl = bitsToStatesByNumOn[bl];
-                    idx[1] = sl;
-                    idx[2] = i;
-                    
-                    if (beforeRanges.find(sl) == beforeRanges.end())
+                    unsigned bud = rest & (~rest + 1);
+                    if (beforeRangeMasks[bud] == true)
                     {
-                        bl[ on[j] ] = 0;
-                        continue;
+                        addEvent(event_types, r, i, masksToStates[bud], i, BiogeographicCladoEvent::SYMPATRY_SUBSET);
                     }
-                    
-                    eventMapTypes[ idx ] =  BiogeographicCladoEvent::SYMPATRY_SUBSET;
-                    eventMapCounts[ i ][  BiogeographicCladoEvent::SYMPATRY_SUBSET ] += 1;
-                    eventMapProbs[ idx ] = 0.0;
-             
-#ifdef DEBUG_DEC
-                    std::cout << "A " << bitsToState(statesToBitsByNumOn[i]) << " "<< bitsToString(statesToBitsByNumOn[i]) << "\n";
-                    std::cout << "L " << bitsToState(bl) << " "<< bitsToString(bl) << "\n";
-                    std::cout << "R " << bitsToState(statesToBitsByNumOn[i]) << " " << bitsToString(statesToBitsByNumOn[i]) << "\n\n";
-#endif
-                
-                    bl[ on[j] ] = 0;
                 }
             }
             
-            
-            if (eventStringToStateMap.find("a") != eventStringToStateMap.end()) {
-            
-                // get set of possible allopatry events
-                bl = ba;
-                std::vector<std::vector<unsigned> > bc;
-                bitCombinations(bc, ba, 0, std::vector<unsigned>());
-
-#ifdef DEBUG_DEC
-                std::cout << "Allopatry combinations\n";
-                std::cout << "A " << bitsToState(ba) << " " << bitsToString(ba) << "\n";
-#endif
-                
-                for (size_t j = 0; j < bc.size(); j++)
+            // one daughter lineage must be contained within the vicariance range set
+            if (use_allopatry == true && (useVicariance == false || afterRangeMasks[ba] == false))
+            {
+                // the left daughter inherits a non-empty proper subset of the ancestral range, and the right daughter the complement
+                for (unsigned bl = (ba - 1) & ba; bl != 0; bl = (bl - 1) & ba)
                 {
-                    
-                    bl = bc[j];
-                    br = bitAllopatryComplement(ba, bl);
-                    
-                    if (sumBits(bl)==1 || sumBits(br)==1 || wideAllopatry)
+                    unsigned br = ba & ~bl;
+                    if (maskSizes[bl] == 1 || maskSizes[br] == 1 || wideAllopatry)
                     {
-                        
-    //                    unsigned sl = bitsToState(bl);
-    //                    unsigned sr = bitsToState(br);
-                        unsigned sa = bitsToStatesByNumOn[ba];
-                        unsigned sl = bitsToStatesByNumOn[bl];
-                        unsigned sr = bitsToStatesByNumOn[br];
-                        idx[1] = sl;
-                        idx[2] = sr;
-                        
-    //                    if (beforeRanges.find(sl) == beforeRanges.end() || beforeRanges.find(sr) == beforeRanges.end())
-    //                    {
-    //                        continue;
-    //                    }
-                        
-//                        std::cout << sa << " -> " << sl << " | " << sr << "\n";
-//                        std::cout << idx[0] << " -> " << idx[1] << " | " << idx[2] << "\n";
-                        
-                        // one daughter lineage must be contained within the vicariance range set
-                        if (useVicariance)
-                        {
-//                            if (afterRanges.find(sl) != afterRanges.end() && afterRanges.find(sr) != afterRanges.end()) {
-    //                            std::cout << sl << " " << sr << "\n";
-    //                            for (std::set<unsigned>::iterator it_after = afterRanges.begin(); it_after != afterRanges.end(); it_after++)
-    //                                std::cout << *it_after << "\n";
-                            if (afterRanges.find(sa) != afterRanges.end())
-//                                (afterRanges.find(sr) == afterRanges.end() ||
-//                                 afterRanges.find(sl) == afterRanges.end()))
-                            {
-                                continue;
-                            }
-                        }
-
-#ifdef DEBUG_DEC
-                        std::cout << "L " << bitsToState(bl) << " " << bitsToString(bl) << "\n";
-                        std::cout << "R " << bitsToState(br) << " " << bitsToString(br) << "\n";
-#endif
-
-                    
-                        eventMapTypes[ idx ] = BiogeographicCladoEvent::ALLOPATRY;
-                        eventMapCounts[ i ][  BiogeographicCladoEvent::ALLOPATRY ] += 1;
-                        eventMapProbs[ idx ] = 0.0;
-
-#ifdef DEBUG_DEC
-                        std::cout << "\n";
-#endif
+                        addEvent(event_types, r, i, masksToStates[bl], masksToStates[br], BiogeographicCladoEvent::ALLOPATRY);
                     }
                 }
             }
         }
         
         // jump dispersal
-        if (eventStringToStateMap.find("j") != eventStringToStateMap.end()) {
-            
-#ifdef DEBUG_DEC
-            std::cout << "Jump dispersal (L-trunk, R-bud)\n";
-#endif
-            
-            // get set of possible jump dispersal events for L-trunk, R-bud
-            for (size_t j = 0; j < off.size(); j++)
+        if (use_jump_dispersal == true)
+        {
+            // the bud jumps to a single area outside of the ancestral range, either for the right (L-trunk) or the left (R-trunk) daughter
+            unsigned off = all_areas & ~ba;
+            for (unsigned rest = off; rest != 0; rest &= rest - 1)
             {
-                br = std::vector<unsigned>(numCharacters, 0);
-                br[ off[j] ] = 1;
-                //                unsigned sr = bitsToState(br);
-                unsigned sr = bitsToStatesByNumOn[br];
-                idx[1] = i;
-                idx[2] = sr;
-                
-                if (beforeRanges.find(sr) == beforeRanges.end())
+                unsigned bud = rest & (~rest + 1);
+                if (beforeRangeMasks[bud] == true)
                 {
-                    br[ off[j] ] = 0;
-                    continue;
+                    addEvent(event_types, r, i, i, masksToStates[bud], BiogeographicCladoEvent::JUMP_DISPERSAL);
                 }
-                
-                
-                eventMapTypes[ idx ] = BiogeographicCladoEvent::JUMP_DISPERSAL;
-                eventMapCounts[ i ][  BiogeographicCladoEvent::JUMP_DISPERSAL ] += 1;
-                eventMapProbs[ idx ] = 0.0;
-                
-#ifdef DEBUG_DEC
-                std::cout << "A " << bitsToState(statesToBitsByNumOn[i]) << " " << bitsToString(statesToBitsByNumOn[i]) << "\n";
-                std::cout << "L " << bitsToState(statesToBitsByNumOn[i]) << " " << bitsToString(statesToBitsByNumOn[i]) << "\n";
-                std::cout << "R " << bitsToState(br) << " " << bitsToString(br) << "\n\n";
-#endif
-                
-                br[ off[j] ] = 0;
             }
-            
-            
-#ifdef DEBUG_DEC
-            std::cout << "Jump dispersal (L-bud, R-trunk)\n";
-#endif
-            
-            // get set of possible jump dispersal events for R-trunk, L-bud
-            for (size_t j = 0; j < off.size(); j++)
+            for (unsigned rest = off; rest != 0; rest &= rest - 1)
             {
-                bl = std::vector<unsigned>(numCharacters, 0);
-                
-                bl[ off[j] ] = 1;
-                //                unsigned sl = bitsToState(bl);
-                unsigned sl = bitsToStatesByNumOn[bl];
-                idx[1] = sl;
-                idx[2] = i;
-                
-                if (beforeRanges.find(sl) == beforeRanges.end())
+                unsigned bud = rest & (~rest + 1);
+                if (beforeRangeMasks[bud] == true)
                 {
-                    bl[ off[j] ] = 0;
-                    continue;
+                    addEvent(event_types, r, i, masksToStates[bud], i, BiogeographicCladoEvent::JUMP_DISPERSAL);
                 }
-                
-                eventMapTypes[ idx ] =  BiogeographicCladoEvent::JUMP_DISPERSAL;
-                eventMapCounts[ i ][  BiogeographicCladoEvent::JUMP_DISPERSAL ] += 1;
-                eventMapProbs[ idx ] = 0.0;
-                
-#ifdef DEBUG_DEC
-                std::cout << "A " << bitsToState(statesToBitsByNumOn[i]) << " "<< bitsToString(statesToBitsByNumOn[i]) << "\n";
-                std::cout << "L " << bitsToState(bl) << " "<< bitsToString(bl) << "\n";
-                std::cout << "R " << bitsToState(statesToBitsByNumOn[i]) << " " << bitsToString(statesToBitsByNumOn[i]) << "\n\n";
-#endif
-                
-                bl[ off[j] ] = 0;
             }
         }
-#ifdef DEBUG_DEC
-        std::cout << "\n\n";
-#endif
     }
-#ifdef DEBUG_DEC
-//    for (size_t i = 0; i < eventMapCounts.size(); i++) {
-//        std::cout << bitsToState(statesToBitsByNumOn[i]) << " " << eventMapCounts[ i ] << "\n";
-//    }
-//    
-    std::cout << "------\n";
-#endif
-}
-
-void DECCladogeneticStateFunction::buildRanges(std::set<unsigned>& range_set, const TypedDagNode< RbVector<RbVector<double> > >* g, bool all)
-{
     
-    std::set<std::set<unsigned> > r;
-    for (size_t i = 0; i < numCharacters; i++)
+    // flatten the events (in the order of the event map), so that update() only needs to fill in the probabilities
+    std::vector<size_t> range_indices( numIntStates, 0 );
+    for (size_t r = 0; r < beforeRanges.size(); r++)
     {
-        std::set<unsigned> s;
-        s.insert((unsigned)i);
-        r.insert(s);
-        buildRangesRecursively(s, r, maxRangeSize, g, all);
+        range_indices[ beforeRanges[r] ] = r;
     }
     
-    for (std::set<std::set<unsigned> >::iterator it = r.begin(); it != r.end(); it++)
+    eventMapProbs.clear();
+    eventClasses.clear();
+    eventRanges.clear();
+    for (std::map<std::vector<unsigned>, unsigned>::iterator it = event_types.begin(); it != event_types.end(); it++)
     {
-        std::vector<unsigned> v(numCharacters, 0);
-        for (std::set<unsigned>::iterator jt = it->begin(); jt != it->end(); jt++)
-        {
-            v[*jt] = 1;
-        }
-        range_set.insert( bitsToStatesByNumOn[v] );
+        eventMapProbs.insert( eventMapProbs.end(), std::pair<std::vector<unsigned>, double>(it->first, 0.0) );
+        eventClasses.push_back( it->second );
+        eventRanges.push_back( range_indices[ it->first[0] ] );
     }
-
-#ifdef DEBUG_DEC
-    for (std::set<std::set<unsigned> >::iterator it = r.begin(); it != r.end(); it++)
-    {
-        for (std::set<unsigned>::iterator jt = it->begin(); jt != it->end(); jt++)
-        {
-            std::cout << *jt << " ";
-        }
-        std::cout << "\n";
-    }
-    std::cout << "\n";
-#endif
+    
 }
 
-void DECCladogeneticStateFunction::buildRangesRecursively(std::set<unsigned> s, std::set<std::set<unsigned> >& r, size_t k, const TypedDagNode< RbVector<RbVector<double> > >* g, bool all)
+
+/**
+ * Collect all ranges of up to maxRangeSize areas that can be built by adding areas connected in the graph.
+ * The ranges are marked by their bitmask.
+ */
+void DECCladogeneticStateFunction::buildRanges(std::vector<bool>& range_masks, const TypedDagNode< RbVector<RbVector<double> > >* g, bool all)
 {
     
-    // add candidate range to list of ranges
-    if (s.size() <= k)
-        r.insert(s);
+    const RbVector<RbVector<double> >& graph = g->getValue();
     
-    // stop recursing if range equals max size, k
-    if (s.size() == k)
-        return;
+    // the areas connected to each area
+    std::vector<unsigned> neighbors(numCharacters, 0);
+    for (size_t i = 0; i < numCharacters; i++)
+    {
+        for (size_t j = 0; j < numCharacters; j++)
+        {
+            if (graph[i][j] > 0 || all)
+            {
+                neighbors[i] |= (1u << j);
+            }
+        }
+    }
     
+    // grow the ranges from the single areas
+    range_masks = std::vector<bool>(numIntStates, false);
+    std::vector<unsigned> unvisited;
+    for (size_t i = 0; i < numCharacters; i++)
+    {
+        range_masks[ 1u << i ] = true;
+        unvisited.push_back( 1u << i );
+    }
     
-    // otherwise, recurse along
-    for (std::set<unsigned>::iterator it = s.begin(); it != s.end(); it++)
+    while ( unvisited.empty() == false )
     {
+        unsigned m = unvisited.back();
+        unvisited.pop_back();
+        
+        // stop growing if range equals max size
+        if (maskSizes[m] >= maxRangeSize)
+        {
+            continue;
+        }
+        
+        unsigned reachable = 0;
         for (size_t i = 0; i < numCharacters; i++)
         {
-            if (g->getValue()[*it][i] > 0 || all) {
-                std::set<unsigned> t = s;
-                t.insert((unsigned)i);
-                if (r.find(t) == r.end())
-                {
-                    buildRangesRecursively(t, r, k, g, all);
-                }
+            if (m & (1u << i))
+            {
+                reachable |= neighbors[i];
+            }
+        }
+        
+        for (unsigned rest = reachable & ~m; rest != 0; rest &= rest - 1)
+        {
+            unsigned t = m | (rest & (~rest + 1));
+            if (range_masks[t] == false)
+            {
+                range_masks[t] = true;
+                unvisited.push_back(t);
             }
         }
     }
+    
 }
 
 DECCladogeneticStateFunction* DECCladogeneticStateFunction::clone( void ) const
@@ -943,10 +691,6 @@ const std::vector<std::string>& DECCladogeneticStateFunction::getEventTypes(void
 void DECCladogeneticStateFunction::update( void )
 {
     
-    // tmp
-    std::map<std::vector<unsigned>, unsigned>::iterator it;
-    std::map<std::vector<unsigned>, double> eventMapProbs;
-    
     // get the information from the arguments for reading the file
     const std::vector<double>& ep = eventProbs->getValue();
     
@@ -959,44 +703,41 @@ void DECCladogeneticStateFunction::update( void )
 
     if (numCharacters > MAX_NUM_AREAS) return;
    
+    std::map<std::vector<unsigned>, double>::iterator it = eventMapProbs.begin();
     if (eventProbsAsWeightedAverages)
     {
         // get sum of transition weights per starting state
-        std::vector<double> z_pattern_probs( numRanges, 0.0 );
+        std::vector<double> z_pattern_probs( beforeRanges.size(), 0.0 );
         for (size_t i = 0; i < eventTypes.size(); i++)
         {
             size_t k = eventStringToStateMap[ eventTypes[i] ];
-            for (std::set<unsigned>::iterator its = beforeRanges.begin(); its != beforeRanges.end(); its++)
+            for (size_t r = 0; r < beforeRanges.size(); r++)
             {
-                unsigned j = *its;
-                z_pattern_probs[j] += probs[k] * eventMapCounts[j][k];
+                z_pattern_probs[r] += probs[k] * eventMapCounts[r][k];
             }
         }
-        for (it = eventMapTypes.begin(); it != eventMapTypes.end(); it++)
+        for (size_t e = 0; e < eventClasses.size(); e++, it++)
         {
-            const std::vector<unsigned>& idx = it->first;
-            eventMapProbs[ idx ] = probs[ it->second ] / z_pattern_probs[ idx[0] ];
+            it->second = probs[ eventClasses[e] ] / z_pattern_probs[ eventRanges[e] ];
         }
 
     }
     else
     {
         // get transition probabilities per event class
-        std::vector<double> z_class_probs( numRanges, 0 );
+        std::vector<double> z_class_probs( beforeRanges.size(), 0 );
         for (size_t i = 0; i < eventTypes.size(); i++)
         {
             size_t k = eventStringToStateMap[ eventTypes[i] ];
-            for (std::set<unsigned>::iterator its = beforeRanges.begin(); its != beforeRanges.end(); its++)
+            for (size_t r = 0; r < beforeRanges.size(); r++)
             {
-                unsigned j = *its;
-                z_class_probs[j] += (eventMapCounts[j][k] > 0 ? probs[k] : 0);
+                z_class_probs[r] += (eventMapCounts[r][k] > 0 ? probs[k] : 0);
             }
         }
        
-        for (it = eventMapTypes.begin(); it != eventMapTypes.end(); it++)
+        for (size_t e = 0; e < eventClasses.size(); e++, it++)
         {
-            const std::vector<unsigned>& idx = it->first;
-            eventMapProbs[ idx ] = probs[ it->second ] / eventMapCounts[ idx[0] ][ it->second ] / z_class_probs[ idx[0] ];
+            it->second = probs[ eventClasses[e] ] / eventMapCounts[ eventRanges[e] ][ eventClasses[e] ] / z_class_probs[ eventRanges[e] ];
         }
     }
     
@@ -5,7 +5,6 @@
 #include <sstream>
 #include <vector>
 #include <map>
-#include <set>
 #include <string>
 
 #include "AbstractCladogenicStateFunction.h"
@@ -58,17 +57,11 @@ template <class valueType> class TypedDagNode;
         
     private:
         
-        void                                                    buildRanges(std::set<unsigned>& range_set, const TypedDagNode< RbVector<RbVector<double> > >* g, bool all=true);
-        void                                                    buildRangesRecursively(std::set<unsigned> s, std::set<std::set<unsigned> >& r, size_t k, const TypedDagNode< RbVector<RbVector<double> > >* g, bool all=true);
-        void                                                    buildBits(void);
+        void                                                    addEvent(std::map<std::vector<unsigned>, unsigned>& event_types, size_t range_index, unsigned ancestor, unsigned left, unsigned right, unsigned type);
+        void                                                    buildRanges(std::vector<bool>& range_masks, const TypedDagNode< RbVector<RbVector<double> > >* g, bool all=true);
+        void                                                    buildMasks(void);
         void                                                    buildEventMap(void);
-        unsigned                                                bitsToState( const std::vector<unsigned>& b );
-        std::string                                             bitsToString( const std::vector<unsigned>& b );
-        std::vector<unsigned>                                   bitAllopatryComplement( const std::vector<unsigned>& mask, const std::vector<unsigned>& base );
-        void                                                    bitCombinations(std::vector<std::vector<unsigned> >& comb, std::vector<unsigned> array, int i, std::vector<unsigned> accum);
         size_t                                                  computeNumStates(size_t numAreas, size_t maxRangeSize);
-        unsigned                                                sumBits(const std::vector<unsigned>& b);
-        void                                                    updateProbs(void);
         
         // members
         const TypedDagNode< Simplex >*                          eventProbs;
@@ -81,24 +74,25 @@ template <class valueType> class TypedDagNode;
         unsigned                                                numEventTypes;
         unsigned                                                maxRangeSize;
        
-        // range codes
-        std::vector<std::vector<unsigned> >                     bits;
-        std::map<std::vector<unsigned>, unsigned>               inverseBits;
-        std::vector<std::vector<std::vector<unsigned> > >       bitsByNumOn;
-        std::vector<std::vector<unsigned> >                     statesToBitsByNumOn;
-        std::map< std::vector<unsigned>, unsigned>              bitsToStatesByNumOn;
+        // range codes (bit i of a range mask is set if the range contains area i)
+        std::vector<unsigned>                                   maskSizes;                                  //!< The number of areas of each range mask
+        std::vector<unsigned>                                   statesToMasks;                              //!< The range mask of each state, sorted by the number of areas
+        std::vector<unsigned>                                   masksToStates;                              //!< The state of each range mask
 
-        // range events: types, probs, and counts
-        std::map< std::vector<unsigned>, unsigned >             eventMapTypes;
-        std::map< unsigned, std::vector<unsigned> >             eventMapCounts;
+        // range events: types, probs, and counts (the types and ancestral ranges in the order of the event map)
+        std::map< std::vector<unsigned>, double >               eventMapProbs;
+        std::vector<unsigned>                                   eventClasses;
+        std::vector<size_t>                                     eventRanges;
+        std::vector<std::vector<unsigned> >                     eventMapCounts;                             //!< The number of events of each type per ancestral range
 
         // manages simplex over event type probabilities
         std::vector<std::string>                                eventTypes;
         std::map<std::string, unsigned>                         eventStringToStateMap;
         
         // manage ranges under connectivity graph
-        std::set<unsigned>                                      beforeRanges;
-        std::set<unsigned>                                      afterRanges;
+        std::vector<unsigned>                                   beforeRanges;                               //!< The states of the ranges supported by the connectivity graph
+        std::vector<bool>                                       beforeRangeMasks;
+        std::vector<bool>                                       afterRangeMasks;
         
         bool                                                    eventProbsAsWeightedAverages;
         bool                                                    wideAllopatry;
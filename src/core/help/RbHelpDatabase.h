@@ -3,47 +3,77 @@
 
 #include "RbHelpReference.h"
 
+#include <cstddef>
 #include <map>
 #include <string>
 #include <vector>
 
 namespace RevBayesCore {
-    
-    
+
+
     /**
      * \brief The database of strings and references for insertion into help entry objects
      *
+     * The help corpus is generated from help/md by help/md2help.pl into static, read-only
+     * tables (RbHelpDatabase.cpp) that are sorted by entry name and key. These tables need
+     * no construction at startup. We only look up the entries that are actually requested
+     * and keep the materialized strings, so that we can hand out references to them.
+     *
      * \copyright (c) Copyright 2009-2013 (GPL version 3)
      * \author The RevBayes Development Core Team (Johan Dunfalk & Sebastian Hoehna)
      * \since Version 1.0, 2014-09-15
      *
      */
     class RbHelpDatabase {
-        
+
     public:
-        RbHelpDatabase();
-        
+
+        /** A help string, or one item of a help array, as stored in the generated tables */
+        struct HelpField {
+            const char*                      name;
+            const char*                      key;
+            const char*                      value;
+        };
+
+        /** A reference, as stored in the generated tables */
+        struct HelpReference {
+            const char*                      name;
+            const char*                      citation;
+            const char*                      doi;
+            const char*                      url;
+        };
+
         // getter
-        const std::string&                   getHelpString(std::string name, std::string key) { return help_strings[name][key]; }
-        const std::vector<std::string>&      getHelpStringVector(std::string name, std::string key) { return help_arrays[name][key]; }
-        const std::vector<RbHelpReference>&  getHelpReferences(std::string name) { return help_references[name]; }
-        
+        const std::string&                   getHelpString(const std::string &name, const std::string &key);
+        const std::vector<std::string>&      getHelpStringVector(const std::string &name, const std::string &key);
+        const std::vector<RbHelpReference>&  getHelpReferences(const std::string &name);
+
         static RbHelpDatabase&               getHelpDatabase(void)
         {
             static RbHelpDatabase globalHelpInstance = RbHelpDatabase();
             return globalHelpInstance;
         }
 
-        
+
     private:
-        
+        RbHelpDatabase(void) {}
+
+        // the generated tables, sorted by name and then by key
+        static const HelpField                                                          help_string_table[];
+        static const size_t                                                             help_string_table_size;
+        static const HelpField                                                          help_array_table[];
+        static const size_t                                                             help_array_table_size;
+        static const HelpReference                                                      help_reference_table[];
+        static const size_t                                                             help_reference_table_size;
+
+        // the entries we have looked up so far
         std::map< std::string, std::map< std::string, std::string> >                   help_strings;
         std::map< std::string, std::map< std::string, std::vector<std::string> > >     help_arrays;
         std::map< std::string, std::vector<RbHelpReference> >                          help_references;
-        
+
     };
-    
-    
+
+
 }
 
 #endif
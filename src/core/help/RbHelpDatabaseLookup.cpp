@@ -0,0 +1,124 @@
+#include <algorithm>
+#include <cstring>
+#include <utility>
+
+#include "RbHelpDatabase.h"
+
+using namespace RevBayesCore;
+
+
+namespace {
+
+    /** The name and key we are looking for in the generated tables */
+    struct HelpFieldKey {
+        const std::string&  name;
+        const std::string&  key;
+    };
+
+
+    /** Compare a row of a generated table with a name and key, in the same way as strcmp */
+    int compareHelpField(const RbHelpDatabase::HelpField &f, const HelpFieldKey &k)
+    {
+        int c = std::strcmp( f.name, k.name.c_str() );
+
+        return ( c != 0 ? c : std::strcmp( f.key, k.key.c_str() ) );
+    }
+
+
+    /** Ordering of the generated help strings and arrays, which are sorted by name and then by key */
+    struct HelpFieldOrder {
+        bool operator()(const RbHelpDatabase::HelpField &f, const HelpFieldKey &k) const { return compareHelpField(f, k) < 0; }
+        bool operator()(const HelpFieldKey &k, const RbHelpDatabase::HelpField &f) const { return compareHelpField(f, k) > 0; }
+    };
+
+
+    /** Ordering of the generated references, which are sorted by name */
+    struct HelpReferenceOrder {
+        bool operator()(const RbHelpDatabase::HelpReference &r, const std::string &n) const { return std::strcmp( r.name, n.c_str() ) < 0; }
+        bool operator()(const std::string &n, const RbHelpDatabase::HelpReference &r) const { return std::strcmp( r.name, n.c_str() ) > 0; }
+    };
+
+}
+
+
+/**
+ * Get the help string for the given name and key. We look up the string in the generated
+ * table the first time it is requested. Missing entries are empty strings.
+ */
+const std::string& RbHelpDatabase::getHelpString(const std::string &name, const std::string &key)
+{
+
+    std::map<std::string, std::string>& entry = help_strings[name];
+    std::map<std::string, std::string>::iterator it = entry.find( key );
+
+    if ( it == entry.end() )
+    {
+        HelpFieldKey k = { name, key };
+        const HelpField* end = help_string_table + help_string_table_size;
+        const HelpField* f = std::lower_bound( help_string_table, end, k, HelpFieldOrder() );
+
+        std::string value = "";
+        if ( f != end && compareHelpField( *f, k ) == 0 )
+        {
+            value = f->value;
+        }
+
+        it = entry.insert( std::make_pair( key, value ) ).first;
+    }
+
+    return it->second;
+}
+
+
+/**
+ * Get the help array (e.g. the authors) for the given name and key. We collect the items
+ * from the generated table the first time the array is requested.
+ */
+const std::vector<std::string>& RbHelpDatabase::getHelpStringVector(const std::string &name, const std::string &key)
+{
+
+    std::map<std::string, std::vector<std::string> >& entry = help_arrays[name];
+    std::map<std::string, std::vector<std::string> >::iterator it = entry.find( key );
+
+    if ( it == entry.end() )
+    {
+        HelpFieldKey k = { name, key };
+        std::pair<const HelpField*, const HelpField*> range = std::equal_range( help_array_table, help_array_table + help_array_table_size, k, HelpFieldOrder() );
+
+        std::vector<std::string> values;
+        for (const HelpField* f = range.first; f != range.second; ++f)
+        {
+            values.push_back( f->value );
+        }
+
+        it = entry.insert( std::make_pair( key, values ) ).first;
+    }
+
+    return it->second;
+}
+
+
+/**
+ * Get the references for the given name. We collect the references from the generated
+ * table the first time they are requested.
+ */
+const std::vector<RbHelpReference>& RbHelpDatabase::getHelpReferences(const std::string &name)
+{
+
+    std::map<std::string, std::vector<RbHelpReference> >::iterator it = help_references.find( name );
+
+    if ( it == help_references.end() )
+    {
+        std::pair<const HelpReference*, const HelpReference*> range = std::equal_range( help_reference_table, help_reference_table + help_reference_table_size, name, HelpReferenceOrder() );
+
+        std::vector<RbHelpReference> values;
+        for (const HelpReference* r = range.first; r != range.second; ++r)
+        {
+            values.push_back( RbHelpReference( r->citation, r->doi, r->url ) );
+        }
+
+        it = help_references.insert( std::make_pair( name, values ) ).first;
+    }
+
+    return it->second;
+}
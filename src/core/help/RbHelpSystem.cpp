@@ -29,7 +29,8 @@ RbHelpSystem::RbHelpSystem( const RbHelpSystem &hs) :
     helpForMethods( hs.helpForMethods ),
     helpForTypes(  ),
     helpFunctionNames( hs.helpFunctionNames ),
-    helpTypeNames( hs.helpTypeNames )
+    helpTypeNames( hs.helpTypeNames ),
+    pendingEntries( hs.pendingEntries )
 {
     
     
@@ -75,6 +76,7 @@ RbHelpSystem& RbHelpSystem::operator=( const RbHelpSystem &hs )
         helpForFunctions    = hs.helpForFunctions;
         helpTypeNames       = hs.helpTypeNames;
         helpForMethods      = hs.helpForMethods;
+        pendingEntries      = hs.pendingEntries;
         
         for ( std::map<std::string, RbHelpType*>::const_iterator it = hs.helpForTypes.begin(); it != hs.helpForTypes.end(); ++it)
         {
@@ -87,6 +89,58 @@ RbHelpSystem& RbHelpSystem::operator=( const RbHelpSystem &hs )
 
 
 void RbHelpSystem::addHelpDistribution( RbHelpDistribution *h)
+{
+    
+    insertHelpDistribution( h );
+    
+}
+
+
+void RbHelpSystem::addHelpDistribution( const std::function<RbHelpDistribution*(void)> &h )
+{
+    
+    pendingEntries.push_back( [h](const RbHelpSystem& hs) { hs.insertHelpDistribution( h() ); } );
+    
+}
+
+
+void RbHelpSystem::addHelpFunction( RbHelpFunction *h )
+{
+    
+    insertHelpFunction( h );
+    
+}
+
+
+void RbHelpSystem::addHelpFunction( const std::function<RbHelpFunction*(void)> &h )
+{
+    
+    pendingEntries.push_back( [h](const RbHelpSystem& hs) { hs.insertHelpFunction( h() ); } );
+    
+}
+
+
+void RbHelpSystem::addHelpType( RbHelpType *h )
+{
+    
+    insertHelpType( h );
+    
+}
+
+
+void RbHelpSystem::addHelpType( const std::function<RbHelpType*(void)> &h )
+{
+    
+    pendingEntries.push_back( [h](const RbHelpSystem& hs) { hs.insertHelpType( h() ); } );
+    
+}
+
+
+/**
+ * Add the entry of a distribution. The tables are a cache of the pending entries,
+ * so we may add to them when the help system is queried through a const reference.
+ */
+void RbHelpSystem::insertHelpDistribution( RbHelpDistribution *h) const
 {
     
 //    helpForFunctions.insert( std::pair<std::string,RbHelpFunction>( h.getName() , h) );
@@ -138,7 +192,7 @@ void RbHelpSystem::addHelpDistribution( RbHelpDistribution *h)
 }
 
 
-void RbHelpSystem::addHelpFunction( RbHelpFunction *h )
+void RbHelpSystem::insertHelpFunction( RbHelpFunction *h ) const
 {
     
     if ( h != NULL )
@@ -158,9 +212,7 @@ void RbHelpSystem::addHelpFunction( RbHelpFunction *h )
 }
 
 
-
-
-void RbHelpSystem::addHelpType( RbHelpType *h )
+void RbHelpSystem::insertHelpType( RbHelpType *h ) const
 {
     
     
@@ -199,8 +251,32 @@ void RbHelpSystem::addHelpType( RbHelpType *h )
 }
 
 
+/**
+ * Construct the entries that were added lazily. We keep the order in which they
+ * were added, because the first entry added under a name is the one that is used.
+ */
+void RbHelpSystem::constructPendingEntries( void ) const
+{
+    
+    // move the pending entries out first, in case constructing an entry adds new ones
+    while ( pendingEntries.empty() == false )
+    {
+        std::vector< std::function<void(const RbHelpSystem&)> > entries;
+        entries.swap( pendingEntries );
+        
+        for (std::vector< std::function<void(const RbHelpSystem&)> >::const_iterator it = entries.begin(); it != entries.end(); ++it)
+        {
+            (*it)( *this );
+        }
+    }
+    
+}
+
+
 const std::set<std::string>& RbHelpSystem::getFunctionEntries( void ) const
 {
+    constructPendingEntries();
+    
     // return a constant reference to the internal value
     return helpFunctionNames;
 }
@@ -208,6 +284,8 @@ const std::set<std::string>& RbHelpSystem::getFunctionEntries( void ) const
 
 const std::set<std::string>& RbHelpSystem::getTypeEntries( void ) const
 {
+    constructPendingEntries();
+    
     // return a constant reference to the internal value
     return helpTypeNames;
 }
@@ -217,6 +295,8 @@ const std::set<std::string>& RbHelpSystem::getTypeEntries( void ) const
 const RbHelpEntry& RbHelpSystem::getHelp(const std::string &qs)
 {
     
+    constructPendingEntries();
+    
     std::map<std::string, RbHelpFunction>::iterator itFunction = helpForFunctions.find( qs );
     std::map<std::string, RbHelpType*>::iterator itType = helpForTypes.find( qs );
     if ( itFunction != helpForFunctions.end() )
@@ -239,6 +319,8 @@ const RbHelpEntry& RbHelpSystem::getHelp(const std::string &qs)
 const RbHelpEntry& RbHelpSystem::getHelp(const std::string &baseQuery, const std::string &qs)
 {
     
+    constructPendingEntries();
+    
     // find the corresponding base type
     std::map<std::string, std::map<std::string, RbHelpFunction> >::iterator itMethods = helpForMethods.find( baseQuery );
     if ( itMethods != helpForMethods.end() )
@@ -337,6 +419,8 @@ void RbHelpSystem::addHelpEntry( void )
 
 bool RbHelpSystem::isHelpAvailableForQuery(const std::string &query)
 {
+    constructPendingEntries();
+    
     // test if we have a help entry for this query string
     return helpForFunctions.find( query ) != helpForFunctions.end() || helpForTypes.find( query ) != helpForTypes.end();
 }
@@ -344,6 +428,8 @@ bool RbHelpSystem::isHelpAvailableForQuery(const std::string &query)
 
 bool RbHelpSystem::isHelpAvailableForQuery(const std::string &baseQuery, const std::string &query)
 {
+    constructPendingEntries();
+    
     // test if we have a help entry for this query string
     return helpForTypes.find( baseQuery ) != helpForTypes.end();
 }
@@ -6,9 +6,11 @@
 #include "RbHelpFunction.h"
 #include "RbHelpType.h"
 
+#include <functional>
 #include <set>
 #include <string>
 #include <map>
+#include <vector>
 
 namespace RevBayesCore {
     
@@ -19,6 +21,11 @@ namespace RevBayesCore {
      * Our help system consists of several xml-files. Here we load in the files.
      * The help system will provide access to other classes to the help documentation.
      *
+     * Constructing the help entries of all functions and types is costly, and most runs
+     * never ask for help. Entries can therefore be added as functions that construct them.
+     * These are only called, in the order in which they were added, when the help system
+     * is first queried.
+     *
      * \copyright (c) Copyright 2009-2013 (GPL version 3)
      * \author The RevBayes Development Core Team (Johan Dunfalk & Sebastian Hoehna)
      * \since Version 1.0, 2014-09-15
@@ -32,8 +39,11 @@ namespace RevBayesCore {
         
         void                                        addHelpEntry( void );
         void                                        addHelpDistribution( RbHelpDistribution *h );
+        void                                        addHelpDistribution( const std::function<RbHelpDistribution*(void)> &h );           //!< Add an entry that is constructed on first use
         void                                        addHelpFunction( RbHelpFunction *h );
+        void                                        addHelpFunction( const std::function<RbHelpFunction*(void)> &h );                   //!< Add an entry that is constructed on first use
         void                                        addHelpType( RbHelpType *h );
+        void                                        addHelpType( const std::function<RbHelpType*(void)> &h );                           //!< Add an entry that is constructed on first use
         const std::set<std::string>&                getFunctionEntries(void) const;
         const std::set<std::string>&                getTypeEntries(void) const;
         const RbHelpEntry&                          getHelp(const std::string &qs);                                         //!< Format the help information for printing to the terminal
@@ -52,11 +62,18 @@ namespace RevBayesCore {
         RbHelpSystem(const RbHelpSystem&);                                                                                  //!< Copy constructor (hidden away as this is a singleton class)
         RbHelpSystem&                               operator=(const RbHelpSystem&);                                         //!< Assignment operator (hidden away as this is a singleton class)
         
-        std::map<std::string, RbHelpFunction>                           helpForFunctions;
-        std::map<std::string, std::map<std::string, RbHelpFunction> >   helpForMethods;
-        std::map<std::string, RbHelpType*>                              helpForTypes;
-        std::set<std::string>                                           helpFunctionNames;                                  //!< Set of finction names without aliases
-        std::set<std::string>                                           helpTypeNames;                                      //!< Set of finction names without aliases
+        void                                        constructPendingEntries(void) const;                                    //!< Construct the entries that were added lazily
+        void                                        insertHelpDistribution( RbHelpDistribution *h ) const;
+        void                                        insertHelpFunction( RbHelpFunction *h ) const;
+        void                                        insertHelpType( RbHelpType *h ) const;
+        
+        // the tables are filled from the pending entries when the help system is first queried
+        mutable std::map<std::string, RbHelpFunction>                           helpForFunctions;
+        mutable std::map<std::string, std::map<std::string, RbHelpFunction> >   helpForMethods;
+        mutable std::map<std::string, RbHelpType*>                              helpForTypes;
+        mutable std::set<std::string>                                           helpFunctionNames;                          //!< Set of finction names without aliases
+        mutable std::set<std::string>                                           helpTypeNames;                              //!< Set of finction names without aliases
+        mutable std::vector< std::function<void(const RbHelpSystem&)> >         pendingEntries;                             //!< Entries that have not been constructed yet
     
     };
     
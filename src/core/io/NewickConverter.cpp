@@ -2,7 +2,8 @@
 
 #include <stdio.h>
 #include <stdlib.h>
-#include <sstream>
+#include <algorithm>
+#include <iterator>
 #include <vector>
 #include <string>
 
@@ -28,37 +29,32 @@ NewickConverter::~NewickConverter()
 Tree* NewickConverter::convertFromNewick(std::string const &n, bool reindex)
 {
 
-    // create and allocate the tree object
-    Tree *t = new Tree();
-
-    std::vector<TopologyNode*> nodes;
-    std::vector<double> brlens;
-
-    // create a string-stream and throw the string into it
-    std::stringstream ss (std::stringstream::in | std::stringstream::out);
-    ss << n;
-
     // ignore white spaces
+    // we only need a copy of the string if there are any
     std::string trimmed = "";
-    char c;
-    while ( ss.good() )
+    const std::string *newick = &n;
+    if ( n.find(' ') != std::string::npos )
     {
-        // check for EOF
-        int c_int = ss.get();
-        if (c_int != EOF)
-        {
-            c = char( c_int );
-            if ( c != ' ')
-            {
-                trimmed += c;
-            }
-
-        }
+        trimmed.reserve( n.size() );
+        std::remove_copy( n.begin(), n.end(), std::back_inserter( trimmed ), ' ' );
+        newick = &trimmed;
+    }
 
+    // the initial character has to be '('
+    if ( newick->empty() == true || (*newick)[0] != '(' )
+    {
+        throw RbException("Error while converting Newick tree. We expected an opening parenthesis, but didn't get one. Problematic string: " + n);
     }
 
+    std::vector<TopologyNode*> nodes;
+    std::vector<double> brlens;
+
     // construct the tree starting from the root
-    TopologyNode *root = createNode( trimmed, nodes, brlens );
+    size_t pos = 0;
+    TopologyNode *root = createNode( *newick, pos, nodes, brlens );
+
+    // create and allocate the tree object
+    Tree *t = new Tree();
 
     // set up the tree
     t->setRoot( root, reindex );
@@ -91,382 +87,171 @@ Tree* NewickConverter::convertFromNewick(std::string const &n, bool reindex)
 }
 
 
-
-TopologyNode* NewickConverter::createNode(const std::string &n, std::vector<TopologyNode*> &nodes, std::vector<double> &brlens) {
-
-    // create a string-stream and throw the string into it
-    std::stringstream ss (std::stringstream::in | std::stringstream::out);
-    ss << n;
-
-    char c = ' ';
-    ss.get(c);
-
-    // the initial character has to be '('
-    if ( c != '(')
-    {
-        throw RbException("Error while converting Newick tree. We expected an opening parenthesis, but didn't get one. Problematic string: " + n);
-    }
+/**
+ * Create the node starting at position pos of the Newick string, together with its subtree.
+ * We parse the string in a single pass without copying any substrings, except for the labels and parameters we store.
+ * When we return, pos points to the first character after the node, i.e., a ',', ')' or ';'.
+ */
+TopologyNode* NewickConverter::createNode(const std::string &n, size_t &pos, std::vector<TopologyNode*> &nodes, std::vector<double> &brlens)
+{
 
     TopologyNode *node = new TopologyNode();
-    while ( ss.good() && ss.peek() != ')' )
-    {
-
-        TopologyNode *childNode;
-        if (ss.peek() == '(' )
-        {
-            // we received an internal node
-            int depth = 0;
-            std::string child = "";
-            do
-            {
-                ss.get(c);
-                child += c;
-                if ( c == '(' )
-                {
-                    depth++;
-                }
-                else if ( c == ')' )
-                {
-                    depth--;
-                }
-
-            } while ( ss.good() && depth > 0 );
-
-            // construct the child node
-            childNode = createNode( child, nodes, brlens );
-        }
-        else
-        {
-            // construct the node
-            childNode = new TopologyNode();
-        }
-
-        // set the parent child relationship
-        node->addChild( childNode );
-        childNode->setParent( node );
 
-        // read the optional label
-        std::string lbl = "";
-        while ( ss.good() && (c = char( ss.peek() ) ) != ':' && c != '[' && c != ';' && c != ',' && c != ')')
-        {
-            lbl += char( ss.get() );
-        }
-        childNode->setName( lbl );
-
-        // read the optional node parameters
-        if ( ss.peek() == '[' )
+    try
+    {
+        // read the children of an internal node
+        if ( pos < n.size() && n[pos] == '(' )
         {
+            // skip the opening parenthesis
+            ++pos;
 
-            do
+            while ( pos < n.size() && n[pos] != ')' )
             {
+                TopologyNode *child_node = createNode( n, pos, nodes, brlens );
 
-                ss.ignore();
-                // ignore the '&' before parameter name
-                if ( ss.peek() == '&')
-                {
-                    ss.ignore();
-                }
-
-                // read the parameter name
-                std::string paramName = "";
-                while ( ss.good() && (c = char( ss.peek() ) ) != '=' && c != ',' && c != ']')
-                {
-                    paramName += char( ss.get() );
-                }
+                // set the parent child relationship
+                node->addChild( child_node );
+                child_node->setParent( node );
 
-                // ignore the equal sign between parameter name and value
-                if ( ss.peek() == '=')
+                // skip comma
+                if ( pos < n.size() && n[pos] == ',' )
                 {
-                    ss.ignore();
+                    ++pos;
                 }
-
-                // read the parameter name
-                std::string paramValue = "";
-                while ( ss.good() && (c = char( ss.peek() ) ) != ']' && c != ',' && c != ':')
+                else if ( pos < n.size() && n[pos] == ';' )
                 {
-                    paramValue += char( ss.get() );
+                    // Avoid infinite loop.
+                    throw RbException()<<"Not enough closing parentheses!";
                 }
+            }
 
-				if (paramName == "index")
-                {
-					// subtract by 1 to correct RevLanguage 1-based indexing
-                    childNode->setIndex( atoi(paramValue.c_str()) - 1 );
-
-                }
-                else if (paramName=="species")
-                {
-                    childNode->setSpeciesName(paramValue);
-				}
-                else
-                {
-                    childNode->addNodeParameter(paramName, paramValue);
-                }
-
-            } while ( (c = char( ss.peek() ) ) == ',' );
-
-            // ignore the final ']'
-            if ( (c = char( ss.peek( ) ) ) == ']' )
+            if ( pos >= n.size() )
             {
-                ss.ignore();
+                throw RbException()<<"Not enough closing parentheses!";
             }
 
-        }
+            // skip the closing parenthesis
+            ++pos;
 
-        // read the optional branch length
-        if ( ss.peek() == ':' )
-        {
-            ss.ignore();
-            std::string time = "";
-            while ( ss.good() && (c = char( ss.peek( ) ) ) != ';' && c != ',' && c != ')' && c != '[' )
+            if ( node->getNumberOfChildren() == 1 )
             {
-                time += char( ss.get() );
+                node->setSampledAncestor( true );
             }
-
-            std::istringstream stm;
-            stm.str(time);
-            double d;
-            stm >> d;
-            nodes.push_back( childNode );
-            brlens.push_back( d );
-        }
-        else
-        {
-            nodes.push_back( childNode );
-            brlens.push_back( 0.0 );
         }
 
-        // read the optional branch parameters
-        if ( char( ss.peek() ) == '[' )
-        {
-
-            do
-            {
-
-                ss.ignore();
-
-                // ignore the '&' before parameter name
-                if ( char( ss.peek() ) == '&')
-                {
-                    ss.ignore();
-                }
-
-                // read the parameter name
-                std::string paramName = "";
-                while ( ss.good() && (c = char( ss.peek() )) != '=' && c != ',')
-                {
-                    paramName += char( ss.get() );
-                }
-
-                // ignore the equal sign between parameter name and value
-                if ( char( ss.peek() ) == '=')
-                {
-                    ss.ignore();
-                }
-
-                // read the parameter name
-                std::string paramValue = "";
-                while ( ss.good() && (c = char( ss.peek() )) != ']' && c != ',' && c != ':')
-                {
-                    paramValue += char( ss.get() );
-                }
-
-                if (paramName=="index")
-                {
-                    // subtract by 1 to correct RevLanguage 1-based indexing
-                    childNode->setIndex( atoi(paramValue.c_str()) - 1 );
-                }
-                else if (paramName=="species")
-                {
-                    childNode->setSpeciesName(paramValue);
-                }
-                else
-                {
-                    childNode->addBranchParameter(paramName, paramValue);
-                }
-
-
-            } while ( (c = char( ss.peek() )) != ']' );
-
-            ss.ignore();
+        // read the optional label
+        node->setName( readToken( n, pos, ":[;,)" ) );
 
+        // read the optional node parameters
+        if ( pos < n.size() && n[pos] == '[' )
+        {
+            readParameters( n, pos, node, false );
         }
 
-
-        // skip comma
-        if ( char( ss.peek() ) == ',' )
+        // read the optional branch length
+        double brlen = 0.0;
+        if ( pos < n.size() && n[pos] == ':' )
         {
-            ss.ignore();
+            ++pos;
+            std::string time = readToken( n, pos, ";,)[" );
+            brlen = atof( time.c_str() );
         }
+        nodes.push_back( node );
+        brlens.push_back( brlen );
 
-        // skip comma
-        if ( char( ss.peek() ) == ';' )
+        // read the optional branch parameters
+        if ( pos < n.size() && n[pos] == '[' )
         {
-            // Avoid infinite loop.
-            throw RbException()<<"Not enough closing parentheses!";
+            readParameters( n, pos, node, true );
         }
     }
-
-    if (node->getNumberOfChildren() == 1)
+    catch (RbException &e)
     {
-        node->setSampledAncestor( true );
+        // the node frees the children we have already attached to it
+        delete node;
+        throw;
     }
 
-    // remove closing parenthesis
-    ss.ignore();
+    return node;
+}
 
-    // read the optional label, checking for EOF = '\377'
-    std::string lbl = "";
-    while ( ss.good() && (c = char( ss.peek() )) != ':' && c != ';' && c != ',' && c != '[' && c != '\377')
-    {
-        lbl += char( ss.get() );
-    }
-    node->setName( lbl );
 
-    // read the optional node parameters
-    if ( char( ss.peek() ) == '[' )
+/**
+ * Read the parameters in brackets, e.g., "[&index=3,rate=0.1]", starting at the opening bracket at position pos.
+ * The index and species parameters are set directly, all others are added as node or branch parameters.
+ */
+void NewickConverter::readParameters(const std::string &n, size_t &pos, TopologyNode *node, bool branch)
+{
+
+    do
     {
+        // skip the opening bracket or the comma
+        ++pos;
 
-        do
+        // ignore the '&' before parameter name
+        if ( pos < n.size() && n[pos] == '&' )
         {
+            ++pos;
+        }
 
-            ss.ignore();
-
-            // ignore the '&' before parameter name
-            if ( char( ss.peek() ) == '&')
-            {
-                ss.ignore();
-            }
-
-            // read the parameter name
-            std::string paramName = "";
-            while ( ss.good() && (c = char( ss.peek() )) != '=' && c != ',')
-            {
-                paramName += char( ss.get() );
-            }
-
-            // ignore the equal sign between parameter name and value
-            if ( char( ss.peek() ) == '=')
-            {
-                ss.ignore();
-            }
-
-            // read the parameter name
-            std::string paramValue = "";
-            while ( ss.good() && (c = char( ss.peek() )) != ']' && c != ',' && c != ':')
-            {
-                paramValue += char( ss.get() );
-            }
-
-			if (paramName=="index")
-            {
-				// subtract by 1 to correct RevLanguage 1-based indexing
-				node->setIndex( atoi(paramValue.c_str()) - 1 );
-
-			}
-            else if (paramName=="species")
-            {
-				node->setSpeciesName(paramValue);
-            }
-            else
-            {
-                node->addNodeParameter(paramName, paramValue);
-            }
-
-
-        } while ( (c = char( ss.peek() )) == ',' );
+        // read the parameter name
+        std::string param_name = readToken( n, pos, "=,]" );
 
-        // ignore the final ']'
-        if ( (c = char( ss.peek() )) == ']' )
+        // ignore the equal sign between parameter name and value
+        if ( pos < n.size() && n[pos] == '=' )
         {
-            ss.ignore();
+            ++pos;
         }
 
-    }
+        // read the parameter value
+        std::string param_value = readToken( n, pos, "],:" );
 
-    // read the optional branch length
-    if ( char( ss.peek() ) == ':' )
-    {
-        ss.ignore();
-        std::string time = "";
-        while ( ss.good() && (c = char( ss.peek() )) != ';' && c != ',' && c != '[' )
+        if ( param_name == "index" )
         {
-            time += char( ss.get() );
+            // subtract by 1 to correct RevLanguage 1-based indexing
+            node->setIndex( atoi(param_value.c_str()) - 1 );
         }
-
-        std::istringstream stm;
-        stm.str(time);
-        double d;
-        stm >> d;
-        nodes.push_back( node );
-        brlens.push_back( d );
-    }
-    else
-    {
-        nodes.push_back( node );
-        brlens.push_back( 0.0 );
-    }
-
-
-
-    // read the optional branch parameters
-    if ( char( ss.peek() ) == '[' )
-    {
-
-        do
+        else if ( param_name == "species" )
         {
+            node->setSpeciesName( param_value );
+        }
+        else if ( branch == true )
+        {
+            node->addBranchParameter( param_name, param_value );
+        }
+        else
+        {
+            node->addNodeParameter( param_name, param_value );
+        }
 
-            ss.ignore();
-
-            // ignore the '&' before parameter name
-            if ( char( ss.peek() ) == '&')
-            {
-                ss.ignore();
-            }
-
-            // read the parameter name
-            std::string paramName = "";
-            while ( ss.good() && (c = char( ss.peek() )) != '=' && c != ',')
-            {
-                paramName += char( ss.get() );
-            }
-
-            // ignore the equal sign between parameter name and value
-            if ( char( ss.peek() ) == '=')
-            {
-                ss.ignore();
-            }
-
-            // read the parameter name
-            std::string paramValue = "";
-            while ( ss.good() && (c = char( ss.peek() )) != ']' && c != ',' && c != ':')
-            {
-                paramValue += char( ss.get() );
-            }
-
-            if (paramName=="index")
-            {
-                // subtract by 1 to correct RevLanguage 1-based indexing
-                node->setIndex( atoi(paramValue.c_str()) - 1 );
+    } while ( pos < n.size() && n[pos] == ',' );
 
-            }
-            else if (paramName=="species")
-            {
-                node->setSpeciesName(paramValue);
-            }
-            else
-            {
-                node->addBranchParameter(paramName, paramValue);
-            }
+    // ignore the final ']'
+    if ( pos < n.size() && n[pos] == ']' )
+    {
+        ++pos;
+    }
 
+}
 
-        } while ( (c = char( ss.peek() )) != ']' );
 
-        ss.ignore();
+/**
+ * Read the token starting at position pos up to (but not including) the first of the stop characters.
+ * Afterwards, pos points to the stop character, or to the end of the string.
+ */
+std::string NewickConverter::readToken(const std::string &n, size_t &pos, const char *stop)
+{
 
+    size_t end = n.find_first_of( stop, pos );
+    if ( end == std::string::npos )
+    {
+        end = n.size();
     }
 
+    std::string token = n.substr( pos, end - pos );
+    pos = end;
 
-    return node;
+    return token;
 }
 
 
@@ -20,8 +20,9 @@
 #define NewickConverter_H
 
 
+#include <cstddef>
+#include <string>
 #include <vector>
-#include <iosfwd>
 
 namespace RevBayesCore {
 
@@ -38,7 +39,9 @@ namespace RevBayesCore {
 //        AdmixtureTree*          getAdmixtureTreeFromNewick(const std::string &n);
 
     private:
-        TopologyNode*           createNode(const std::string &n, std::vector<TopologyNode*> &nodes, std::vector<double> &brlens);
+        TopologyNode*           createNode(const std::string &n, size_t &pos, std::vector<TopologyNode*> &nodes, std::vector<double> &brlens);
+        void                    readParameters(const std::string &n, size_t &pos, TopologyNode *node, bool branch);
+        std::string             readToken(const std::string &n, size_t &pos, const char *stop);
     };
 
 }
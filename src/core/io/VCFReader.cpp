@@ -1,268 +1,290 @@
 #include "DiscreteTaxonData.h"
 #include "VCFReader.h"
-#include "PoMoState4.h"
-#include "PoMoState.h"
-#include "RbFileManager.h"
+#include "RbException.h"
 
-#include "RbConstants.h"
+#include <zlib.h>
 
+#include <algorithm>
+#include <cstring>
 #include <string>
 
 
 using namespace RevBayesCore;
 
 
-VCFReader::VCFReader(const std::string &fn) : DelimitedDataReader(fn)
-{
-    filename = fn;
-    ploidy = DIPLOID;
-}
+namespace {
 
+    /**
+     * Read a file line by line through zlib.
+     * zlib reads uncompressed files as they are and continues over the concatenated
+     * gzip members of bgzip files, so we can read all of them the same way.
+     */
+    class VCFLineReader {
 
-HomologousDiscreteCharacterData<BinaryState>* VCFReader::readBinaryMatrix( void )
-{
-    HomologousDiscreteCharacterData<BinaryState> *matrix = new HomologousDiscreteCharacterData<BinaryState> ();
-    
-    int start = 0;
-    // Skip comments.
-    while ( chars[start][0][0] == '#' )
-    {
-        start = start + 1;
-    }
-    
-    std::vector<std::string> sample_names;
-    size_t samples_start_column = 0;
-    const std::vector<std::string> &format_line = chars[start-1];
-    while ( format_line[samples_start_column] != "FORMAT" )
-    {
-        ++samples_start_column;
-    };
-    ++samples_start_column;
-    for (size_t j = samples_start_column; j < format_line.size(); ++j)
-    {
-        sample_names.push_back( format_line[j] );
-    }
-    size_t NUM_SAMPLES = sample_names.size();
-    std::vector< DiscreteTaxonData<BinaryState> > taxa;
-    if ( ploidy == HAPLOID )
-    {
-        taxa = std::vector< DiscreteTaxonData<BinaryState> >( NUM_SAMPLES, DiscreteTaxonData<BinaryState>( Taxon("") ) );
-        for (size_t i=0; i<NUM_SAMPLES; ++i)
+    public:
+        VCFLineReader(const std::string &fn) : file( gzopen( fn.c_str(), "rb" ) ), file_name( fn )
         {
-            Taxon this_taxon = Taxon( sample_names[i] + "" );
-            taxa[i] = DiscreteTaxonData<BinaryState>( this_taxon );
+            if ( file == NULL )
+            {
+                throw RbException()<<"Could not open file "<<fn;
+            }
+            gzbuffer( file, 1 << 20 );
         }
-    }
-     else if ( ploidy == DIPLOID )
-    {
-        taxa = std::vector< DiscreteTaxonData<BinaryState> >( 2*NUM_SAMPLES, DiscreteTaxonData<BinaryState>( Taxon("") ) );
-        for (size_t i=0; i<NUM_SAMPLES; ++i)
+
+        ~VCFLineReader(void)
         {
-            Taxon this_taxon_A = Taxon( sample_names[i] + "_A" );
-            taxa[i] = DiscreteTaxonData<BinaryState>( this_taxon_A );
-            Taxon this_taxon_B = Taxon( sample_names[i] + "_B" );
-            taxa[i+NUM_SAMPLES] = DiscreteTaxonData<BinaryState>( this_taxon_B );
+            gzclose( file );
         }
-    }
-    else
-    {
-        throw RbException("Currently we have only implementations for haploid and diploid organisms.");
-    }
-    
-    BinaryState missing_state = BinaryState("0");
-    missing_state.setMissingState( true );
-    
-    for (size_t i = start; i < chars.size(); ++i)
-    {
-        
-        for (size_t j = 0; j < NUM_SAMPLES; ++j)
+
+        /** Read the next line, without the line break. Returns false at the end of the file. */
+        bool getLine(std::string &line)
         {
-            
-            const std::string &this_char_read = chars[i][j+samples_start_column];
-            std::vector<std::string> format_tokens;
-            StringUtilities::stringSplit(this_char_read, ":", format_tokens);
-            
-            std::string this_alleles = format_tokens[0];
-            StringUtilities::replaceAllOccurrences(this_alleles, '/', '|');
-            std::vector<std::string> allele_tokens;
-            StringUtilities::stringSplit(this_alleles, "|", allele_tokens);
-            
-            if ( ploidy == DIPLOID )
+            line.clear();
+
+            char buffer[1 << 16];
+            bool read_any = false;
+            while ( gzgets( file, buffer, sizeof(buffer) ) != NULL )
             {
-                // first allele
-                if ( allele_tokens[0] == "0")
-                {
-                    taxa[j].addCharacter( BinaryState("0") );
-                }
-                else if ( allele_tokens[0] == "1" )
-                {
-                    taxa[j].addCharacter( BinaryState("1") );
-                }
-                else if ( allele_tokens[0] == "." )
-                {
-                    taxa[j].addCharacter( missing_state );
-                }
-                else
+                read_any = true;
+                size_t len = strlen( buffer );
+                if ( len > 0 && buffer[len-1] == '\n' )
                 {
-                    throw RbException("Unknown scored character!");
-                }
-                
-                // second allele
-                if ( allele_tokens[1] == "0")
-                {
-                    taxa[j+NUM_SAMPLES].addCharacter( BinaryState("0") );
-                }
-                else if ( allele_tokens[1] == "1" )
-                {
-                    taxa[j+NUM_SAMPLES].addCharacter( BinaryState("1") );
-                }
-                else if ( allele_tokens[1] == "." )
-                {
-                    taxa[j+NUM_SAMPLES].addCharacter( missing_state );
-                }
-                else
-                {
-                    throw RbException("Unknown scored character!");
+                    line.append( buffer, len-1 );
+                    break;
                 }
+                line.append( buffer, len );
             }
-            
+
+            int error = Z_OK;
+            gzerror( file, &error );
+            if ( error != Z_OK )
+            {
+                throw RbException()<<"Could not read file "<<file_name<<". It seems to be damaged.";
+            }
+
+            // remove the carriage return of Windows line endings
+            if ( line.empty() == false && line[line.size()-1] == '\r' )
+            {
+                line.erase( line.size()-1 );
+            }
+
+            return read_any;
+        }
+
+    private:
+        VCFLineReader(const VCFLineReader &r);
+        VCFLineReader& operator=(const VCFLineReader &r);
+
+        gzFile                  file;
+        std::string             file_name;
+    };
+
+
+    /** Find the positions of the tab-separated fields of a line, without copying them */
+    void findFields(const std::string &line, std::vector<size_t> &starts)
+    {
+        starts.clear();
+        starts.push_back( 0 );
+        for (size_t i = line.find( '\t' ); i != std::string::npos; i = line.find( '\t', i+1 ))
+        {
+            starts.push_back( i+1 );
         }
+        // the end of the last field
+        starts.push_back( line.size()+1 );
     }
-    
-    // We have finished all lines, we fill up the data matrix
-    for (size_t i=0; i<NUM_SAMPLES; ++i)
+
+
+    /** Get the allele code (0 = reference, 1 = alternative, 2 = missing) of the allele between b and e */
+    size_t decodeAllele(const char *b, const char *e)
     {
-        matrix->addTaxonData(taxa[i]);
-        if ( ploidy == DIPLOID )
+        if ( e - b == 1 )
         {
-            matrix->addTaxonData( taxa[i+NUM_SAMPLES] );
+            switch ( *b )
+            {
+                case '0': return 0;
+                case '1': return 1;
+                case '.': return 2;
+            }
         }
+
+        throw RbException("Unknown scored character!");
     }
-    
-    return matrix;
+
 }
 
 
-HomologousDiscreteCharacterData<DnaState>* VCFReader::readDNAMatrix( void )
+VCFReader::VCFReader(const std::string &fn) :
+    filename( fn ),
+    ploidy( DIPLOID )
 {
-    HomologousDiscreteCharacterData<DnaState> *matrix = new HomologousDiscreteCharacterData<DnaState> ();
-    
-    int start = 0;
-    // Skip comments.
-    while ( chars[start][0][0] == '#' )
+
+}
+
+
+/**
+ * Read the VCF file into a character matrix.
+ * For each record, record_states gets the REF and ALT fields and sets the characters for the
+ * reference and the alternative allele. We append the characters directly to the taxa of the matrix.
+ */
+template <class charType, class recordStates>
+HomologousDiscreteCharacterData<charType>* VCFReader::readMatrix( const charType &missing_state, recordStates record_states )
+{
+
+    size_t num_alleles = 0;
+    if ( ploidy == HAPLOID )
     {
-        start = start + 1;
+        num_alleles = 1;
     }
-    
-    std::vector<std::string> sample_names;
-    size_t samples_start_column = 0;
-    const std::vector<std::string> &format_line = chars[start-1];
-    while ( format_line[samples_start_column] != "FORMAT" )
+    else if ( ploidy == DIPLOID )
     {
-        ++samples_start_column;
-    };
-    ++samples_start_column;
-    for (size_t j = samples_start_column; j < format_line.size(); ++j)
-    {
-        sample_names.push_back( format_line[j] );
+        num_alleles = 2;
     }
-    size_t NUM_SAMPLES = sample_names.size();
-    std::vector< DiscreteTaxonData<DnaState> > taxa;
-    if ( ploidy == DIPLOID )
+    else
     {
-        taxa = std::vector< DiscreteTaxonData<DnaState> >( 2*NUM_SAMPLES, DiscreteTaxonData<DnaState>( Taxon("") ) );
+        throw RbException("Currently we have only implementations for haploid and diploid organisms.");
     }
-    for (size_t i=0; i<NUM_SAMPLES; ++i)
+
+    VCFLineReader reader( filename );
+    std::string line;
+    std::vector<size_t> fields;
+
+    // skip the meta-information lines; the last header line names the columns
+    std::string header = "";
+    bool has_record = false;
+    while ( reader.getLine( line ) )
     {
-        Taxon this_taxon_A = Taxon( sample_names[i] + "_A" );
-        taxa[i] = DiscreteTaxonData<DnaState>( this_taxon_A );
-        Taxon this_taxon_B = Taxon( sample_names[i] + "_B" );
-        taxa[i+NUM_SAMPLES] = DiscreteTaxonData<DnaState>( this_taxon_B );
+        if ( line.empty() == true )
+        {
+            continue;
+        }
+        if ( line[0] != '#' )
+        {
+            has_record = true;
+            break;
+        }
+        header.swap( line );
     }
-    
+
+    // find the columns
+    findFields( header, fields );
     size_t ref_index = 0;
     size_t alt_index = 0;
-    for (size_t j = 0; j < format_line.size(); ++j)
+    size_t samples_start_column = 0;
+    for (size_t j = 0; j+1 < fields.size(); ++j)
     {
-        if ( format_line[j] == "REF" )
+        std::string column = header.substr( fields[j], fields[j+1] - fields[j] - 1 );
+        if ( column == "REF" )
         {
             ref_index = j;
         }
-        if ( format_line[j] == "ALT" )
+        else if ( column == "ALT" )
         {
             alt_index = j;
         }
+        else if ( column == "FORMAT" )
+        {
+            samples_start_column = j+1;
+        }
     }
-    
-    for (size_t i = start; i < chars.size(); ++i)
+    if ( samples_start_column == 0 )
     {
-        
-        DnaState reference_character = DnaState(chars[i][ref_index]);
-        DnaState alternative_character = DnaState(chars[i][alt_index]);
+        throw RbException()<<"Could not find the FORMAT column in the header of VCF file "<<filename;
+    }
 
-        for (size_t j = 0; j < NUM_SAMPLES; ++j)
+    // add a taxon for each allele of each sample
+    HomologousDiscreteCharacterData<charType> *matrix = new HomologousDiscreteCharacterData<charType>();
+    size_t num_samples = fields.size() - 1 - samples_start_column;
+    for (size_t i = 0; i < num_samples; ++i)
+    {
+        std::string sample_name = header.substr( fields[i+samples_start_column], fields[i+samples_start_column+1] - fields[i+samples_start_column] - 1 );
+        if ( num_alleles == 1 )
         {
-            
-            const std::string &this_char_read = chars[i][j+samples_start_column];
-            std::vector<std::string> format_tokens;
-            StringUtilities::stringSplit(this_char_read, ":", format_tokens);
-            
-            std::string this_alleles = format_tokens[0];
-            StringUtilities::replaceAllOccurrences(this_alleles, '/', '|');
-            std::vector<std::string> allele_tokens;
-            StringUtilities::stringSplit(this_alleles, "|", allele_tokens);
-            
-            if ( ploidy == DIPLOID )
+            matrix->addTaxonData( DiscreteTaxonData<charType>( Taxon( sample_name ) ) );
+        }
+        else
+        {
+            matrix->addTaxonData( DiscreteTaxonData<charType>( Taxon( sample_name + "_A" ) ) );
+            matrix->addTaxonData( DiscreteTaxonData<charType>( Taxon( sample_name + "_B" ) ) );
+        }
+    }
+    std::vector< DiscreteTaxonData<charType>* > taxa;
+    for (size_t i = 0; i < matrix->getNumberOfTaxa(); ++i)
+    {
+        taxa.push_back( &matrix->getTaxonData( i ) );
+    }
+
+    // the characters of the reference allele, the alternative allele and of missing alleles
+    std::vector<charType> states = std::vector<charType>( 3, missing_state );
+
+    try
+    {
+        while ( has_record == true )
+        {
+            if ( line.empty() == false )
             {
-                // first allele
-                if ( allele_tokens[0] == "0")
-                {
-                    taxa[j].addCharacter( reference_character );
-                }
-                else if ( allele_tokens[0] == "1" )
+                findFields( line, fields );
+                if ( fields.size() - 1 < samples_start_column + num_samples )
                 {
-                    taxa[j].addCharacter( reference_character );
+                    throw RbException()<<"The record '"<<line.substr( 0, 50 )<<"' in VCF file "<<filename<<" has fewer columns than the header.";
                 }
-                else if ( allele_tokens[0] == "." )
-                {
-                    taxa[j].addCharacter( DnaState("?") );
-                }
-                else
-                {
-                    throw RbException("Unknown scored character!");
-                }
-                
-                // second allele
-                if ( allele_tokens[1] == "0")
-                {
-                    taxa[j+NUM_SAMPLES].addCharacter( reference_character );
-                }
-                else if ( allele_tokens[1] == "1" )
-                {
-                    taxa[j+NUM_SAMPLES].addCharacter( reference_character );
-                }
-                else if ( allele_tokens[1] == "." )
-                {
-                    taxa[j+NUM_SAMPLES].addCharacter( DnaState("?") );
-                }
-                else
+
+                record_states( line.substr( fields[ref_index], fields[ref_index+1] - fields[ref_index] - 1 ),
+                               line.substr( fields[alt_index], fields[alt_index+1] - fields[alt_index] - 1 ),
+                               states[0], states[1] );
+
+                for (size_t j = 0; j < num_samples; ++j)
                 {
-                    throw RbException("Unknown scored character!");
+                    // the genotype is the first entry of the sample, e.g. "0|1:35:..."
+                    const char *b = line.c_str() + fields[j+samples_start_column];
+                    const char *e = line.c_str() + fields[j+samples_start_column+1] - 1;
+                    const char *gt_end = std::find( b, e, ':' );
+
+                    for (size_t k = 0; k < num_alleles; ++k)
+                    {
+                        const char *allele_end = std::find_if( b, gt_end, [](char c) { return c == '/' || c == '|'; } );
+                        if ( b == gt_end )
+                        {
+                            throw RbException()<<"The genotype '"<<std::string( line.c_str() + fields[j+samples_start_column], e )<<"' has fewer alleles than expected.";
+                        }
+                        taxa[j*num_alleles+k]->addCharacter( states[ decodeAllele( b, allele_end ) ] );
+                        b = ( allele_end == gt_end ? gt_end : allele_end + 1 );
+                    }
                 }
             }
-            
+
+            has_record = reader.getLine( line );
         }
     }
-    
-    // We have finished all lines, we fill up the data matrix
-    for (size_t i=0; i<NUM_SAMPLES; ++i)
+    catch (RbException &e)
     {
-        matrix->addTaxonData(taxa[i]);
-        if ( ploidy == DIPLOID )
-        {
-            matrix->addTaxonData( taxa[i+NUM_SAMPLES] );
-        }
+        delete matrix;
+        throw;
     }
-    
+
     return matrix;
 }
+
+
+HomologousDiscreteCharacterData<BinaryState>* VCFReader::readBinaryMatrix( void )
+{
+
+    BinaryState missing_state = BinaryState("0");
+    missing_state.setMissingState( true );
+
+    return readMatrix( missing_state, [](const std::string &ref, const std::string &alt, BinaryState &reference_state, BinaryState &alternative_state)
+    {
+        reference_state     = BinaryState("0");
+        alternative_state   = BinaryState("1");
+    });
+}
+
+
+HomologousDiscreteCharacterData<DnaState>* VCFReader::readDNAMatrix( void )
+{
+
+    return readMatrix( DnaState("?"), [](const std::string &ref, const std::string &alt, DnaState &reference_state, DnaState &alternative_state)
+    {
+        reference_state     = DnaState( ref );
+        alternative_state   = DnaState( alt );
+    });
+}
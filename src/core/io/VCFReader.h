@@ -1,7 +1,6 @@
 #ifndef VCFReader_H
 #define VCFReader_H
 
-#include "DelimitedDataReader.h"
 #include "AbstractHomologousDiscreteCharacterData.h"
 #include "HomologousDiscreteCharacterData.h"
 #include "BinaryState.h"
@@ -11,36 +10,44 @@
 #include <vector>
 
 namespace RevBayesCore {
-    
-    
+
+
     /**
      * Reader for VCF files.
      *
+     * The reader streams through the file one record at a time and decodes the genotypes
+     * directly into the character matrix. Thus, we never hold the text of the file in memory
+     * and the memory we need only depends on the size of the character matrix.
+     * Files compressed with gzip or bgzip are read transparently.
      *
+     * Every allele of a sample becomes a taxon, i.e., a diploid sample 'x' gives the taxa 'x_A' and 'x_B'.
      *
      * @copyright Copyright 2009-
      * @author The RevBayes Development Core Team (Sebastian Hoehna)
      * @since 2015-03-03, version 1.0
      *
      */
-    class VCFReader : public DelimitedDataReader {
-        
+    class VCFReader {
+
         enum PLOIDY { HAPLOID, DIPLOID, POLYPLOID };
 
     public:
-        
+
         VCFReader(const std::string &fn);
-        
+
         HomologousDiscreteCharacterData<DnaState>*              readDNAMatrix( void );
         HomologousDiscreteCharacterData<BinaryState>*           readBinaryMatrix( void );
 
     protected:
-        
+
+        template <class charType, class recordStates>
+        HomologousDiscreteCharacterData<charType>*              readMatrix( const charType &missing_state, recordStates record_states );
+
         std::string                                             filename;
         PLOIDY                                                  ploidy;
-        
+
     };
-    
+
 }
 
 #endif
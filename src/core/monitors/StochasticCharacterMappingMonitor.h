@@ -22,6 +22,8 @@ namespace RevBayesCore {
      * Declaration and implementation of the StochasticCharacterMappingMonitor class which
      * monitors samples of character histories drawn from the state-dependent birth death process
      * and PhyloCTMC and prints their value into a file.
+     * For a PhyloCTMC we may monitor several sites. Their histories are drawn together in one pass,
+     * and we print the columns of one site after the other.
      *
      */
     template<class characterType>
@@ -32,7 +34,7 @@ namespace RevBayesCore {
         // Constructors and Destructors
         StochasticCharacterMappingMonitor(StochasticNode<Tree>* ch, unsigned long g, const std::string &fname, bool is, bool sd, const std::string &del);
 //        StochasticCharacterMappingMonitor(TypedDagNode<Tree> *t, StochasticNode<AbstractHomologousDiscreteCharacterData>* ch, unsigned long g, const std::string &fname, bool is, const std::string &del);
-        StochasticCharacterMappingMonitor(StochasticNode<AbstractHomologousDiscreteCharacterData>* ch, unsigned long g, const std::string &fname, bool is, bool sd, const std::string &del, size_t idx);
+        StochasticCharacterMappingMonitor(StochasticNode<AbstractHomologousDiscreteCharacterData>* ch, unsigned long g, const std::string &fname, bool is, bool sd, const std::string &del, const std::vector<size_t> &idx);
         StochasticCharacterMappingMonitor(const StochasticCharacterMappingMonitor &m);
         virtual ~StochasticCharacterMappingMonitor(void);
 
@@ -53,7 +55,7 @@ namespace RevBayesCore {
         StochasticNode<AbstractHomologousDiscreteCharacterData>*            ctmc;
         bool                                            include_simmaps;                                                    //!< Should we print out SIMMAP/phytools compatible character histories?
         bool                                            use_simmap_default;
-        size_t                                          index;
+        std::vector<size_t>                             sites;                                                              //!< The sites we map; the SSE process has a single character
 
     };
 
@@ -75,7 +77,7 @@ StochasticCharacterMappingMonitor<characterType>::StochasticCharacterMappingMoni
     cdbdp( ch ),
     include_simmaps( is ),
     use_simmap_default( sd ),
-    index(0)
+    sites( 1, 0 )
 {
     ctmc = NULL;
 
@@ -88,12 +90,12 @@ StochasticCharacterMappingMonitor<characterType>::StochasticCharacterMappingMoni
 //StochasticCharacterMappingMonitor<characterType>::StochasticCharacterMappingMonitor(TypedDagNode<Tree> *t, StochasticNode<AbstractHomologousDiscreteCharacterData>* ch, unsigned long g, const std::string &fname, bool is, const std::string &del) : Monitor(g),
 /* Constructor for CTMC */
 template<class characterType>
-StochasticCharacterMappingMonitor<characterType>::StochasticCharacterMappingMonitor(StochasticNode<AbstractHomologousDiscreteCharacterData>* ch, unsigned long g, const std::string &fname, bool is, bool sd, const std::string &del, size_t idx) :
+StochasticCharacterMappingMonitor<characterType>::StochasticCharacterMappingMonitor(StochasticNode<AbstractHomologousDiscreteCharacterData>* ch, unsigned long g, const std::string &fname, bool is, bool sd, const std::string &del, const std::vector<size_t> &idx) :
     VariableMonitor(ch, g, fname, del, false, false, false),
     ctmc( ch ),
     include_simmaps( is ),
     use_simmap_default( sd ),
-    index(idx)
+    sites( idx )
 {
     cdbdp = NULL;
 
@@ -116,7 +118,7 @@ StochasticCharacterMappingMonitor<characterType>::StochasticCharacterMappingMoni
     ctmc( m.ctmc ),
     include_simmaps( m.include_simmaps ),
     use_simmap_default( m.use_simmap_default ),
-    index( m.index )
+    sites( m.sites )
 {
 
 }
@@ -171,42 +173,49 @@ void StochasticCharacterMappingMonitor<characterType>::monitorVariables(unsigned
         num_nodes = tree->getValue().getNumberOfNodes();
     }
         
-    std::vector<std::string> character_histories( num_nodes );
+    std::vector<std::vector<std::string> > character_histories( sites.size(), std::vector<std::string>( num_nodes ) );
     
     // draw stochastic character map
     if ( ctmc != NULL )
     {
-        ctmc_dist->drawStochasticCharacterMap( character_histories, index, use_simmap_default );
+        // we draw all sites at once, so that they share the ancestral states and the work per branch
+        ctmc_dist->drawStochasticCharacterMap( character_histories, sites, use_simmap_default );
     }
     else
     {
-        sse_process->drawStochasticCharacterMap( character_histories );
+        sse_process->drawStochasticCharacterMap( character_histories[0] );
     }
 
     // print to monitor file
     const std::vector<TopologyNode*>& nds = tree->getValue().getNodes();
-    for (int i = 0; i < nds.size(); i++)
+    for (size_t k = 0; k < sites.size(); ++k)
     {
+        for (int i = 0; i < nds.size(); i++)
+        {
 
-        size_t node_index = nds[i]->getIndex();
+            size_t node_index = nds[i]->getIndex();
 
-        // add a separator before every new element
-        out_stream << separator;
+            // add a separator before every new element
+            out_stream << separator;
 
-        // print out this branch's character history in the format
-        // used by SIMMAP and phytools
-        out_stream << character_histories[ node_index ];
-        
+            // print out this branch's character history in the format
+            // used by SIMMAP and phytools
+            out_stream << character_histories[k][ node_index ];
+            
+        }
     }
 
     if ( include_simmaps == true )
     {
-        // print out the SIMMAP/phytools compatible newick string as the last column of the log file
-        out_stream << separator;
-        Tree t = Tree(tree->getValue());
-        t.clearNodeParameters();
-        t.addNodeParameter( "character_history", character_histories, false );
-        out_stream << t.getSimmapNewickRepresentation();
+        // print out the SIMMAP/phytools compatible newick string of each site as the last columns of the log file
+        for (size_t k = 0; k < sites.size(); ++k)
+        {
+            out_stream << separator;
+            Tree t = Tree(tree->getValue());
+            t.clearNodeParameters();
+            t.addNodeParameter( "character_history", character_histories[k], false );
+            out_stream << t.getSimmapNewickRepresentation();
+        }
     }
 
 }
@@ -221,20 +230,35 @@ void StochasticCharacterMappingMonitor<characterType>::printFileHeader()
     std::vector<TopologyNode*> nodes = tree->getValue().getNodes();
 
     // iterate through all tree nodes and make header with node index
-    for (int i = 0; i < tree->getValue().getNumberOfNodes(); i++)
+    // if we monitor several sites, we prefix the node index with the site index
+    for (size_t k = 0; k < sites.size(); ++k)
     {
-        TopologyNode* nd = nodes[i];
-        size_t node_index = nd->getIndex();
-
-        out_stream << separator;
-        out_stream << node_index + 1;
-
+        for (int i = 0; i < tree->getValue().getNumberOfNodes(); i++)
+        {
+            TopologyNode* nd = nodes[i];
+            size_t node_index = nd->getIndex();
+
+            out_stream << separator;
+            if ( sites.size() > 1 )
+            {
+                out_stream << sites[k] + 1 << "_";
+            }
+            out_stream << node_index + 1;
+
+        }
     }
 
     if ( include_simmaps == true )
     {
-        out_stream << separator;
-        out_stream << "simmap";
+        for (size_t k = 0; k < sites.size(); ++k)
+        {
+            out_stream << separator;
+            out_stream << "simmap";
+            if ( sites.size() > 1 )
+            {
+                out_stream << "_" << sites[k] + 1;
+            }
+        }
     }
 
 }
@@ -640,7 +640,7 @@ void RevBayesCore::PathRejectionSampleProposal<charType>::undoProposal( void )
     BranchHistory* bh = &p->getHistory(*node);
     //    bh->print();
     
-    std::multiset<CharacterEvent*,CharacterEventCompare> proposed_history = bh->getHistory();
+    std::multiset<CharacterEvent*,CharacterEventCompare>& proposed_history = bh->getHistory();
     std::multiset<CharacterEvent*,CharacterEventCompare>::reverse_iterator it_h;
     std::vector<CharacterEvent*> events;
     for (it_h = proposed_history.rbegin(); it_h != proposed_history.rend(); ++it_h)
@@ -663,11 +663,10 @@ void RevBayesCore::PathRejectionSampleProposal<charType>::undoProposal( void )
     // flag node as dirty
     const_cast<TopologyNode*>(node)->fireTreeChangeEvent(RevBayesCore::TreeChangeEventMessage::CHARACTER_HISTORY);
     
-    // swap current value and stored value
-    bh->setHistory(storedHistory);
+    // swap current value and stored value (the proposed events were deleted above, so we simply drop them)
+    proposed_history.swap( storedHistory );
 
     // clear old histories
-    proposed_history.clear();
     storedHistory.clear();
     sampledCharacters.clear();
     
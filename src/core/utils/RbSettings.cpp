@@ -57,6 +57,12 @@ bool RbSettings::getCollapseSampledAncestors( void ) const
     return collapseSampledAncestors;
 }
 
+size_t RbSettings::getNumberOfThreads( void ) const
+{
+    // return the internal value
+    return numThreads;
+}
+
 std::string RbSettings::getOption(const std::string &key) const
 {
     if ( key == "moduledir" )
@@ -91,6 +97,10 @@ std::string RbSettings::getOption(const std::string &key) const
     {
         return collapseSampledAncestors ? "true" : "false";
     }
+    else if ( key == "numThreads" )
+    {
+        return StringUtilities::to_string(numThreads);
+    }
     else
     {
         std::cout << "Unknown user setting with key '" << key << "'." << std::endl;
@@ -133,6 +143,7 @@ void RbSettings::initializeUserSettings(void)
     outputPrecision = 7;
     printNodeIndex = true;      // print node indices of tree nodes as comments
     collapseSampledAncestors = true;
+    numThreads = 1;             // by default we compute serially, which is also what we want for each MPI process
     
     path user_dir = RevBayesCore::expandUserDir("~");
     
@@ -171,6 +182,7 @@ void RbSettings::listOptions() const
     std::cout << "useScaling = " << (useScaling ? "true" : "false") << std::endl;
     std::cout << "scalingDensity = " << scalingDensity << std::endl;
     std::cout << "collapseSampledAncestors = " << (collapseSampledAncestors ? "true" : "false") << std::endl;
+    std::cout << "numThreads = " << numThreads << std::endl;
 }
 
 
@@ -272,6 +284,14 @@ void RbSettings::setOption(const std::string &key, const std::string &v, bool wr
     {
         collapseSampledAncestors = value == "true";
     }
+    else if ( key == "numThreads" )
+    {
+        int n = atoi(value.c_str());
+        if (n < 1)
+            throw(RbException("numThreads must be an integer greater than 0"));
+        
+        numThreads = n;
+    }
     else
     {
         std::cout << "Unknown user setting with key '" << key << "'." << std::endl;
@@ -330,6 +350,7 @@ void RbSettings::writeUserSettings( void )
     writeStream << "useScaling=" << (useScaling ? "true" : "false") << std::endl;
     writeStream << "scalingDensity=" << scalingDensity << std::endl;
     writeStream << "collapseSampledAncestors=" << (collapseSampledAncestors ? "true" : "false") << std::endl;
+    writeStream << "numThreads=" << numThreads << std::endl;
     writeStream.close();
 
 }
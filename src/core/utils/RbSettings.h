@@ -23,6 +23,7 @@ class RbSettings {
         bool                        getCollapseSampledAncestors(void) const;            //!< Retrieve the whether to should display sampled ancestors as 2-degree nodes when printing
         size_t                      getLineWidth(void) const;                           //!< Retrieve the line width that will be used for the screen width when printing
         const RevBayesCore::path&   getModuleDir(void) const;                           //!< Retrieve the module directory name
+        size_t                      getNumberOfThreads(void) const;                     //!< Retrieve the number of threads that may be used within a single computation
         std::string                 getOption(const std::string &k) const;              //!< Retrieve a user option
         size_t                      getOutputPrecision(void) const;                     //!< Retrieve the default output precision width
         bool                        getPrintNodeIndex(void) const;                      //!< Retrieve the flag whether we should print node indices
@@ -55,6 +56,7 @@ class RbSettings {
         bool                        collapseSampledAncestors;
         size_t                      lineWidth;
         RevBayesCore::path          moduleDir;
+        size_t                      numThreads;                                         //!< Number of threads for a single computation, 1 means serial
         size_t                      outputPrecision;
         bool                        printNodeIndex;                                     //!< Should the node index of a tree be printed as a comment?
         size_t                      scalingDensity;
@@ -6,6 +6,7 @@
 #include <limits>
 #include <set>
 #include <cstddef>
+#include <cstdint>
 #include <functional>
 #include <iterator>
 #include <map>
@@ -381,15 +382,55 @@ void RevBayesCore::TreeUtilities::climbUpTheTree(const TopologyNode& node, boost
 double RevBayesCore::TreeUtilities::computeRobinsonFouldDistance(const RevBayesCore::Tree& a, const RevBayesCore::Tree& b, bool symmetric)
 {
     
-    std::vector<RbBitSet>* bipartitions_a = a.getNodesAsBitset();
-    std::vector<RbBitSet>* bipartitions_b = b.getNodesAsBitset();
-    
-    double RF_distance = TreeUtilities::computeRobinsonFouldDistance(*bipartitions_a, *bipartitions_b, symmetric);
-    
-    delete bipartitions_a;
-    delete bipartitions_b;
-    
-    return RF_distance;
+    // we compare the clades of the interior nodes by their hashes, which the trees cache,
+    // so that we do not need to build and compare all the bitsets
+    std::vector<std::uint64_t> clades_a;
+    std::vector<std::uint64_t> clades_b;
+    for (size_t i = 0; i < a.getNumberOfNodes(); ++i)
+    {
+        const TopologyNode &n = a.getNode( i );
+        if ( n.isTip() == false )
+        {
+            clades_a.push_back( a.getCladeHash( n ) );
+        }
+    }
+    for (size_t i = 0; i < b.getNumberOfNodes(); ++i)
+    {
+        const TopologyNode &n = b.getNode( i );
+        if ( n.isTip() == false )
+        {
+            clades_b.push_back( b.getCladeHash( n ) );
+        }
+    }
+
+    boost::unordered_set<std::uint64_t> set_a( clades_a.begin(), clades_a.end() );
+    boost::unordered_set<std::uint64_t> set_b( clades_b.begin(), clades_b.end() );
+
+    double distance = 0.0;
+    for (size_t i = 0; i < clades_a.size(); ++i)
+    {
+        if ( set_b.find( clades_a[i] ) == set_b.end() )
+        {
+            distance += 1.0;
+        }
+    }
+
+    if ( symmetric == true )
+    {
+        distance *= 2;
+    }
+    else
+    {
+        for (size_t i = 0; i < clades_b.size(); ++i)
+        {
+            if ( set_a.find( clades_b[i] ) == set_a.end() )
+            {
+                distance += 1.0;
+            }
+        }
+    }
+
+    return distance;
 }
 
 /** Calculate Robinson-Foulds distance between two trees
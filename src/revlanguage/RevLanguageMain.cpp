@@ -1,4 +1,7 @@
+#include <chrono>
+#include <iomanip>
 #include <iostream>
+#include <sstream>
 #include <string>
 #include <cstdlib>
 #include <vector>
@@ -17,7 +20,7 @@
 #include <mpi.h>
 #endif
 
-RevLanguageMain::RevLanguageMain(bool b) : batch_mode(b)
+RevLanguageMain::RevLanguageMain(bool b, bool p) : batch_mode(b), profile_startup(p)
 {
 
 }
@@ -31,6 +34,8 @@ void RevLanguageMain::startRevLanguageEnvironment(const std::vector<std::string>
     MPI_Comm_rank(MPI_COMM_WORLD, &pid);
 #endif
     
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    
     // load the modules
     try
     {
@@ -40,6 +45,7 @@ void RevLanguageMain::startRevLanguageEnvironment(const std::vector<std::string>
     {
         std::cout << e.getMessage() << std::endl;
     }
+    std::chrono::duration<double, std::milli> module_time = std::chrono::steady_clock::now() - start;
 
 
     // Print a nifty message
@@ -47,7 +53,22 @@ void RevLanguageMain::startRevLanguageEnvironment(const std::vector<std::string>
     RevLanguage::UserInterface::userInterface().output(version.getHeader(), false);
     RevLanguage::UserInterface::userInterface().output("", false);
     
-    RevLanguage::Workspace::globalWorkspace().initializeGlobalWorkspace();
+    if ( profile_startup == true )
+    {
+        std::ostringstream o;
+        o << "Loaded modules in " << std::fixed << std::setprecision(1) << module_time.count() << " ms";
+        RevLanguage::UserInterface::userInterface().output( o.str() );
+    }
+    
+    RevLanguage::Workspace::globalWorkspace().initializeGlobalWorkspace( profile_startup );
+
+    if ( profile_startup == true )
+    {
+        std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+        std::ostringstream o;
+        o << "Started up in " << std::fixed << std::setprecision(1) << elapsed.count() << " ms";
+        RevLanguage::UserInterface::userInterface().output( o.str() );
+    }
 
     // process the command line arguments as source file names    
     std::string line;
@@ -25,13 +25,14 @@ class RevLanguageMain {
     
     public:
     
-        RevLanguageMain(bool batch = false);
+        RevLanguageMain(bool batch = false, bool profile = false);
     
         void startRevLanguageEnvironment(const std::vector<std::string> &args, const std::vector<std::string> &source_files);
 
     private:
     
         bool batch_mode;
+        bool profile_startup;                                       //!< Print the time spent in each phase of startup
 };
 
 #endif
@@ -63,6 +63,19 @@ TraceTree::TraceTree(const RevBayesCore::TraceTree& x) : WorkspaceToCoreWrapperO
 }
 
 
+/**
+ * Constructor from a trace that we take over, so that we do not need to copy all the trees.
+ * We are responsible for deleting the trace.
+ */
+TraceTree::TraceTree(RevBayesCore::TraceTree* x) : WorkspaceToCoreWrapperObject<RevBayesCore::TraceTree>( x )
+{
+    
+    // initialize the methods
+    initMethods();
+    
+}
+
+
 /**
  * The clone function is a convenience function to create proper copies of inherited objected.
  * E.g. a.clone() will create a clone of the correct type even if 'a' is of derived type 'b'.
@@ -310,12 +323,10 @@ RevPtr<RevVariable> TraceTree::executeMethod(std::string const &name, const std:
         bool strict = static_cast<const RlBoolean &>( args[1].getVariable()->getRevObject() ).getValue();
         bool stem   = static_cast<const RlBoolean &>( args[2].getVariable()->getRevObject() ).getValue();
 
-        const std::vector<RevBayesCore::Tree>& trees = this->value->getValues();
-
         RevBayesCore::RbVector<double> ages;
 
-        RevBayesCore::RbBitSet bits = RevBayesCore::RbBitSet( this->value->getValues()[0].getNumberOfTips() );
-        const std::map<std::string, size_t>& taxon_map = this->value->getValues()[0].getTaxonBitSetMap();
+        RevBayesCore::RbBitSet bits = RevBayesCore::RbBitSet( this->value->objectAt(0).getNumberOfTips() );
+        const std::map<std::string, size_t>& taxon_map = this->value->objectAt(0).getTaxonBitSetMap();
         for ( size_t i=0; i<this_clade.size(); ++i )
         {
             RevBayesCore::Taxon t = this_clade.getTaxon(i);
@@ -326,12 +337,14 @@ RevPtr<RevVariable> TraceTree::executeMethod(std::string const &name, const std:
         }
         this_clade.setBitRepresentation( bits );
         
-        for (size_t i=this->value->getBurnin(); i<trees.size(); ++i)
+        size_t num_samples = size_t( this->value->size() );
+        for (size_t i=this->value->getBurnin(); i<num_samples; ++i)
         {
             // default age
             double age = -1;
             
-            const RevBayesCore::TopologyNode* mrca = trees[i].getRoot().getMrca( this_clade, strict );
+            std::shared_ptr<const RevBayesCore::Tree> sample_tree = this->value->treeAt(i);
+            const RevBayesCore::TopologyNode* mrca = sample_tree->getRoot().getMrca( this_clade, strict );
             if ( mrca != NULL )
             {
                 if ( stem == false )
@@ -353,24 +366,24 @@ RevPtr<RevVariable> TraceTree::executeMethod(std::string const &name, const std:
     {
         found = true;
         
-        std::vector<RevBayesCore::Tree> trees = this->value->getValues();
         size_t start_index = this->value->getBurnin();
+        size_t num_samples = size_t( this->value->size() );
         
         if ( this->value->isClock() == true )
         {
             ModelVector<TimeTree> *rl_trees = new ModelVector<TimeTree>;
-            for (size_t i=start_index; i<trees.size(); ++i)
+            for (size_t i=start_index; i<num_samples; ++i)
             {
-                rl_trees->push_back( trees[i] );
+                rl_trees->push_back( this->value->objectAt(i) );
             }
             return new RevVariable( rl_trees );
         }
         else
         {
             ModelVector<BranchLengthTree> *rl_trees = new ModelVector<BranchLengthTree>;
-            for (size_t i=start_index; i<trees.size(); ++i)
+            for (size_t i=start_index; i<num_samples; ++i)
             {
-                rl_trees->push_back( trees[i] );
+                rl_trees->push_back( this->value->objectAt(i) );
             }
             return new RevVariable( rl_trees );
         }
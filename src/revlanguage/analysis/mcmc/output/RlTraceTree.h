@@ -16,6 +16,7 @@ namespace RevLanguage {
         
         TraceTree(void);                                                                                                                    //!< Default constructor
         TraceTree(const RevBayesCore::TraceTree& x);                                                                                              //!< Copy constructor
+        TraceTree(RevBayesCore::TraceTree* x);                                                                                                    //!< Constructor taking over the trace
         
         // Basic utility functions
         virtual TraceTree*                          clone(void) const;                                                                      //!< Clone object
@@ -126,6 +126,11 @@ std::string Function::callSignature(void) const
  *     rules (we use copies of the values, of course).
  *  6. If there are still empty slots, the arguments do not match the rules.
  *
+ * If exact_match is not null, we record whether every argument matched the first type of
+ * its rule without type conversion. Such a match depends only on the labels, types and
+ * DAG node types of the arguments, but not on their values, and can therefore be reused
+ * for later calls with the same kind of arguments.
+ *
  * @todo Fredrik: The code and the logic has been changed without changing the comments, so these
  *       are out of date. Also note that the argument matching is problematic for unlabeled
  *       arguments (order can be changed based on argument types, which may cause unintended
@@ -133,13 +138,18 @@ std::string Function::callSignature(void) const
  *       Finally, the ellipsis arguments no longer have to be last among the rules, but they
  *       are still the last arguments after processing.
  */
-bool Function::checkArguments( const std::vector<Argument>& passed_args, std::vector<double>* match_score, bool once)
+bool Function::checkArguments( const std::vector<Argument>& passed_args, std::vector<double>* match_score, bool once, bool* exact_match)
 {
     
     /*********************  0. Initialization  **********************/
     
     double MAX_ARGS = 1000.0;
     
+    if ( exact_match != NULL )
+    {
+        *exact_match = true;
+    }
+    
     /* Get the argument rules */
     const ArgumentRules& the_rules = getArgumentRules();
     
@@ -191,6 +201,11 @@ bool Function::checkArguments( const std::vector<Argument>& passed_args, std::ve
                         taken[i]          = true;
                         filled[j]         = true;
 
+                        if ( exact_match != NULL && isExactMatch( passed_args[i].getVariable(), the_rules[j] ) == false )
+                        {
+                            *exact_match = false;
+                        }
+                        
                         if ( match_score != NULL)
                         {
                             double score = computeMatchScore(passed_args[i].getVariable(), the_rules[j]);
@@ -260,6 +275,11 @@ bool Function::checkArguments( const std::vector<Argument>& passed_args, std::ve
                 taken[i]                  = true;
                 filled[match_rule]        = true;
             
+                if ( exact_match != NULL && isExactMatch( passed_args[i].getVariable(), the_rules[match_rule] ) == false )
+                {
+                    *exact_match = false;
+                }
+                
                 if ( match_score != NULL)
                 {
                     double score = computeMatchScore(passed_args[i].getVariable(), the_rules[match_rule]);
@@ -306,6 +326,11 @@ bool Function::checkArguments( const std::vector<Argument>& passed_args, std::ve
                         filled[j]     = true;
                     }
                     
+                    if ( exact_match != NULL && isExactMatch( passed_args[i].getVariable(), the_rules[j] ) == false )
+                    {
+                        *exact_match = false;
+                    }
+                    
                     if ( match_score != NULL)
                     {
                         const RevPtr<const RevVariable>& arg_var = passed_args[i].getVariable();
@@ -405,6 +430,26 @@ double Function::computeMatchScore(const RevVariable *var, const ArgumentRule &r
 }
 
 
+/**
+ * Does the argument match the rule without type conversion? We require the argument to be
+ * of the first type of the rule, because the rule tries to convert the argument to that
+ * type before looking at the other types, and type conversion may depend on the value.
+ * Option rules additionally check the value itself, so a match against them is never exact.
+ */
+bool Function::isExactMatch(const RevVariable *var, const ArgumentRule &rule) const
+{
+    
+    if ( dynamic_cast<const OptionRule*>( &rule ) != NULL )
+    {
+        return false;
+    }
+    
+    const std::vector<TypeSpec> &rule_arg_types = rule.getArgumentTypeSpec();
+    
+    return rule_arg_types.empty() == false && var->getRevObject().isType( rule_arg_types[0] );
+}
+
+
 const std::vector<Argument>& Function::getArguments(void) const
 {
     return args;
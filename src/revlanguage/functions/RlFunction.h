@@ -66,7 +66,8 @@ namespace RevLanguage {
         // Functions you may want to override
         virtual bool                                    checkArguments(const std::vector<Argument>& passed_args,
                                                                        std::vector<double>*         matchScore,
-                                                                       bool                         once);                                  //!< Process args, return a match score if pointer is not null
+                                                                       bool                         once,
+                                                                       bool*                        exactMatch = NULL);                     //!< Process args, return a match score if pointer is not null
         virtual bool                                    isInternal(void) const { return false; }                                           //!< Is the function a procedure?
         virtual bool                                    isProcedure(void) const { return false; }                                           //!< Is the function a procedure?
         virtual void                                    processArguments(const std::vector<Argument>& passed_args, bool once);               //!< Process args, return a match score if pointer is not null
@@ -97,6 +98,7 @@ namespace RevLanguage {
 
     private:
         double                                          computeMatchScore(const RevVariable* arg, const ArgumentRule& rule);
+        bool                                            isExactMatch(const RevVariable* arg, const ArgumentRule& rule) const;
 };
     
 }
@@ -2,10 +2,17 @@
 
 #include <math.h>
 #include <stddef.h>
+#include <algorithm>
+#include <atomic>
+#include <cctype>
+#include <exception>
 #include <map>
+#include <memory>
 #include <set>
 #include <sstream>
 #include <string>
+#include <system_error>
+#include <thread>
 #include <vector>
 
 #include "ArgumentRule.h"
@@ -18,6 +25,7 @@
 #include "Probability.h"
 #include "ProgressBar.h"
 #include "RbException.h"
+#include "RbSettings.h"
 #include "RbFileManager.h"
 #include "RlClade.h"
 #include "RlString.h"
@@ -57,6 +65,158 @@ namespace RevBayesCore { class Tree; }
 
 using namespace RevLanguage;
 
+namespace {
+
+    /**
+     * Get the column with the given index of a line, using the same rules as StringUtilities::stringSplit.
+     * We only need the tree column of each sample, so we do not split (and copy) the whole line.
+     * An empty delimiter means that the columns are separated by white space.
+     */
+    std::string getColumn(const std::string &line, const std::string &delimiter, size_t index)
+    {
+        
+        size_t begin = 0;
+        size_t end = 0;
+        
+        if ( delimiter.empty() == true )
+        {
+            auto is_space = [](char c) { return isspace( (unsigned char)c ) != 0; };
+            
+            std::string::const_iterator it = line.begin();
+            for (size_t j = 0; j <= index; ++j)
+            {
+                it = std::find_if_not( it, line.end(), is_space );
+                begin = it - line.begin();
+                it = std::find_if( it, line.end(), is_space );
+                end = it - line.begin();
+            }
+        }
+        else
+        {
+            for (size_t j = 0; j < index; ++j)
+            {
+                begin = line.find( delimiter, begin );
+                if ( begin == std::string::npos )
+                {
+                    return "";
+                }
+                begin += delimiter.size();
+            }
+            
+            end = line.find( delimiter, begin );
+            if ( end == std::string::npos )
+            {
+                end = line.size();
+            }
+        }
+        
+        return line.substr( begin, end - begin );
+    }
+    
+    
+    /** Convert the Newick string of a sample into the tree we store in the trace. */
+    RevBayesCore::Tree* parseTree(const std::string &newick, bool clock, bool unroot_nonclock)
+    {
+        
+        RevBayesCore::NewickConverter c;
+        RevBayesCore::Tree *tau = c.convertFromNewick( newick );
+        
+        if ( clock == true )
+        {
+            RevBayesCore::Tree *bl_tree = tau;
+            tau = RevBayesCore::TreeUtilities::convertTree( *bl_tree );
+            delete bl_tree;
+        }
+        else if ( unroot_nonclock == true )
+        {
+            tau->removeRootIfDegree2();
+//          Perhaps we should mark the tree unrooted, since we have removed the old root,
+//            and chosen a neighbor as the now root.
+//          However, RevBayes has bugs with unrooted trees and may crash.
+//            tau->setRooted(false);
+        }
+        
+        return tau;
+    }
+    
+    
+    /**
+     * Convert a batch of Newick strings into trees.
+     * The trees are independent of each other, so we let up to num_threads threads take the next unparsed string
+     * until the batch is done. The i-th tree belongs to the i-th string, hence the trace keeps the order of the file.
+     * If any string cannot be parsed, we delete all trees of the batch and throw the error of the first bad string.
+     */
+    void parseTrees(const std::vector<std::string> &newick, bool clock, bool unroot_nonclock, size_t num_threads, std::vector<RevBayesCore::Tree*> &trees)
+    {
+        
+        trees.assign( newick.size(), NULL );
+        std::vector<std::exception_ptr> errors( newick.size() );
+        std::atomic<size_t> next( 0 );
+        
+        auto parse = [&]()
+        {
+            for (size_t i = next++; i < newick.size(); i = next++)
+            {
+                try
+                {
+                    trees[i] = parseTree( newick[i], clock, unroot_nonclock );
+                }
+                catch (...)
+                {
+                    errors[i] = std::current_exception();
+                }
+            }
+        };
+        
+        std::vector<std::thread> threads;
+        for (size_t k = 1; k < std::min( num_threads, newick.size() ); ++k)
+        {
+            try
+            {
+                threads.push_back( std::thread( parse ) );
+            }
+            catch (std::system_error &e)
+            {
+                // we could not start another thread, so we use the ones we have
+                break;
+            }
+        }
+        parse();
+        for (size_t k = 0; k < threads.size(); ++k)
+        {
+            threads[k].join();
+        }
+        
+        for (size_t i = 0; i < errors.size(); ++i)
+        {
+            if ( errors[i] != NULL )
+            {
+                for (size_t j = 0; j < trees.size(); ++j)
+                {
+                    delete trees[j];
+                }
+                trees.clear();
+                
+                std::rethrow_exception( errors[i] );
+            }
+        }
+    }
+    
+    
+    /** Move the trees into the trace, in their order. */
+    void addTrees(std::vector<RevBayesCore::Tree*> &trees, RevBayesCore::TraceTree &t)
+    {
+        
+        for (size_t i = 0; i < trees.size(); ++i)
+        {
+            t.addObject( std::move( *trees[i] ) );
+            delete trees[i];
+        }
+        trees.clear();
+    }
+    
+}
+
 /**
  * The clone function is a convenience function to create proper copies of inherited objected.
  * E.g. a.clone() will create a clone of the correct type even if 'a' is of derived type 'b'.
@@ -84,6 +244,7 @@ RevPtr<RevVariable> Func_readTreeTrace::execute( void )
     size_t arg_index_offset    = 7;
     size_t arg_index_nexus     = 8;
     size_t arg_index_nruns     = 9;
+    size_t arg_index_compact   = 10;
 
     // get the information from the arguments for reading the file
     const std::string&  treetype = static_cast<const RlString&>( args[arg_index_tree_type].getVariable()->getRevObject() ).getValue();
@@ -94,6 +255,7 @@ RevPtr<RevVariable> Func_readTreeTrace::execute( void )
     long                offset   = static_cast<const Natural&>( args[arg_index_offset].getVariable()->getRevObject() ).getValue();
     bool nexus = static_cast<RlBoolean&>(args[arg_index_nexus].getVariable()->getRevObject()).getValue();
     long                nruns    = static_cast<const Natural&>( args[arg_index_nruns].getVariable()->getRevObject() ).getValue();
+    bool                compact  = static_cast<const RlBoolean&>( args[arg_index_compact].getVariable()->getRevObject() ).getValue();
 
     std::vector<RevBayesCore::path> vectorOfFileNames;
     
@@ -170,13 +332,13 @@ RevPtr<RevVariable> Func_readTreeTrace::execute( void )
     WorkspaceVector<TraceTree> *rv = NULL;
     if ( treetype == "clock" )
     {
-        if(nexus) rv = readTreesNexus(vectorOfFileNames, treetype, unroot_nonclock, thin, offset);
-        else rv = readTrees(vectorOfFileNames, sep, treetype, unroot_nonclock, thin, offset);
+        if(nexus) rv = readTreesNexus(vectorOfFileNames, treetype, unroot_nonclock, thin, offset, compact);
+        else rv = readTrees(vectorOfFileNames, sep, treetype, unroot_nonclock, thin, offset, compact);
     }
     else if ( treetype == "non-clock" )
     {
-        if(nexus) rv = readTreesNexus(vectorOfFileNames, treetype, unroot_nonclock, thin, offset);
-        else rv = readTrees(vectorOfFileNames, sep, treetype, unroot_nonclock, thin, offset);
+        if(nexus) rv = readTreesNexus(vectorOfFileNames, treetype, unroot_nonclock, thin, offset, compact);
+        else rv = readTrees(vectorOfFileNames, sep, treetype, unroot_nonclock, thin, offset, compact);
         
         RevBayesCore::Clade og;
         if ( args[arg_index_outgroup].getVariable() != NULL && args[arg_index_outgroup].getVariable()->getRevObject() != RevNullObject::getInstance())
@@ -266,6 +428,7 @@ const ArgumentRules& Func_readTreeTrace::getArgumentRules( void ) const
         argumentRules.push_back( new ArgumentRule( "nexus", RlBoolean::getClassTypeSpec(), "Whether the file to read is in NEXUS format.", ArgumentRule::BY_VALUE, ArgumentRule::ANY, new RlBoolean(false)) );
 
         argumentRules.push_back( new ArgumentRule( "nruns", Natural::getClassTypeSpec(), "The number of trace files with the same basename (i.e. the number of filenames with pattern <file>_run_<n>.trees", ArgumentRule::BY_VALUE, ArgumentRule::ANY, new Natural( 1l ) ) );
+        argumentRules.push_back( new ArgumentRule( "compact", RlBoolean::getClassTypeSpec(), "Store the trees in a compact form and only create them when they are used. This needs much less memory for large traces, but accessing the trees is slower.", ArgumentRule::BY_VALUE, ArgumentRule::ANY, new RlBoolean(false) ) );
 
         rules_set = true;
     }
@@ -325,12 +488,17 @@ const TypeSpec& Func_readTreeTrace::getReturnType( void ) const
 }
 
 
-WorkspaceVector<TraceTree>* Func_readTreeTrace::readTrees(const std::vector<RevBayesCore::path> &vector_of_file_names, const std::string &delimiter, const std::string& treetype, bool unroot_nonclock, long thinning, long offset)
+WorkspaceVector<TraceTree>* Func_readTreeTrace::readTrees(const std::vector<RevBayesCore::path> &vector_of_file_names, const std::string &delimiter, const std::string& treetype, bool unroot_nonclock, long thinning, long offset, bool compact)
 {
     bool clock = (treetype == "clock");
 
-    std::vector<TraceTree> data;
+    // we only hand out the traces once all files are read, so that nothing leaks if a file cannot be parsed
+    std::unique_ptr< WorkspaceVector<TraceTree> > rv( new WorkspaceVector<TraceTree>() );
     
+    // the trees are independent, so we may parse batches of them on several threads
+    size_t num_threads = RbSettings::userSettings().getNumberOfThreads();
+    size_t batch_size  = 256 * num_threads;
+
     // Set up a map with the file name to be read as the key and the file type as the value. Note that we may not
     // read all of the files in the string called "vectorOfFileNames" because some of them may not be in a format
     // that can be read.
@@ -380,8 +548,12 @@ WorkspaceVector<TraceTree>* Func_readTreeTrace::readTrees(const std::vector<RevB
         size_t index = 0;
         progress.start();
         
-        RevBayesCore::TraceTree t(clock);
-        t.setFileName(fn);
+        std::unique_ptr<RevBayesCore::TraceTree> t( new RevBayesCore::TraceTree(clock, compact) );
+        t->setFileName(fn);
+
+        // the Newick strings of the samples we keep, which we parse batch by batch
+        std::vector<std::string> newick;
+        std::vector<RevBayesCore::Tree*> trees;
 
         /* Command-processing loop */
         while ( in_file.good() )
@@ -405,16 +577,16 @@ WorkspaceVector<TraceTree>* Func_readTreeTrace::readTrees(const std::vector<RevB
                 continue;
             }
             
-            // splitting every line into its columns
-            std::vector<std::string> columns;
-            
-            // we should provide other delimiters too
-            StringUtilities::stringSplit(line, delimiter, columns);
-            
             // we assume a header at the first line of the file
             if ( has_header_been_read == false )
             {
                 
+                // splitting the header into its columns
+                std::vector<std::string> columns;
+                
+                // we should provide other delimiters too
+                StringUtilities::stringSplit(line, delimiter, columns);
+                
                 for (size_t j=1; j<columns.size(); j++)
                 {
                     
@@ -425,7 +597,7 @@ WorkspaceVector<TraceTree>* Func_readTreeTrace::readTrees(const std::vector<RevB
                     }
                     index = j;
                     
-                    t.setParameterName(parmName);
+                    t->setParameterName(parmName);
 
                     break;
                 }
@@ -439,65 +611,58 @@ WorkspaceVector<TraceTree>* Func_readTreeTrace::readTrees(const std::vector<RevB
             ++n_samples;
             
             // we need to check if we skip this sample in case of thinning.
+            // we do so before we look at the line, so skipped samples cost us nothing
             if ( (n_samples-1-offset) % thinning > 0 )
             {
                 continue;
             }
             
-            RevBayesCore::Tree *tau = NULL;
-            if ( clock == true )
-            {
-                RevBayesCore::NewickConverter c;
-                RevBayesCore::Tree *blTree = c.convertFromNewick( columns[index] );
-                tau = RevBayesCore::TreeUtilities::convertTree( *blTree );
-            }
-            else
+            newick.push_back( getColumn( line, delimiter, index ) );
+            
+            if ( newick.size() == batch_size )
             {
-                RevBayesCore::NewickConverter c;
-                tau = c.convertFromNewick( columns[index] );
-                if (unroot_nonclock)
-                {
-                    tau->removeRootIfDegree2();
-//                  Perhaps we should mark the tree unrooted, since we have removed the old root,
-//                    and chosen a neighbor as the now root.
-//                  However, RevBayes has bugs with unrooted trees and may crash.
-//                    tau->setRooted(false);
-                }
+                parseTrees( newick, clock, unroot_nonclock, num_threads, trees );
+                addTrees( trees, *t );
+                newick.clear();
+                
+                progress.update( n_samples );
             }
             
-            t.addObject( tau );
-            progress.update( n_samples );
-            
         }
         in_file.close();
         
+        parseTrees( newick, clock, unroot_nonclock, num_threads, trees );
+        addTrees( trees, *t );
+        
         progress.finish();
 
-        data.push_back( TraceTree(t) );
+        // the Rev object takes over the trace, so we only copy it once into the vector
+        rv->push_back( TraceTree( t.release() ) );
     }
     
-    return new WorkspaceVector<TraceTree>( data );
+    return rv.release();
 }
 
 /** Create tree trace from one or several Nexus file(s)
  * @param fns vector of file names
  * @param clock whether trees have a clock
  * @param thin keep only every thin-th sample
+ * @param compact whether to store the trees in a compact form
  * @return tree trace
  * @see Func_readTrees::execute
  *
  * @note if multiple files are given, the traces will all be appended without regard for burnin
  * */
-WorkspaceVector<TraceTree>* Func_readTreeTrace::readTreesNexus(const std::vector<RevBayesCore::path> &fns, const string& treetype, bool unroot_nonclock, long thin, long offset)
+WorkspaceVector<TraceTree>* Func_readTreeTrace::readTreesNexus(const std::vector<RevBayesCore::path> &fns, const string& treetype, bool unroot_nonclock, long thin, long offset, bool compact)
 {
-    std::vector<TraceTree> data;
+    std::unique_ptr< WorkspaceVector<TraceTree> > rv( new WorkspaceVector<TraceTree>() );
 
     bool clock = (treetype == "clock");
 
     for (auto& fn: fns)
     {
-        RevBayesCore::TraceTree tt = RevBayesCore::TraceTree();
-        tt.setParameterName("tree");
+        std::unique_ptr<RevBayesCore::TraceTree> tt( new RevBayesCore::TraceTree( true, compact ) );
+        tt->setParameterName("tree");
 
         // get the global instance of the NCL reader and clear warnings from its warnings buffer
         RevBayesCore::NclReader reader = RevBayesCore::NclReader();
@@ -524,17 +689,18 @@ WorkspaceVector<TraceTree>* Func_readTreeTrace::readTreesNexus(const std::vector
                         tree->setRooted(false);
                     }
 
-                    tt.addObject(tree);
+                    tt->addObject( std::move( *tree ) );
                 }
+                delete tree;
                 nsamples++;
             }
             delete tmp;
         }
 
-        data.push_back(TraceTree(tt));
+        rv->push_back( TraceTree( tt.release() ) );
     }
 
-    return new WorkspaceVector<TraceTree>(data);
+    return rv.release();
 }
 
 
@@ -54,6 +54,7 @@ variables_map parse_cmd_line(int argc, char* argv[])
 //	("verbose,V",value<int>()->implicit_value(1),"Log extra information for debugging.")
 
 	("batch,b","Run in batch mode.")
+	("profileStartup","Print the time spent in each phase of startup.")
         // multitoken means that `--args a1 a2 a3` works the same as `--args a1 --args a2 --args a3`
         ("args",value<std::vector<std::string> >()->multitoken(),"Command line arguments to initialize RevBayes variables.")
         // multitoken means that `--args a1 a2 a3` works the same as `--args a1 --args a2 --args a3`
@@ -218,7 +219,8 @@ int main(int argc, char* argv[]) {
 
 
     /* initialize environment */
-    RevLanguageMain rl = RevLanguageMain(batch_mode);
+    bool profile_startup = (args.count("profileStartup") > 0);
+    RevLanguageMain rl = RevLanguageMain(batch_mode, profile_startup);
 
     CommandLineOutputStream *rev_output = new CommandLineOutputStream();
     RevLanguage::UserInterface::userInterface().setOutputStream( rev_output );
@@ -13,6 +13,8 @@
 
 #include "ArgumentRule.h"
 #include "IntegerPos.h"
+#include "ModelVector.h"
+#include "Natural.h"
 #include "NaturalNumbersState.h"
 #include "StandardState.h"
 #include "RbException.h"
@@ -69,7 +71,26 @@ void Mntr_StochasticCharacterMapping::constructInternalObject( void )
     unsigned int       print_gen      = (int)static_cast<const IntegerPos &>( printgen->getRevObject()           ).getValue();
     bool               app            = static_cast<const RlBoolean       &>( append->getRevObject()             ).getValue();
     bool               wv             = static_cast<const RlBoolean       &>( version->getRevObject()            ).getValue();
-    size_t             idx            = (size_t)static_cast<const Natural &>( index->getRevObject()              ).getValue();
+    
+    // we monitor either a single site or several sites, which we map together
+    std::vector<size_t> idx;
+    const RevObject& index_object = index->getRevObject();
+    if ( index_object.isType( Natural::getClassTypeSpec() ) )
+    {
+        idx.push_back( (size_t)static_cast<const Natural &>( index_object ).getValue() - 1 );
+    }
+    else
+    {
+        const RevBayesCore::RbVector<long>& indices = static_cast<const ModelVector<Natural> &>( index_object ).getValue();
+        for (size_t i = 0; i < indices.size(); ++i)
+        {
+            idx.push_back( (size_t)indices[i] - 1 );
+        }
+    }
+    if ( idx.empty() == true )
+    {
+        throw RbException("mnStochasticCharacterMap requires the index of at least one character.");
+    }
 
 
     RevBayesCore::TypedDagNode<RevBayesCore::AbstractHomologousDiscreteCharacterData>* ctmc_tdn = NULL;
@@ -115,7 +136,7 @@ void Mntr_StochasticCharacterMapping::constructInternalObject( void )
         std::string data_type = ctmc_sn->getValue().getDataType();
         if (data_type == "Standard") {
             RevBayesCore::StochasticCharacterMappingMonitor<RevBayesCore::StandardState>* m;
-            m = new RevBayesCore::StochasticCharacterMappingMonitor<RevBayesCore::StandardState>( ctmc_sn, (unsigned long)print_gen, file_name, is, sd, sep, idx - 1 );
+            m = new RevBayesCore::StochasticCharacterMappingMonitor<RevBayesCore::StandardState>( ctmc_sn, (unsigned long)print_gen, file_name, is, sd, sep, idx );
             m->setAppend( app );
             m->setPrintVersion( wv );
             
@@ -124,7 +145,7 @@ void Mntr_StochasticCharacterMapping::constructInternalObject( void )
             
         } else if (data_type == "NaturalNumbers") {
             RevBayesCore::StochasticCharacterMappingMonitor<RevBayesCore::NaturalNumbersState>* m;
-            m = new RevBayesCore::StochasticCharacterMappingMonitor<RevBayesCore::NaturalNumbersState>( ctmc_sn, (unsigned long)print_gen, file_name, is, sd, sep, idx - 1 );
+            m = new RevBayesCore::StochasticCharacterMappingMonitor<RevBayesCore::NaturalNumbersState>( ctmc_sn, (unsigned long)print_gen, file_name, is, sd, sep, idx );
             m->setAppend( app );
             m->setPrintVersion( wv );
             
@@ -201,7 +222,10 @@ const MemberRules& Mntr_StochasticCharacterMapping::getParameterRules(void) cons
         monitor_rules.push_back( new ArgumentRule("cdbdp"          , TimeTree::getClassTypeSpec(),  "The character dependent birth-death process to monitor.",                      ArgumentRule::BY_REFERENCE, ArgumentRule::ANY, NULL) );
         monitor_rules.push_back( new ArgumentRule("include_simmap" , RlBoolean::getClassTypeSpec(), "Should we log SIMMAP/phytools compatible newick strings? True by default.",    ArgumentRule::BY_VALUE,     ArgumentRule::ANY, new RlBoolean(true) ) );
         monitor_rules.push_back( new ArgumentRule("use_simmap_default" , RlBoolean::getClassTypeSpec(), "Should we use the default SIMMAP/phytools event ordering? True by default.",    ArgumentRule::BY_VALUE,     ArgumentRule::ANY, new RlBoolean(true) ) );
-        monitor_rules.push_back( new ArgumentRule("index"          , Natural::getClassTypeSpec(), "The index of the character to be monitored.", ArgumentRule::BY_VALUE, ArgumentRule::ANY, new Natural(1) ) );
+        std::vector<TypeSpec> index_types;
+        index_types.push_back( Natural::getClassTypeSpec() );
+        index_types.push_back( ModelVector<Natural>::getClassTypeSpec() );
+        monitor_rules.push_back( new ArgumentRule("index"          , index_types, "The index of the character to be monitored, or the indices of several characters that are mapped together.", ArgumentRule::BY_VALUE, ArgumentRule::ANY, new Natural(1) ) );
 
         // add the rules from the base class
         const MemberRules &parentRules = FileMonitor::getParameterRules();
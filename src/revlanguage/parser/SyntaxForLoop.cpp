@@ -19,6 +19,7 @@ using namespace RevLanguage;
 SyntaxForLoop::SyntaxForLoop( const std::string& identifier, SyntaxElement* inExpr ) : SyntaxElement(),
     varName( identifier ),
     inExpression( inExpr ),
+    stateSpaceVariable( NULL ),
     stateSpace( NULL ),
     nextIndex( 0 )
 {
@@ -35,6 +36,7 @@ SyntaxForLoop::SyntaxForLoop( const SyntaxForLoop& x ) : SyntaxElement(x)
 {
     varName                     = x.varName;
     inExpression                = x.inExpression->clone();
+    stateSpaceVariable          = NULL;
     stateSpace                  = NULL;
     nextIndex                   = 0;
 }
@@ -44,7 +46,6 @@ SyntaxForLoop::SyntaxForLoop( const SyntaxForLoop& x ) : SyntaxElement(x)
 SyntaxForLoop::~SyntaxForLoop()
 {
     delete inExpression;
-    delete stateSpace;
 }
 
 
@@ -56,10 +57,10 @@ SyntaxForLoop& SyntaxForLoop::operator=( const SyntaxForLoop& x )
         SyntaxElement::operator=(x);
 
         delete inExpression;
-        delete stateSpace;
 
         varName                     = x.varName;
         inExpression                = x.inExpression->clone();
+        stateSpaceVariable          = NULL;
         stateSpace                  = NULL;
         nextIndex                   = 0;
     }
@@ -82,10 +83,13 @@ RevPtr<RevVariable> SyntaxForLoop::evaluateContent( Environment& env, bool dynam
 }
 
 
-/** Finalize loop. */
+/** Finalize loop. We release the state space so that it does not outlive the loop. */
 void SyntaxForLoop::finalizeLoop( void )
 {
-    nextIndex = 0;
+    nextIndex           = 0;
+    stateSpace          = NULL;
+    stateSpaceVariable  = NULL;
+    loopVariable        = NULL;
 }
 
 
@@ -104,8 +108,8 @@ const std::string& SyntaxForLoop::getIndexVarName( void ) const
  */
 void SyntaxForLoop::getNextLoopState( void )
 {
-    // Get the next value from the container
-    RevObject* elm = stateSpace->getElement( nextIndex-1 )->clone();
+    // Get the next value from the container (getElement already hands us a new object)
+    RevObject* elm = stateSpace->getElement( nextIndex-1 );
 
     // Set the loop variable to the next value using a control variable assignment
     loopVariable->replaceRevObject( elm );
@@ -128,16 +132,27 @@ void SyntaxForLoop::initializeLoop( Environment& env )
     assert ( nextIndex == 0 );  // Check that we are not running already
 
     // Evaluate expression and check that we get a vector
-    const RevPtr<RevVariable>&      theVar   = inExpression->evaluateContent(env);
-    const RevObject&             theValue    = theVar->getRevObject();
+    RevPtr<RevVariable>             theVar      = inExpression->evaluateContent(env);
+    const RevObject&                theValue    = theVar->getRevObject();
 
     // Check that it is a container (the first dimension of which we will use)
-    stateSpace = dynamic_cast<Container*>( theValue.clone() );
-    if ( stateSpace == NULL )
+    if ( dynamic_cast<const Container*>( &theValue ) == NULL )
     {
        throw RbException( "The 'in' expression does not evaluate to a container" );
     }
     
+    // A temporary result is owned by us alone and cannot change inside the loop,
+    // so we only need a private copy if the expression refers to a named variable
+    if ( theVar->getReferenceCount() == 1 && theVar->isReferenceVariable() == false && theVar->getName() == "" )
+    {
+        stateSpaceVariable = theVar;
+    }
+    else
+    {
+        stateSpaceVariable = new RevVariable( theValue.clone() );
+    }
+    stateSpace = dynamic_cast<const Container*>( &stateSpaceVariable->getRevObject() );
+    
     // Add the loop variable to the environment, if it is not already there
     if ( env.existsVariable( varName ) == false )
     {
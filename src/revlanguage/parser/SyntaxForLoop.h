@@ -32,6 +32,11 @@ namespace RevLanguage {
      * it from its first dimension. For a vector, this simply means that the
      * loop variable takes on each of the values of the vector in turn.
      *
+     * If the in-expression evaluates to a temporary (e.g. '1:n'), nobody else
+     * can modify it while the loop runs, so we iterate over it directly instead
+     * of taking a private copy. Each loop state only creates the element that
+     * is handed over to the loop variable.
+     *
      * Like in R, loops do not open up new local environment. All statements
      * in the for loop are executed in the outer environment, and the loop
      * variable remains there after the loop finishes, as in R.
@@ -64,7 +69,8 @@ namespace RevLanguage {
         
         std::string                 varName;                                                        //!< The name of the loop variable
         SyntaxElement*              inExpression;                                                   //!< The in expression (a vector of values)
-        Container*                  stateSpace;                                                     //!< Vector result of 'in' expression
+        RevPtr<RevVariable>         stateSpaceVariable;                                             //!< Variable holding the vector result of 'in' expression
+        const Container*            stateSpace;                                                     //!< Vector result of 'in' expression
         size_t                      nextIndex;                                                      //!< Next element in vector
         RevPtr<RevVariable>         loopVariable;                                                   //!< Smart pointer to the loop variable in the environment
 
@@ -1,5 +1,6 @@
 #include "Environment.h"
 
+#include <memory>
 #include <sstream> // IWYU pragma: keep
 #include <utility>
 
@@ -134,9 +135,11 @@ bool Environment::addFunction( Function* func )
     
     // add the help entry for this function to the global help system instance
     // but only if this is not an internal function
+    // the entry is only constructed when the help system is first queried
     if ( func->isInternal() == false )
     {
-        RevBayesCore::RbHelpSystem::getHelpSystem().addHelpFunction( static_cast<RevBayesCore::RbHelpFunction*>(func->getHelpEntry()) );
+        std::shared_ptr<const Function> f( func->clone() );
+        RevBayesCore::RbHelpSystem::getHelpSystem().addHelpFunction( [f]() { return static_cast<RevBayesCore::RbHelpFunction*>( f->getHelpEntry() ); } );
     }
 
     return true;
@@ -119,6 +119,7 @@ void FunctionTable::addFunction( Function *func )
 
     // Insert the function
     insert(std::pair<std::string, Function* >(name, func));
+    resolved_calls.clear();
     
     std::vector<std::string> aliases = func->getFunctionNameAliases();
     for (size_t i=0; i < aliases.size(); ++i)
@@ -146,6 +147,7 @@ void FunctionTable::clear(void)
     }
     
     std::multimap<std::string, Function*>::clear();
+    resolved_calls.clear();
     
 }
 
@@ -176,6 +178,7 @@ void FunctionTable::eraseFunction(const std::string& name)
     }
     
     erase(ret_val.first, ret_val.second);
+    resolved_calls.clear();
     
 }
 
@@ -311,10 +314,20 @@ const Function* FunctionTable::findFunction(const std::string& name, const std::
         }
         
     }
+    
+    // Have we already resolved a call with the same signature?
+    std::string signature = getCallSignature( name, args, once );
+    std::map<std::string, const Function*>::const_iterator resolved = resolved_calls.find( signature );
+    if ( resolved != resolved_calls.end() )
+    {
+        return resolved->second;
+    }
+    
     ret_val = equal_range(name);
     if (hits == 1)
     {
-        if (ret_val.first->second->checkArguments(args,NULL,once) == false)
+        bool exact_match = false;
+        if (ret_val.first->second->checkArguments(args,NULL,once,&exact_match) == false)
         {
             std::ostringstream msg;
 
@@ -378,6 +391,12 @@ const Function* FunctionTable::findFunction(const std::string& name, const std::
             msg << std::endl;
             throw RbException( msg.str() );
         }
+        
+        if ( exact_match == true )
+        {
+            resolved_calls[signature] = ret_val.first->second;
+        }
+        
         return ret_val.first->second;
     }
     else 
@@ -385,19 +404,22 @@ const Function* FunctionTable::findFunction(const std::string& name, const std::
         std::vector<double>* match_score = new std::vector<double>();
         std::vector<double> best_score;
         Function* best_match = NULL;
+        bool best_exact = false;
+        bool exact_match = false;
 
         bool ambiguous = false;
         std::multimap<std::string, Function *>::const_iterator it;
         for (it=ret_val.first; it!=ret_val.second; it++)
         {
             match_score->clear();
-            if ( (*it).second->checkArguments(args, match_score, once) == true )
+            if ( (*it).second->checkArguments(args, match_score, once, &exact_match) == true )
             {
                 std::sort(match_score->begin(), match_score->end(), std::greater<double>());
                 if ( best_match == NULL )
                 {
                     best_score = *match_score;
                     best_match = it->second;
+                    best_exact = exact_match;
                     ambiguous = false;
                 }
                 else 
@@ -410,6 +432,7 @@ const Function* FunctionTable::findFunction(const std::string& name, const std::
                         {
                             best_score = *match_score;
                             best_match = it->second;
+                            best_exact = exact_match;
                             ambiguous = false;
                             break;
                         }
@@ -476,6 +499,11 @@ const Function* FunctionTable::findFunction(const std::string& name, const std::
         }
         else 
         {
+            if ( best_exact == true )
+            {
+                resolved_calls[signature] = best_match;
+            }
+            
             return best_match;
         }
         
@@ -484,6 +512,47 @@ const Function* FunctionTable::findFunction(const std::string& name, const std::
 }
 
 
+/**
+ * Get the signature of a call, which is used as the key of the cache of resolved calls.
+ * It contains everything that argument matching without type conversion depends on:
+ * the function name, the labels, types and DAG node types of the arguments, and whether
+ * the function is evaluated once.
+ */
+std::string FunctionTable::getCallSignature(const std::string& name, const std::vector<Argument>& args, bool once) const
+{
+    
+    std::string signature = name;
+    signature += ( once ? "(1" : "(0" );
+    
+    for (std::vector<Argument>::const_iterator it = args.begin(); it != args.end(); ++it)
+    {
+        signature += ',';
+        signature += it->getLabel();
+        signature += ':';
+        
+        const RevPtr<const RevVariable>& the_var = it->getVariable();
+        if ( the_var == NULL )
+        {
+            signature += "NULL";
+            continue;
+        }
+        
+        const RevObject& the_object = the_var->getRevObject();
+        signature += the_object.getType();
+        signature += '/';
+        signature += the_var->getRequiredTypeSpec().getType();
+        signature += ( the_var->isWorkspaceVariable() ? "/w" : "/m" );
+        if ( the_object.isModelObject() == true && the_object.getDagNode() != NULL )
+        {
+            signature += char( '0' + the_object.getDagNode()->getDagNodeType() );
+        }
+    }
+    signature += ')';
+    
+    return signature;
+}
+
+
 /**
  * Get first function. This function will find the first function with a matching name without
  * throwing an error. Compare with the getFunction(name) function, which will throw an error
@@ -719,12 +788,14 @@ void FunctionTable::replaceFunction( const std::string& name, Function *func )
         {
             delete it->second;
             it->second = func;
+            resolved_calls.clear();
             return;
         }
     }
     
     // No match; simply insert the function
     insert(std::pair<std::string, Function* >( name, func ) );
+    resolved_calls.clear();
     
     // Name the function so that it is aware of what it is called
     func->setName( name );
@@ -747,7 +818,14 @@ void FunctionTable::testFunctionValidity( const std::string& name, Function* fun
     // We only need to make these tests if the function name already exists
     if ( existsFunction( name ) )
     {
-        Function* fxn = getFirstFunction( name );
+        // look up the first function with this name without cloning all its overloads,
+        // because this test is run for every function we add to the workspace
+        const FunctionTable* table = this;
+        while ( table->find( name ) == table->end() )
+        {
+            table = table->parentTable;
+        }
+        const Function* fxn = table->lower_bound( name )->second;
         
         // Functions need to be of same type (procedure or function)
         if ( fxn->isProcedure() != func->isProcedure() )
@@ -779,9 +857,6 @@ void FunctionTable::testFunctionValidity( const std::string& name, Function* fun
             fxn->printValue(msg, true);
             msg << " : procedure/function mismatch" << std::endl;
             
-            // free function memory
-            delete fxn;
-            
             // throw the error message
             throw RbException(msg.str());
         }
@@ -817,9 +892,6 @@ void FunctionTable::testFunctionValidity( const std::string& name, Function* fun
         }
 #endif
         
-        
-        // free function memory
-        delete fxn;
     }
     
 }
@@ -25,6 +25,11 @@ namespace RevLanguage {
      * is derived from. Function tables can be nested; each table defers
      * calls to its parent(s) when the task cannot be solved locally.
      *
+     * Overload resolution is expensive, so we remember the functions found for
+     * previous calls, keyed by the function name and the signature of the
+     * passed arguments (labels, types and DAG node types). We only do so if the
+     * arguments matched without type conversion, because conversion may depend
+     * on the argument values. The cache is cleared whenever the table changes.
      */
     class FunctionTable : public std::multimap<std::string, Function*> {
         
@@ -67,6 +72,12 @@ namespace RevLanguage {
         // Member variables
         const FunctionTable*                    parentTable;                                                                                //!< Enclosing table
 
+    private:
+        
+        std::string                             getCallSignature(const std::string& name, const std::vector<Argument>& args, bool once) const;  //!< Key for the resolved calls cache
+        
+        mutable std::map<std::string, const Function*>  resolved_calls;                                                                     //!< Functions previously found for a call signature
+
 };
     
 }
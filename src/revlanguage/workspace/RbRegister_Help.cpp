@@ -24,8 +24,7 @@ void RevLanguage::Workspace::initializeExtraHelp(void)
 //        MonteCarloAnalysis mca;
 //        RevBayesCore::RbHelpSystem::getHelpSystem().addHelpType( static_cast<RevBayesCore::RbHelpType*>(mca.getHelpEntry()) );
 
-        TimeTree tt;
-        RevBayesCore::RbHelpSystem::getHelpSystem().addHelpType( static_cast<RevBayesCore::RbHelpType*>(tt.getHelpEntry()) );
+        RevBayesCore::RbHelpSystem::getHelpSystem().addHelpType( []() { TimeTree tt; return static_cast<RevBayesCore::RbHelpType*>(tt.getHelpEntry()); } );
 
     }
     catch(RbException& rbException)
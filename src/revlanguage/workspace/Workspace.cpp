@@ -1,4 +1,6 @@
 #include <stddef.h>
+#include <chrono>
+#include <iomanip>
 #include <sstream>
 #include <map>
 #include <string>
@@ -18,6 +20,7 @@
 #include "RbHelpType.h"
 #include "RevPtr.h"
 #include "RevVariable.h"
+#include "RlUserInterface.h"
 #include "TypeSpec.h"
 
 using namespace RevLanguage;
@@ -120,8 +123,10 @@ bool Workspace::addDistribution( Distribution *dist )
     function_table.addFunction( new ConstructorFunction( dist ) );
     
     // add the help entry for this distribution to the global help system instance
-    RevBayesCore::RbHelpDistribution* entry = static_cast<RevBayesCore::RbHelpDistribution*>( dist->getHelpEntry() );
-    RevBayesCore::RbHelpSystem::getHelpSystem().addHelpDistribution( entry );
+    // the entry is only constructed when the help system is first queried
+    // the distribution is owned by its constructor function, which lives as long as the workspace
+    const Distribution *d = dist;
+    RevBayesCore::RbHelpSystem::getHelpSystem().addHelpDistribution( [d]() { return static_cast<RevBayesCore::RbHelpDistribution*>( d->getHelpEntry() ); } );
 
     return true;
 }
@@ -162,7 +167,10 @@ bool Workspace::addType( RevObject *templ )
     }
 
     // add the help entry for this type to the global help system instance
-    RevBayesCore::RbHelpSystem::getHelpSystem().addHelpType( static_cast<RevBayesCore::RbHelpType*>( templ->getHelpEntry() ) );
+    // the entry is only constructed when the help system is first queried
+    // the template is owned by its constructor function or the type table, which live as long as the workspace
+    const RevObject *t = templ;
+    RevBayesCore::RbHelpSystem::getHelpSystem().addHelpType( [t]() { return static_cast<RevBayesCore::RbHelpType*>( t->getHelpEntry() ); } );
 
     return true;
 }
@@ -246,20 +254,50 @@ const TypeTable& Workspace::getTypeTable( void ) const
  * - functions
  * - basics
  */
-void Workspace::initializeGlobalWorkspace( void )
+void Workspace::initializeGlobalWorkspace( bool print_timing )
 {
     
-    initializeBasicTypeGlobalWorkspace();
-    initializeVectorTypeGlobalWorkspace();
-    initializeTypeGlobalWorkspace();
-    initializeMonitorGlobalWorkspace();
-    initializeMoveGlobalWorkspace();
-    initializeDistGlobalWorkspace();
-    initializeFuncGlobalWorkspace();
-    initializeBasicGlobalWorkspace();
-    initializeDemographicFunctionGlobalWorkspace();
+    typedef void (Workspace::*InitializationPhase)(void);
     
-    initializeExtraHelp();
+    // the phases in the order in which they need to be run
+    const std::pair<const char*, InitializationPhase> phases[] =
+    {
+        std::make_pair( "basic types",              &Workspace::initializeBasicTypeGlobalWorkspace ),
+        std::make_pair( "vector types",             &Workspace::initializeVectorTypeGlobalWorkspace ),
+        std::make_pair( "types",                    &Workspace::initializeTypeGlobalWorkspace ),
+        std::make_pair( "monitors",                 &Workspace::initializeMonitorGlobalWorkspace ),
+        std::make_pair( "moves",                    &Workspace::initializeMoveGlobalWorkspace ),
+        std::make_pair( "distributions",            &Workspace::initializeDistGlobalWorkspace ),
+        std::make_pair( "functions",                &Workspace::initializeFuncGlobalWorkspace ),
+        std::make_pair( "basic functions",          &Workspace::initializeBasicGlobalWorkspace ),
+        std::make_pair( "demographic functions",    &Workspace::initializeDemographicFunctionGlobalWorkspace ),
+        std::make_pair( "extra help",               &Workspace::initializeExtraHelp )
+    };
+    
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < sizeof(phases) / sizeof(phases[0]); ++i)
+    {
+        std::chrono::steady_clock::time_point phase_start = std::chrono::steady_clock::now();
+        size_t num_functions = function_table.size();
+        
+        (this->*phases[i].second)();
+        
+        if ( print_timing == true )
+        {
+            std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - phase_start;
+            std::ostringstream o;
+            o << "Initialized " << phases[i].first << " in " << std::fixed << std::setprecision(1) << elapsed.count() << " ms (" << function_table.size() - num_functions << " functions)";
+            RBOUT( o.str() );
+        }
+    }
+    
+    if ( print_timing == true )
+    {
+        std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+        std::ostringstream o;
+        o << "Initialized global workspace in " << std::fixed << std::setprecision(1) << elapsed.count() << " ms (" << function_table.size() << " functions, " << typeTable.size() << " types)";
+        RBOUT( o.str() );
+    }
 
 }
 
@@ -66,7 +66,7 @@ namespace RevLanguage {
         bool                                existsType(const std::string& name) const;                                  //!< Does the type exist in the type table?
         const TypeSpec&                     getClassTypeSpecOfType(const std::string& type) const;                      //!< Get reference to class vector of type
         const TypeTable&                    getTypeTable(void) const;                                                   //!< Get the type table
-        void                                initializeGlobalWorkspace(void);                                            //!< Initialize global workspace for types
+        void                                initializeGlobalWorkspace(bool print_timing = false);                       //!< Initialize global workspace for types (optionally printing the time of each phase)
         RevObject*                          makeNewDefaultObject(const std::string& type) const;                        //!< Make a clone of the template type object
         void                                updateVectorVariables(void);
         